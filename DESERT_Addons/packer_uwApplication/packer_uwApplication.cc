@@ -97,7 +97,8 @@ size_t packer_uwApplication::packMyHdr(Packet* p, unsigned char* buffer, size_t
         offset += put(buffer, offset, &(applh->priority_), n_bits[PRIORITY_FIELD]);
         offset += put(buffer, offset, &(applh->payload_size_), n_bits[PAYLOAD_SIZE_FIELD]);
         int payload_size_bits = applh->payload_size()*8;
-        offset += put(buffer, offset, &(applh->payload_msg), payload_size_bits);
+        char* payload = hdr_DATA_APPLICATION::payload_msg(p, applh->payload_size());
+        offset += put(buffer, offset, payload, payload_size_bits);
 
         if (debug_) {
             std::cout << "\033[1;37;45m (TX) UWAPPLICATION::DATA packer hdr \033[0m" << std::endl;
@@ -123,12 +124,13 @@ size_t packer_uwApplication::unpackMyHdr(unsigned char* buffer, size_t offset, P
         offset += get(buffer, offset, &(applh->rftt_valid_), n_bits[RFFTVALID_FIELD]);
         memset(&(applh->priority_), 0, sizeof (applh->priority_));
         offset += get(buffer, offset, &(applh->priority_), n_bits[PRIORITY_FIELD]);
-        memset(&(applh->payload_msg), 0, sizeof (applh->payload_size_));
+        memset(&(applh->payload_size_), 0, sizeof (applh->payload_size_));
         offset += get(buffer, offset, &(applh->payload_size_), n_bits[PAYLOAD_SIZE_FIELD]);
-        memset(&(applh->payload_msg), 0, sizeof (applh->payload_msg));
+        hdr_DATA_APPLICATION::clear_payload_msg(p);
+        char* payload = hdr_DATA_APPLICATION::payload_msg(p, applh->payload_size());
         int payload_size_bit = applh->payload_size()*8;
         //offset += get(buffer, offset, &(applh->payload_msg), n_bits[PAYLOADMSG_FIELD]);
-        offset += get(buffer, offset, &(applh->payload_msg), payload_size_bit);
+        offset += get(buffer, offset, payload, payload_size_bit);
                 
         if (debug_) {
             std::cout << "\033[1;32;40m (RX) UWAPPLICATION::DATA packer hdr \033[0m" << std::endl;
@@ -163,9 +165,10 @@ void packer_uwApplication::printMyHdrFields(Packet* p) {
         std::cout << "\033[1;37;45m 4th field \033[0m, PRIORITY_FIELD: " << (int)applh->priority_ << std::endl;
         std::cout << "\033[1;37;45m 5th field \033[0m, PAYLOADMSG_SIZE_FIELD: " << applh->payload_size_ << std::endl;
         std::cout << "\033[1;37;45m 5th field \033[0m, PAYLOADMSG_FIELD: ";
+        const char* payload = hdr_DATA_APPLICATION::payload_msg(p, applh->payload_size());
         for(int i=0;i<applh->payload_size();i++)
         {
-            cout << applh->payload_msg[i];
+            cout << payload[i];
         }
         std::cout << endl;
     }
@@ -29,4 +29,4 @@
 # Author: Federico Favaro
 # Version: 1.0.0
 
-NS2/MAC/UW-CSMA-CA/Packer set txtime_Bits 8
\ No newline at end of file
+NS2/MAC/UW-CSMA-CA/Packer set txtime_Bits 16
\ No newline at end of file
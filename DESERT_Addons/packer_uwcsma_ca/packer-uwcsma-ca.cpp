@@ -112,7 +112,7 @@ packerUwCsmaCa::unpackMyHdr(unsigned char *buf, size_t offset, Packet *p)
 		hdr_ca_RTS *rts;
 		rts = CA_RTS_HDR_ACCESS(p);
 
-		memset(&(rts->get_tx_time()), 0, sizeof(uint8_t));
+		memset(&(rts->get_tx_time()), 0, sizeof(uint16_t));
 		offset += get(buf, offset, &(rts->get_tx_time()), txtime_Bits);
 
 		if (debug_) {
@@ -124,7 +124,7 @@ packerUwCsmaCa::unpackMyHdr(unsigned char *buf, size_t offset, Packet *p)
 		hdr_ca_CTS *cts;
 		cts = CA_CTS_HDR_ACCESS(p);
 
-		memset(&(cts->get_tx_time()), 0, sizeof(uint8_t));
+		memset(&(cts->get_tx_time()), 0, sizeof(uint16_t));
 		offset += get(buf, offset, &(cts->get_tx_time()), txtime_Bits);
 
 		if (debug_) {
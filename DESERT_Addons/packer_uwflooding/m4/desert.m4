@@ -48,6 +48,8 @@ AC_DEFUN([AC_ARG_WITH_DESERT],[
                 fi
 
                 for dir in             \
+                    utilities/uwperfstats \
+                    utilities/uwpacketpool \
                     physical/uw-al     \
                     network/uwflooding \
                     network/uwip       \
@@ -72,6 +72,12 @@ void PackerUwFlooding::init() {
     if (debug_)
         std::cout << "Re-initialization of n_bits for the UWFLOODING packer " << std::endl;
 
+    if (ttl_Bits > 8 * sizeof (uint8_t)) {
+        std::cerr << "UWFLOODING packer: ttl_Bits " << ttl_Bits
+                  << " exceeds the ttl size, clamped" << std::endl;
+        ttl_Bits = 8 * sizeof (uint8_t);
+    }
+
     n_bits.clear();
     n_bits.push_back(ttl_Bits);
 }
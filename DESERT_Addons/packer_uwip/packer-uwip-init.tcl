@@ -1,3 +1,6 @@
-UW/IP/Packer set SAddr_Bits 32
-UW/IP/Packer set DAddr_Bits 32
+# Keep both fields equal to Module/UW/IP addr_bits_ (8 by default). With 8
+# bits the 16-bit addresses are sent compressed and 0xff stands for the
+# broadcast address; set all of them to 16 for networks above 254 nodes.
+UW/IP/Packer set SAddr_Bits 8
+UW/IP/Packer set DAddr_Bits 8
 UW/IP/Packer set debug_ 0
@@ -51,8 +51,9 @@ public:
 
 //packerUWIP::packerUWIP() : packer(false), isRacunBroadcast(0) {
 packerUWIP::packerUWIP() : packer(false) {
-    SAddr_Bits = 8 * sizeof (uint8_t);
-    DAddr_Bits = 8 * sizeof (uint8_t);
+    // same default as Module/UW/IP addr_bits_: compressed addresses
+    SAddr_Bits = 8;
+    DAddr_Bits = 8;
 
     bind("SAddr_Bits", (int*) &SAddr_Bits);
     bind("DAddr_Bits", (int*) &DAddr_Bits);
@@ -76,6 +77,17 @@ void packerUWIP::init() {
     if (debug_)
         cout << "Re-initialization of n_bits for the UWIP packer " << endl;
 
+    if (SAddr_Bits > (size_t) UWIP_ADDR_BITS) {
+        cerr << "UWIP packer: SAddr_Bits " << SAddr_Bits << " exceeds the "
+             << UWIP_ADDR_BITS << " address bits, clamped" << endl;
+        SAddr_Bits = UWIP_ADDR_BITS;
+    }
+    if (DAddr_Bits > (size_t) UWIP_ADDR_BITS) {
+        cerr << "UWIP packer: DAddr_Bits " << DAddr_Bits << " exceeds the "
+             << UWIP_ADDR_BITS << " address bits, clamped" << endl;
+        DAddr_Bits = UWIP_ADDR_BITS;
+    }
+
     n_bits.clear();
 
     n_bits.push_back(SAddr_Bits);
@@ -113,6 +125,9 @@ size_t packerUWIP::unpackMyHdr(unsigned char* buf, size_t offset, Packet* p) {
     memset(&(hip->daddr()), 0, sizeof ( hip->daddr_));
     offset += get(buf, offset, &(hip->daddr_), n_bits[field_idx++]);
 
+    hip->saddr_ = expandAddr(hip->saddr_, n_bits[0]);
+    hip->daddr_ = expandAddr(hip->daddr_, n_bits[1]);
+
 //    if (isRacunBroadcast && (hip->daddr_ == RACUN_BROADCAST)){
 //        hip->daddr_ = UWIP_BROADCAST;
 //    }
@@ -125,6 +140,14 @@ size_t packerUWIP::unpackMyHdr(unsigned char* buf, size_t offset, Packet* p) {
     return offset;
 }
 
+uwip_addr_t packerUWIP::expandAddr(uwip_addr_t addr, size_t bits) {
+    if (bits == 0 || bits >= (size_t) UWIP_ADDR_BITS)
+        return addr;
+    if (addr == ((1u << bits) - 1))
+        return UWIP_BROADCAST;
+    return addr;
+}
+
 void packerUWIP::printMyHdrMap() {
     std::cout << "\033[0;42;30m" << " Packer Name " << "\033[0m" << " UWIP" << std::endl;
     std::cout << "\033[0;42;30m 1st field " << "\033[0m" << " saddr: " << SAddr_Bits << " bits" << std::endl;
@@ -93,6 +93,14 @@ private:
      * @param Pointer of the packet 
      */
     void printMyHdrFields(Packet*);
+    /**
+     * Restores an address received on fewer bits than UWIP_ADDR_BITS: the
+     * all-ones value of the compressed field is the broadcast address.
+     * @param addr Address read from the buffer
+     * @param bits Bits the address was sent on
+     * @return The uncompressed address
+     */
+    static uwip_addr_t expandAddr(uwip_addr_t addr, size_t bits);
 
     size_t SAddr_Bits; /** Bit length of the saddr_ field to be put in the header stream of bits. */
     size_t DAddr_Bits; /** Bit length of the daddr_ field to be put in the header stream of bits. */
@@ -48,6 +48,7 @@ AC_DEFUN([AC_ARG_WITH_DESERT],[
                 fi
 
                 for dir in         \
+                    utilities/uwpacketpool \
                     physical/uw-al \
                     data_link/uwpolling
                 do
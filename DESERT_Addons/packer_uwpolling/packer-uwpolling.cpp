@@ -35,6 +35,8 @@
 
  #include "packer-uwpolling.h"
 
+#include <algorithm>
+
  static class PackerUwpollingClass : public TclClass {
 public:
 
@@ -190,22 +192,10 @@ size_t packerUwpolling::packMyHdr(Packet* p, unsigned char* buf, size_t offset)
     }
     else if (ch->ptype() == PT_ACK_SINK) {
         hdr_ACK_SINK *ackh = HDR_ACK_SINK(p);
-        uint16_t uid_acks_array[ack_array_size];
-        std::vector<uint16_t>::iterator ack_id_it;
-        size_t fix_array_it = 0;
-        for (ack_id_it = ackh->id_ack_.begin(); ack_id_it != ackh->id_ack_.end(); ++ack_id_it) {
-            uid_acks_array[fix_array_it] = (uint16_t)*ack_id_it;
-            fix_array_it++;
-            if ( fix_array_it >= (ack_array_size+1)) {
-                break;
-            }
-        }
-           
-        size_t actual_size = fix_array_it;
+        size_t actual_size = std::min((size_t) ackh->n_ack(), ack_array_size);
         offset += put(buf, offset, &(actual_size), n_bits[ACK_ARRAY_SIZE]);
-        fix_array_it = 0;
-        for (fix_array_it = 0; fix_array_it < actual_size; fix_array_it++) {
-            offset += put(buf, offset, &(uid_acks_array[fix_array_it]), n_bits[ACK_ELEM_BITS]);
+        for (size_t i = 0; i < actual_size; i++) {
+            offset += put(buf, offset, &(ackh->id_ack(i)), n_bits[ACK_ELEM_BITS]);
         }
 		if (debug_)
         {
@@ -326,10 +316,13 @@ size_t packerUwpolling::unpackMyHdr(unsigned char* buf, size_t offset, Packet* p
         int array_size = 0;
         uint16_t app;
         offset += get(buf, offset, &(array_size), n_bits[ACK_ARRAY_SIZE]);
+        // a corrupted size must not overflow id_ack_
+        array_size = std::min(array_size, MAX_ACK_SINK_IDS);
+        ackh->n_ack() = 0;
         for (int i=0; i < array_size; i++) {
             app = 0;
             offset += get(buf, offset, &(app), n_bits[ACK_ELEM_BITS]);
-            ackh->id_ack_.push_back(app);
+            ackh->addAck(app);
         }
 
         if (debug_)
@@ -399,12 +392,9 @@ void packerUwpolling::printMyHdrFields(Packet* p)
     else if ( ch->ptype() == PT_ACK_SINK)
     {
         hdr_ACK_SINK* ackh = HDR_ACK_SINK(p);
-        std::vector<uint16_t>::iterator ack_id_it;
-        uint count = 0;
-        for (ack_id_it = ackh->id_ack_.begin(); ack_id_it != ackh->id_ack_.end(); ++ack_id_it) {
-            count++;
-            cout << "\033[1;37;41m 1st field \033[0m, ack_id " << count << " : " 
-                    << (uint16_t)*ack_id_it << std::endl;
+        for (int i = 0; i < ackh->n_ack(); i++) {
+            cout << "\033[1;37;41m 1st field \033[0m, ack_id " << i + 1 << " : " 
+                    << ackh->id_ack(i) << std::endl;
         }	 
     }
     else// ( ch->ptype() == PT_AUV_MULE)
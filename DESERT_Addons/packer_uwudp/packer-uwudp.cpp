@@ -50,8 +50,8 @@ public:
 } class_module_packerUWUDP;
 
 packerUWUDP::packerUWUDP() : packer(false) {
-    SPort_Bits = 8 * sizeof (u_int16_t);
-    DPort_Bits = 8 * sizeof (u_int16_t);
+    SPort_Bits = 8 * sizeof (uint8_t);
+    DPort_Bits = 8 * sizeof (uint8_t);
 
     bind("SPort_Bits", (int*) &SPort_Bits);
     bind("DPort_Bits", (int*) &DPort_Bits);
@@ -74,6 +74,17 @@ void packerUWUDP::init() {
     if (debug_)
         cout << "Re-initialization of n_bits for the UWUDP packer " << endl;
 
+    if (SPort_Bits > 8 * sizeof (uint8_t)) {
+        cerr << "UWUDP packer: SPort_Bits " << SPort_Bits
+             << " exceeds the port size, clamped" << endl;
+        SPort_Bits = 8 * sizeof (uint8_t);
+    }
+    if (DPort_Bits > 8 * sizeof (uint8_t)) {
+        cerr << "UWUDP packer: DPort_Bits " << DPort_Bits
+             << " exceeds the port size, clamped" << endl;
+        DPort_Bits = 8 * sizeof (uint8_t);
+    }
+
     n_bits.clear();
 
     n_bits.push_back(SPort_Bits);
@@ -48,6 +48,7 @@ AC_DEFUN([AC_ARG_WITH_DESERT],[
                 fi
 
                 for dir in         \
+                    utilities/uwperfstats \
                     network/uwip
                 do
                     echo "considering dir \"$dir\""
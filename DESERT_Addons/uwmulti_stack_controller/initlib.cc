@@ -45,6 +45,7 @@ packet_t PT_MULTI_ST_SIGNALING;
 extern "C" int Uwmulti_stack_controller_Init() {
   // old protocol
   PT_MULTI_ST_SIGNALING = p_info::addPacket((char*) "MULTI_ST_SIGNALING");
+  CLMSG_CONTROLLER = ClMessage::addClMessage();
 
 	UwMultiStackControllerInitTclCode.load();
 	return 0;
@@ -185,13 +185,12 @@ int UwMultiStackControllerPhyMaster::checkBestLayer()
   double upper_threshold = getThreshold(last_layer_used_,id_short_range);
   double lower_threshold = getThreshold(last_layer_used_,id_long_range);
 
-  lower_id_active_ = (upper_threshold != UwMultiStackController::threshold_not_exist 
-                      && power_statistics_ > upper_threshold) ?
-                      id_short_range : lower_id_active_;
-
-  lower_id_active_ = (lower_threshold != UwMultiStackController::threshold_not_exist 
-                      && power_statistics_ < lower_threshold) ?
-                      id_long_range : lower_id_active_;
+  int best_layer = lower_id_active_;
+  if (isSwitchAllowed(last_layer_used_, id_short_range, power_statistics_, true))
+    best_layer = id_short_range;
+  if (isSwitchAllowed(last_layer_used_, id_long_range, power_statistics_, false))
+    best_layer = id_long_range;
+  switchLayer(best_layer);
   if (debug_)
   {
     std::cout << NOW << " ControllerPhyMaster("<< mac_addr 
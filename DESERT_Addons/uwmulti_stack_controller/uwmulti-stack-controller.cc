@@ -67,6 +67,7 @@ UwMultiStackController::UwMultiStackController()
   min_delay_(0),
   switch_mode_(UW_MANUAL_SWITCH),
   lower_id_active_(0),
+  last_switch_time_(0),
   signaling_pktSize_(1)
 {
 	bind("debug_", &debug_);
@@ -121,6 +122,26 @@ int UwMultiStackController::command(int argc, const char*const* argv)
       addThreshold(atoi(argv[2]),atoi(argv[3]),atof(argv[4]));
       return TCL_OK;
     }
+    /**
+     * parameters: layer_id1, layer_id2, hysteresis margin
+    */
+    else if(strcasecmp(argv[1], "setHysteresis") == 0)
+    {
+      if (!isLayerAvailable(atoi(argv[2])) || !isLayerAvailable(atoi(argv[3])))
+        return TCL_ERROR;
+      setHysteresis(atoi(argv[2]),atoi(argv[3]),atof(argv[4]));
+      return TCL_OK;
+    }
+    /**
+     * parameters: layer_id1, layer_id2, minimum dwell time in layer_id1
+    */
+    else if(strcasecmp(argv[1], "setMinDwell") == 0)
+    {
+      if (!isLayerAvailable(atoi(argv[2])) || !isLayerAvailable(atoi(argv[3])))
+        return TCL_ERROR;
+      setMinDwell(atoi(argv[2]),atoi(argv[3]),atof(argv[4]));
+      return TCL_OK;
+    }
   }
 	
   return Module::command(argc, argv);     
@@ -128,15 +149,22 @@ int UwMultiStackController::command(int argc, const char*const* argv)
 
 void UwMultiStackController::addLayer(int id, int order)
 {
-	assert(order > 0);
-  id2order.erase(id);
-  id2order.insert((std::pair<int,int>(id,order)));
-  order2id.erase(order);
-  order2id.insert((std::pair<int,int>(order,id)));
+	assert(order > 0 && id >= 0);
+  if (getOrder(id) != UwMultiStackController::layer_not_exist)
+    order2id[getOrder(id)] = UwMultiStackController::layer_not_exist;
+  if (getId(order) != UwMultiStackController::layer_not_exist)
+    id2order[getId(order)] = UwMultiStackController::layer_not_exist;
+  if (id >= (int) id2order.size())
+    id2order.resize(id + 1, UwMultiStackController::layer_not_exist);
+  if (order >= (int) order2id.size())
+    order2id.resize(order + 1, UwMultiStackController::layer_not_exist);
+  id2order[id] = order;
+  order2id[order] = id;
+  compileThresholds();
 }
 
 void UwMultiStackController::addThreshold(int i, int j, double thres_ij){
-  assert (id2order.find(i) != id2order.end() && id2order.find(j) != id2order.end() && i!=j);
+  assert (isLayerAvailable(i) && isLayerAvailable(j) && i!=j);
   setThreshold(i,j,thres_ij);
 }
 
@@ -170,7 +198,7 @@ void UwMultiStackController::recvFromUpperLayers(Packet *p)
 
 bool UwMultiStackController::isLayerAvailable(int id)
 {
-	return id2order.find(id) != id2order.end();
+	return getOrder(id) != UwMultiStackController::layer_not_exist;
 }
 
 double UwMultiStackController::getMetricFromSelectedLowerLayer(int id, Packet* p)
@@ -181,26 +209,55 @@ double UwMultiStackController::getMetricFromSelectedLowerLayer(int id, Packet* p
 }
 
 double UwMultiStackController::getThreshold(int i, int j) { 
-  ThresMatrix::iterator it = threshold_map.find(i); 
-  if (it != threshold_map.end()) {
-    ThresMap thres_i = it->second;
-    ThresMap::iterator it_thres_ij = thres_i.find(j);
-    if(it_thres_ij != thres_i.end())
-      return it_thres_ij->second;
-    else
-      return UwMultiStackController::threshold_not_exist;
-  }
-  return threshold_not_exist;
+  const UwTransition* t = getTransition(i, j);
+  return t ? t->threshold : UwMultiStackController::threshold_not_exist;
 }
 
 void UwMultiStackController::eraseThreshold(int i, int j) { 
   ThresMatrix::iterator it = threshold_map.find(i); 
   if (it != threshold_map.end()) {
-    ThresMap thres_i = it->second;
-    ThresMap::iterator it_thres_ij = thres_i.find(j);
-    if(it_thres_ij != thres_i.end())
-      thres_i.erase(j);
+    ThresMap &thres_i = it->second;
+    thres_i.erase(j);
     if(thres_i.size() == 0)
-      threshold_map.erase(i);
+      threshold_map.erase(it);
+    compileThresholds();
+  }
+}
+
+void UwMultiStackController::compileThresholds()
+{
+  size_t n_orders = order2id.size();
+  thres_matrix_.assign(n_orders * n_orders, UwTransition());
+  for (ThresMatrix::const_iterator it = threshold_map.begin(); it != threshold_map.end(); ++it)
+  {
+    int order_i = getOrder(it->first);
+    if (order_i == UwMultiStackController::layer_not_exist)
+      continue;
+    for (ThresMap::const_iterator it_j = it->second.begin(); it_j != it->second.end(); ++it_j)
+    {
+      int order_j = getOrder(it_j->first);
+      if (order_j != UwMultiStackController::layer_not_exist)
+        thres_matrix_[order_i * n_orders + order_j] = it_j->second;
+    }
+  }
+}
+
+bool UwMultiStackController::isSwitchAllowed(int i, int j, double metric, bool rising)
+{
+  const UwTransition* t = getTransition(i, j);
+  if (!t || std::isnan(t->threshold))
+    return false;
+  if (NOW - last_switch_time_ < t->min_dwell)
+    return false;
+  return rising ? metric > t->threshold + t->hysteresis 
+                : metric < t->threshold - t->hysteresis;
+}
+
+void UwMultiStackController::switchLayer(int id)
+{
+  if (id != lower_id_active_)
+  {
+    lower_id_active_ = id;
+    last_switch_time_ = NOW;
   }
 }
\ No newline at end of file
@@ -43,6 +43,7 @@
 #include <module.h>
 #include <tclcl.h>
 #include <map>
+#include <vector>
 
 #include <iostream>
 #include <string.h>
@@ -50,8 +51,19 @@
 #include <climits>
 #include "controller-clmsg.h"
 
-typedef std::map <int, double> ThresMap; /**< Threshoold map <PHY_order, threshold>*/
-typedef std::map <int, ThresMap> ThresMatrix; /**< Thresholds matrix*/
+/**
+ * Parameters of the transition from a layer to another one.
+ */
+struct UwTransition {
+  double threshold; /**< Threshold to switch, NaN if the transition does not exist.*/
+  double hysteresis; /**< Margin by which the metric has to cross the threshold.*/
+  double min_dwell; /**< Minimum time spent in the layer before leaving it through this transition [s].*/
+
+  UwTransition() : threshold(nan("")), hysteresis(0), min_dwell(0) { }
+};
+
+typedef std::map <int, UwTransition> ThresMap; /**< Transitions map <layer_id, transition>*/
+typedef std::map <int, ThresMap> ThresMatrix; /**< Transitions matrix, by layer id*/
 
 /**
  * Class used to represents the UwMultiStackController layer of a node.
@@ -118,9 +130,9 @@ public:
    *
    * @return the order of the id
    */
-  int inline getOrder(int layer_id) { return id2order.find(layer_id)==id2order.end() ? 
+  int inline getOrder(int layer_id) { return (layer_id < 0 || layer_id >= (int) id2order.size()) ?
                                               UwMultiStackController::layer_not_exist :
-                                              id2order.find(layer_id)->second; }
+                                              id2order[layer_id]; }
   
   /** 
    * return the id of the controlled layer given its order in the controller logic
@@ -129,9 +141,9 @@ public:
    *
    * @return the layer id
    */
-  int inline getId(int layer_order) { return order2id.find(layer_order)==order2id.end() ? 
+  int inline getId(int layer_order) { return (layer_order < 0 || layer_order >= (int) order2id.size()) ?
                                               UwMultiStackController::layer_not_exist :
-                                              order2id.find(layer_order)->second; }
+                                              order2id[layer_order]; }
 protected:
   // Variables
   /**< Switch modes >*/
@@ -145,9 +157,11 @@ protected:
   double min_delay_; 
   Mode switch_mode_; /** <Current switch mode (either AUTOMATIC or MANUAL).*/
   int lower_id_active_; /**< Id of the current lower layer active. It is used only in MANUAL MODE.*/
-  std::map<int, int> id2order; /**< Maps each layer id to its order in the threshold matrix. (layer_id, order).*/
-  ThresMatrix threshold_map; /**< Returns the switch layer theshold given a layer order.*/
-  std::map<int, int> order2id; /**< Return the layer order given its order in the threshold matrix. (layer_order, layer_id).*/
+  std::vector<int> id2order; /**< Order of each layer in the threshold matrix, indexed by layer id.*/
+  ThresMatrix threshold_map; /**< Transitions set from tcl, by layer id. Compiled in thres_matrix_.*/
+  std::vector<int> order2id; /**< Layer id of each order in the threshold matrix, indexed by order.*/
+  std::vector<UwTransition> thres_matrix_; /**< Dense transitions matrix, the transition from order i to order j is at i * order2id.size() + j.*/
+  double last_switch_time_; /**< Time of the last change of the active layer [s].*/
   int signaling_pktSize_; /** By default the signaling is not employed, if it is needed, here where to set the signaling packet size*/
   /** 
    * Handle a packet coming from upper layers
@@ -215,7 +229,68 @@ protected:
    * @param j id of the layer j
    * @param thres_ij threshold to pass from i to j
    */
-  void inline setThreshold(int i, int j, double thres_ij) { threshold_map[i][j] = thres_ij; }
+  void inline setThreshold(int i, int j, double thres_ij) { threshold_map[i][j].threshold = thres_ij;
+                                                            compileThresholds(); }
+
+  /** 
+   * set the hysteresis of the transition from layer i to layer j: the metric has to cross
+   * the threshold by this margin to switch
+   * 
+   * @param i id of the layer i
+   * @param j id of the layer j
+   * @param hyst_ij hysteresis margin, in the unit of the metric
+   */
+  void inline setHysteresis(int i, int j, double hyst_ij) { threshold_map[i][j].hysteresis = hyst_ij;
+                                                            compileThresholds(); }
+
+  /** 
+   * set the minimum time to be spent in layer i before switching to layer j
+   * 
+   * @param i id of the layer i
+   * @param j id of the layer j
+   * @param dwell_ij minimum dwell time [s]
+   */
+  void inline setMinDwell(int i, int j, double dwell_ij) { threshold_map[i][j].min_dwell = dwell_ij;
+                                                           compileThresholds(); }
+
+  /** 
+   * rebuild thres_matrix_ from threshold_map and the orders of the layers
+   */
+  virtual void compileThresholds();
+
+  /** 
+   * return the transition from layer i to layer j in O(1)
+   * 
+   * @param i id of the layer i
+   * @param j id of the layer j
+   *
+   * @return pointer to the transition, NULL if one of the layers does not exist
+   */
+  inline const UwTransition* getTransition(int i, int j) { int oi = getOrder(i); int oj = getOrder(j);
+                                                           return (oi == UwMultiStackController::layer_not_exist ||
+                                                                   oj == UwMultiStackController::layer_not_exist) ? NULL :
+                                                                  &thres_matrix_[oi * order2id.size() + oj]; }
+
+  /** 
+   * check whether the active layer can switch from layer i to layer j: the transition
+   * has to exist, the metric has to cross its threshold by the hysteresis margin, and
+   * the minimum dwell time has to be elapsed since the last switch
+   * 
+   * @param i id of the current layer
+   * @param j id of the candidate layer
+   * @param metric current value of the metric
+   * @param rising true if the metric has to be above the threshold, false if below
+   *
+   * @return true if the switch is allowed
+   */
+  virtual bool isSwitchAllowed(int i, int j, double metric, bool rising);
+
+  /** 
+   * set the active layer, keeping track of the time of the switch
+   * 
+   * @param id id of the new active layer
+   */
+  virtual void switchLayer(int id);
 
 private:
   //Variables
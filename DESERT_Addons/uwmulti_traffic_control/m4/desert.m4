@@ -48,6 +48,7 @@ AC_DEFUN([AC_ARG_WITH_DESERT],[
                 fi
 
                 for dir in         \
+                    utilities/uwperfstats \
                     application/uwcbr \
                     network/uwip \
                     transport/uwudp \
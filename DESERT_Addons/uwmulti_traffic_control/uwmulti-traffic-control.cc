@@ -225,7 +225,7 @@ void UwMultiTrafficControl::insertInBuffer(Packet *p, int traffic)
     }    
   }
   else {
-    std::queue<Packet*> *q = new std::queue<Packet*>;
+    Buffer *q = new Buffer;
     q->push(p);
     down_buffer[traffic] = q;
     if(debug_)
@@ -376,4 +376,54 @@ uint UwMultiTrafficControl::getDiscardedPacket(int traffic_id) const
   }	else {
     return it->second.pkts_lost;
   }
-}
\ No newline at end of file
+}
+
+void TrafficBuffer::push(Packet *p)
+{
+  BufferKey key(HDR_UWIP(p)->daddr(), HDR_CMN(p)->next_hop());
+  order_.insert(order_.end(), std::make_pair(seq_, key));
+  sub_queues_[key].push_back(std::make_pair(seq_, p));
+  seq_++;
+}
+
+Packet * TrafficBuffer::front() const
+{
+  if (order_.empty())
+    return NULL;
+  SubQueueMap::const_iterator it = sub_queues_.find(order_.begin()->second);
+  return it->second.front().second;
+}
+
+void TrafficBuffer::pop()
+{
+  if (order_.empty())
+    return;
+  // the oldest packet is at the front of its sub-queue
+  SubQueueMap::iterator it = sub_queues_.find(order_.begin()->second);
+  it->second.pop_front();
+  if (it->second.empty())
+    sub_queues_.erase(it);
+  order_.erase(order_.begin());
+}
+
+void TrafficBuffer::extract(uwip_addr_t addr, std::vector<Packet*> &pkts)
+{
+  std::vector<BufferItem> found;
+  SubQueueMap::iterator it = sub_queues_.begin();
+  while (it != sub_queues_.end()) {
+    const BufferKey &key = it->first;
+    if (key.first == addr || key.second == addr || 
+        key.second == UWIP_BROADCAST) {
+      found.insert(found.end(), it->second.begin(), it->second.end());
+      sub_queues_.erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  // merge the sub-queues back in FIFO order
+  std::sort(found.begin(), found.end());
+  for (size_t i = 0; i < found.size(); i++) {
+    order_.erase(found[i].first);
+    pkts.push_back(found[i].second);
+  }
+}
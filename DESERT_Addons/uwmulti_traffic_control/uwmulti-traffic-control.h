@@ -42,8 +42,10 @@
 #include <packet.h>
 #include <module.h>
 #include <tclcl.h>
+#include <uwip-module.h>
 #include <map>
-#include <queue>
+#include <deque>
+#include <vector>
 #include <iostream>
 #include <string.h>
 #include <cmath>
@@ -90,7 +92,55 @@ typedef std::map <int, int> UpTrafficMap; /**< app_type, module_id>*/
 typedef std::pair <int, int> BehaviorItem; /**< module_id, behavior>*/
 typedef std::map <int, BehaviorItem> BehaviorMap; /**< stack_id, behavior>*/
 typedef std::map <int, BehaviorMap> DownTrafficMap; /**< app_type, BehaviorMap*/
-typedef std::queue<Packet*> Buffer;
+
+/**
+ * FIFO buffer of the packets of a traffic type, split in sub-queues per
+ * (destination, next hop) pair. The packets for a given neighbour can be
+ * extracted without rotating the others, and the FIFO order is preserved.
+ */
+class TrafficBuffer {
+public:
+  TrafficBuffer() : seq_(0), order_(), sub_queues_() { }
+
+  /**
+   * Append a packet to the buffer
+   * @param p pointer to the packet
+   */
+  void push(Packet *p);
+
+  /**
+   * @return the oldest packet in the buffer, NULL if empty
+   */
+  Packet * front() const;
+
+  /**
+   * Remove the oldest packet from the buffer, without freeing it
+   */
+  void pop();
+
+  /**
+   * Remove from the buffer, in FIFO order, all the packets with destination
+   * or next hop equal to <i>addr</i>, or with broadcast next hop
+   * @param addr IP address of the neighbour
+   * @param pkts vector where the removed packets are appended
+   */
+  void extract(uwip_addr_t addr, std::vector<Packet*> &pkts);
+
+  size_t size() const { return order_.size(); }
+
+  bool empty() const { return order_.empty(); }
+
+private:
+  typedef std::pair<int, int> BufferKey; /**< daddr, next_hop */
+  typedef std::pair<unsigned long, Packet*> BufferItem; /**< seq, packet */
+  typedef std::map<BufferKey, std::deque<BufferItem> > SubQueueMap;
+
+  unsigned long seq_; /**< Sequence number of the next packet */
+  std::map<unsigned long, BufferKey> order_; /**< Sub-queue of each packet, in FIFO order */
+  SubQueueMap sub_queues_; /**< FIFO sub-queues per (daddr, next_hop) */
+};
+
+typedef TrafficBuffer Buffer;
 typedef std::map <int, Buffer*> DownTrafficBuffer; /**< app_type, PacketQueue*/
 /**traffic, buffer type*/    
 typedef std::map <int,BufferType> BufferTrafficFeature; 
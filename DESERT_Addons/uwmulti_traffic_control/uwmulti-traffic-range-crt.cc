@@ -174,7 +174,7 @@ void UwMultiTrafficRangeCtr::recv(Packet* p, int idSrc)
   }
 }
 
-void UwMultiTrafficRangeCtr::manageCheckedLayer(int traffic, uint8_t destAdd, bool in_range, int idSrc)
+void UwMultiTrafficRangeCtr::manageCheckedLayer(int traffic, uwip_addr_t destAdd, bool in_range, int idSrc)
 {
   BufferTrafficFeature::iterator it_feat = buffer_feature_map.find(traffic);
   if (it_feat == buffer_feature_map.end()) {
@@ -195,61 +195,24 @@ void UwMultiTrafficRangeCtr::manageCheckedLayer(int traffic, uint8_t destAdd, bo
       return;
     if(status[traffic].status == RANGE_CNF_WAIT){
       if(in_range || status[traffic].robust_id) {
-        Packet *p = NULL;
-        while(true){
-          p = getFromBuffer(traffic);
-          if(p != NULL && (HDR_UWIP(p)->daddr() == destAdd || HDR_CMN(p)->next_hop() == destAdd ||
-                           HDR_CMN(p)->next_hop() == UWIP_BROADCAST)) {
-            to->force_cancel();
-            to->num_expires = 0;
-            status[traffic].status = IDLE;
-            //do {
+        std::vector<Packet*> pkts;
+        DownTrafficBuffer::iterator it_b = down_buffer.find(traffic);
+        if (it_b != down_buffer.end())
+          it_b->second->extract(destAdd, pkts);
+        if (pkts.empty()) {
+          if(debug_)
+            std::cout << NOW << " UwMultiTrafficRangeCtr::manageCheckedLayer nothing to send to " 
+                      << (int)destAdd << std::endl;
+        }
+        else {
+          to->force_cancel();
+          to->num_expires = 0;
+          status[traffic].status = IDLE;
+          int l_id = in_range ? idSrc : status[traffic].robust_id;
+          for (size_t i = 0; i < pkts.size(); i++) {
             if(debug_)
               std::cout << NOW << " UwMultiTrafficRangeCtr::manageCheckedLayer sending packet" << std::endl;
-            if(in_range) {
-              /*sendDown(status[traffic].module_id,p);*/
-              sendDown(idSrc,p, it_feat->second.getUpdatedDelay(NOW));
-            }
-            else {
-              sendDown(status[traffic].robust_id,p,
-                  it_feat->second.getUpdatedDelay(NOW));
-            }
-            removeFromBuffer(traffic);
-              //p = removeFromBuffer(traffic);
-            //} while (p != NULL && HDR_UWIP(p)->daddr() == destAdd);
-          }
-          else if(p == NULL) {
-            if(debug_)
-              std::cout << NOW << " UwMultiTrafficRangeCtr::manageCheckedLayer nothing to send to no one" 
-                        << std::endl;
-            break;
-          }
-          else{ //NEVER APPENS IF THERE ARE ONLY 2 NODES
-            Packet *p0 = p;
-            do {
-              removeFromBuffer(traffic);
-              insertInBuffer(p,traffic);
-              p = getFromBuffer(traffic);
-            } while (p != NULL && p != p0 && (HDR_UWIP(p)->daddr() != destAdd || 
-                     HDR_CMN(p)->next_hop() == destAdd || HDR_CMN(p)->next_hop() == UWIP_BROADCAST));
-            if(!(HDR_UWIP(p)->daddr() == destAdd || HDR_CMN(p)->next_hop() == destAdd || 
-                 HDR_CMN(p)->next_hop() == UWIP_BROADCAST)) {
-              if(debug_)
-                std::cout << NOW << " UwMultiTrafficRangeCtr::manageCheckedLayer wrong daddr " 
-                          << (int)HDR_UWIP(p)->daddr() << ", " << (int)destAdd << std::endl;
-              break; 
-            }
-            else {
-              if(in_range) {
-                /*sendDown(status[traffic].module_id,p);*/ 
-                sendDown(idSrc,p,it_feat->second.getUpdatedDelay(NOW)); 
-              }
-              else {
-                sendDown(status[traffic].robust_id,p,
-                    it_feat->second.getUpdatedDelay(NOW));
-              }
-              removeFromBuffer(traffic);
-            }
+            sendDown(l_id, pkts[i], it_feat->second.getUpdatedDelay(NOW));
           }
         }
       }
@@ -338,7 +301,7 @@ int UwMultiTrafficRangeCtr::getBestLowerLayer(int traffic, Packet *p)
   return 0;
 }
 
-void UwMultiTrafficRangeCtr::checkRange(int traffic, int module_id, uint8_t destAdd) 
+void UwMultiTrafficRangeCtr::checkRange(int traffic, int module_id, uwip_addr_t destAdd) 
 {
   StatusMap::iterator it_s = status.find(traffic);
   if (it_s == status.end()) {
@@ -175,15 +175,18 @@ protected:
    * 
    * @param traffic application traffic id
    */
-  virtual void checkRange(int traffic, int module_id, uint8_t destAdd = UWIP_BROADCAST);
+  virtual void checkRange(int traffic, int module_id, uwip_addr_t destAdd = UWIP_BROADCAST);
 
   /** 
-   * procedure when a CHECKED stack is checked
+   * procedure when a CHECKED stack is checked: if in range, or a robust
+   * layer is available, all the buffered packets for <i>destAdd</i> are sent
    * 
-   * @param module id
+   * @param traffic application traffic id
+   * @param destAdd IP address of the node that answered the probe
    * @param in_range true if the PHY is in range, false otherwise
+   * @param idSrc id of the layer that received the probe ACK
    */
-  virtual void manageCheckedLayer(int module_id, uint8_t destAdd, bool in_range, int idSrc = 0);
+  virtual void manageCheckedLayer(int traffic, uwip_addr_t destAdd, bool in_range, int idSrc = 0);
 
   /** 
    * default status initialization
@@ -90,7 +90,6 @@ UwROVModule::UwROVModule()
 	, ackNotPgbk(0)
 	, drop_old_waypoints(0)
 	, log_flag(0)
-	, out_file_stats(0)
 {
 	UWSMPosition p = UWSMPosition();
 	posit=&p;
@@ -103,6 +102,9 @@ UwROVModule::UwROVModule()
     		<< std::endl;
     	ackTimeout = 10;
     }
+    tracefilename = "my_log_file.csv";
+    tracefile.setPath(tracefilename);
+    setLogColumns("rx_time x y z");
 
 }
 
@@ -117,7 +119,6 @@ UwROVModule::UwROVModule(UWSMPosition* p)
 	, ackNotPgbk(0)
 	, drop_old_waypoints(0)
 	, log_flag(0)
-	, out_file_stats(0)
 {
 	posit = p;
     bind("ackTimeout_", (int*) &ackTimeout);
@@ -129,12 +130,41 @@ UwROVModule::UwROVModule(UWSMPosition* p)
     		<< std::endl;
     	ackTimeout = 10;
     }
+    tracefilename = "my_log_file.csv";
+    tracefile.setPath(tracefilename);
+    setLogColumns("rx_time x y z");
 
 
 }
 
 UwROVModule::~UwROVModule() {}
 
+int UwROVModule::logColumn(const std::string &name) const {
+	if (strcasecmp(name.c_str(), "x") == 0)
+		return UWROV_LOG_X;
+	if (strcasecmp(name.c_str(), "y") == 0)
+		return UWROV_LOG_Y;
+	if (strcasecmp(name.c_str(), "z") == 0)
+		return UWROV_LOG_Z;
+	return UwCbrModule::logColumn(name);
+}
+
+void UwROVModule::logField(int column, const Packet *p) {
+	switch (column) {
+		case UWROV_LOG_X:
+			tracefile.addField(posit->getX());
+			break;
+		case UWROV_LOG_Y:
+			tracefile.addField(posit->getY());
+			break;
+		case UWROV_LOG_Z:
+			tracefile.addField(posit->getZ());
+			break;
+		default:
+			UwCbrModule::logField(column, p);
+	}
+}
+
 void UwROVModule::setPosition(UWSMPosition* p){
 	posit = p;
 }
@@ -257,13 +287,9 @@ void UwROVModule::recv(Packet* p) {
 	ack = last_sn_confirmed+1;
 	priority_ = (char) ackPriority;
 
-	if (log_flag == 1) {
-		out_file_stats.open("my_log_file.csv",std::ios_base::app);
-		out_file_stats << left << "time: " << NOW << ", positions ROV: x = " 
-			<< posit->getX() << ", y = " << posit->getY() 
-			<< ", z = " << posit->getZ() << std::endl;
-		out_file_stats.close();
-	}
+	// UwCbrModule::recv() logs the packet as well if tracefile_enabler_ is set
+	if (log_flag == 1 && !tracefile_enabler_)
+		logPacket(p);
 
 
 	if (debug_) {
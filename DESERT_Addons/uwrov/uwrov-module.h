@@ -186,9 +186,31 @@ protected:
 								lower or equal than last_sn_confirmed.*/
 
 
-	int log_flag; /**< Flag to enable log file writing.*/
+	int log_flag; /**< Flag to enable the log of the ROV position, written
+					through the log of the received packets.*/
 
-	std::ofstream out_file_stats; /**< Output stream for the textual file of debug */
+	/**
+	* Columns of the log added to the UwCbrLogColumn ones: the ROV position.
+	*/
+	enum UWROV_LOG_COLUMN { UWROV_LOG_X = UWCBR_LOG_COLUMNS, UWROV_LOG_Y,
+		UWROV_LOG_Z };
+
+	/**
+	* Returns the index of a column of the log, adding x, y and z, the
+	* position of the ROV, to the UwCbrModule columns.
+	*
+	* @param name Name of the column.
+	* @return Index of the column, -1 if the name is not valid.
+	*/
+	virtual int logColumn(const std::string &name) const;
+
+	/**
+	* Appends a field of a received packet to the current row of the log.
+	*
+	* @param column Index of the column.
+	* @param p Pointer to the packet received.
+	*/
+	virtual void logField(int column, const Packet *p);
 };
 
 #endif // UWROV_MODULE_H
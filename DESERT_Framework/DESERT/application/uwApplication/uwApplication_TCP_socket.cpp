@@ -214,9 +214,9 @@ uwApplicationModule::handleTCPclient(int clnSock)
 						<< "::UWAPPLICATION::READ_PROCESS_UDP::NEW_PACKET_"
 						   "CREATED"
 						<< endl;
-			for (int i = 0; i < recvMsgSize; i++) {
-				hdr_Appl->payload_msg[i] = buffer_msg[i];
-			}
+			memcpy(hdr_DATA_APPLICATION::payload_msg(p, recvMsgSize),
+					buffer_msg,
+					recvMsgSize);
 			hdr_cmn *ch = HDR_CMN(p);
 			ch->size() = recvMsgSize;
 			hdr_Appl->payload_size() = recvMsgSize;
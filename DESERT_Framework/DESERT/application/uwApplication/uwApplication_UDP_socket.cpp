@@ -177,8 +177,10 @@ read_process_UDP(void *arg)
 				std::cout << "[" << obj->getEpoch() << "]::" << NOW
 						  << "::UWAPPLICATION::READ_PROCESS_UDP::PAYLOAD_"
 							 "MESSAGE--> ";
+				char *payload =
+						hdr_DATA_APPLICATION::payload_msg(p, recvMsgSize);
 				for (int i = 0; i < recvMsgSize; i++) {
-					hdr_Appl->payload_msg[i] = buffer_msg[i];
+					payload[i] = buffer_msg[i];
 					cout << buffer_msg[i];
 				}
 			}
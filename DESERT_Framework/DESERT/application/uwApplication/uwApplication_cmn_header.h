@@ -42,6 +42,7 @@
 #include <module.h>
 #include <packet.h>
 #include <pthread.h>
+#include <uwpacketpool.h>
 
 #define MAX_LENGTH_PAYLOAD 4096
 #define HDR_DATA_APPLICATION(p)    \
@@ -62,7 +63,6 @@ typedef struct hdr_DATA_APPLICATION {
 	uint8_t priority_; /**< Priority flag: 1 means high priority, 0 normal
 						  priority. */
 	uint16_t payload_size_; /**< Size (bytes) of the payload */
-	char payload_msg[MAX_LENGTH_PAYLOAD]; /**< Message payload*/
 
 	static int offset_; /**< Required by the PacketHeaderManager. */
 
@@ -116,6 +116,31 @@ typedef struct hdr_DATA_APPLICATION {
 		return payload_size_;
 	}
 
+	/**
+	 * Returns the message payload of a packet, kept in a pooled buffer of
+	 * the packet instead of the header.
+	 *
+	 * @param p pointer to the packet
+	 * @param len number of chars to be read or written; the ones not
+	 *        written yet are zero
+	 * @return pointer to the payload
+	 */
+	inline static char *
+	payload_msg(Packet *p, size_t len)
+	{
+		return UwPacketData::buffer(p, UWPOOL_SLOT_APPLICATION, len);
+	}
+
+	/**
+	 * Discards the message payload of a packet: its chars are zeroed again
+	 * when requested through payload_msg().
+	 */
+	inline static void
+	clear_payload_msg(Packet *p)
+	{
+		UwPacketData::truncate(p, UWPOOL_SLOT_APPLICATION, 0);
+	}
+
 	/**
 	 * Reference to the offset variable
 	 */
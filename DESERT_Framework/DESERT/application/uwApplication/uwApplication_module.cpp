@@ -36,6 +36,7 @@
  *
  */
 
+#include <algorithm>
 #include <sstream>
 #include <time.h>
 #include "uwApplication_cmn_header.h"
@@ -193,6 +194,12 @@ uwApplicationModule::command(int argc, const char *const *argv)
 		} else if (strcasecmp(argv[1], "getthr") == 0) {
 			tcl.resultf("%f", GetTHR());
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "packetpool") == 0) {
+			tcl.result(UwPacketPool::instance().dump());
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "resetpacketpool") == 0) {
+			UwPacketPool::instance().reset();
+			return TCL_OK;
 		} else if (strcasecmp(argv[1], "print_log") == 0) {
 			std::stringstream stat_file;
 			stat_file << "UWAPPLICATION_LOG_NODE_ID_" << node_id << "_EXP_ID_"
@@ -365,11 +372,13 @@ uwApplicationModule::statistics(Packet *p)
 
 	lrtime = Scheduler::instance().clock(); // Update the time in which the last
 											// packet is received.
+	const char *payload =
+			hdr_DATA_APPLICATION::payload_msg(p, uwApph->payload_size());
 	if (debug_ >= 0 && socket_active) {
 		std::cout << "[" << getEpoch() << "]::" << NOW
 				  << "::UWAPPLICATION::PAYLOAD_RECEIVED--> ";
 		for (int i = 0; i < uwApph->payload_size(); i++) {
-			cout << uwApph->payload_msg[i];
+			cout << payload[i];
 		}
 	}
 	if (debug_ >= 0)
@@ -382,8 +391,8 @@ uwApplicationModule::statistics(Packet *p)
 				  << (int) uwApph->payload_size() << endl;
 	if (debug_ >= 1 && !withoutSocket())
 		std::cout << "[" << getEpoch() << "]::" << NOW
-				  << "::UWAPPLICATION::PAYLOAD_RECEIVED_" << uwApph->payload_msg
-				  << endl;
+				  << "::UWAPPLICATION::PAYLOAD_RECEIVED_"
+				  << std::string(payload, uwApph->payload_size()) << endl;
 
 	if (logging)
 		out_log << left << "[" << getEpoch() << "]::" << NOW
@@ -397,12 +406,12 @@ uwApplicationModule::statistics(Packet *p)
 		out_log << left << "::" << NOW
 				<< "::UWAPPLICATION::PAYLOAD_RECEIVED--> ";
 		for (int i = 0; i < uwApph->payload_size(); i++) {
-			out_log << uwApph->payload_msg[i];
+			out_log << payload[i];
 		}
 		out_log << std::endl;
 	}
 	if (clnSockDescr) {
-		write(clnSockDescr, uwApph->payload_msg, (size_t)uwApph->payload_size());
+		write(clnSockDescr, payload, (size_t)uwApph->payload_size());
 	}
 	Packet::free(p);
 } // end statistics method
@@ -458,18 +467,12 @@ uwApplicationModule::init_Packet()
 	}
 	uwApph->priority_ = 0; // Priority of the message
 
-	// Create the payload message
-	if (getpayloadsize() < MAX_LENGTH_PAYLOAD) {
-		for (int i = 0; i < getpayloadsize(); i++) {
-			(*uwApph).payload_msg[i] = rand() % 26 + 'a';
-		}
-		for (int i = getpayloadsize(); i < MAX_LENGTH_PAYLOAD; i++) {
-			(*uwApph).payload_msg[i] = '0';
-		}
-	} else {
-		for (int i = 0; i < MAX_LENGTH_PAYLOAD; i++) {
-			(*uwApph).payload_msg[i] = rand() % 26 + 'a';
-		}
+	// Create the payload message: only the chars actually sent are
+	// generated
+	int msg_size = std::min(getpayloadsize(), MAX_LENGTH_PAYLOAD);
+	char *payload = hdr_DATA_APPLICATION::payload_msg(p, msg_size);
+	for (int i = 0; i < msg_size; i++) {
+		payload[i] = rand() % 26 + 'a';
 	}
 
 	// Show the DATA payload generated
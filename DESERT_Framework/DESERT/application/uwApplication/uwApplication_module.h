@@ -536,7 +536,7 @@ protected:
 							  received <i>1</i> enabled <i>0</i> not enabled*/
 	// int TCP_CMN; /**< Enable or not the use of TCP protocol when is used the
 	// socket communication <i>1</i> use TCP <i>0</i> use UDP*/
-	uint8_t dst_addr; /**< IP destination address. */
+	int dst_addr; /**< IP destination address, int as it is bound to Tcl. */
 
 	// TIMER VARIABLES
 	uwSendTimerAppl
@@ -0,0 +1,171 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwcbr-histogram.cpp
+ * @author DESERT contributors
+ * @version 1.0.0
+ *
+ * \brief Provides the <i>UwHistogram</i> class implementation.
+ *
+ * Provides the <i>UwHistogram</i> class implementation.
+ */
+
+#include "uwcbr-histogram.h"
+
+#include <cmath>
+#include <cstdio>
+
+UwHistogram::UwHistogram(double lowest, int octaves, int sub_bits)
+	: lowest_(lowest > 0 ? lowest : 1e-6)
+	, octaves_(octaves > 0 ? octaves : 1)
+	, sub_bits_(sub_bits >= 0 ? sub_bits : 0)
+	, count_(0)
+	, min_(0)
+	, max_(0)
+	, buckets_()
+{
+}
+
+size_t
+UwHistogram::bucket(double v) const
+{
+	if (!(v >= lowest_))
+		return 0;
+	int exp;
+	double m = frexp(v / lowest_, &exp); // v / lowest_ = m * 2^exp
+	size_t octave = exp - 1;
+	if (octave >= (size_t) octaves_)
+		return nBuckets() - 1;
+	size_t sub = (size_t) ((2 * m - 1) * (1 << sub_bits_));
+	return 1 + (octave << sub_bits_) + sub;
+}
+
+double
+UwHistogram::lowerBound(size_t b) const
+{
+	if (b == 0)
+		return 0;
+	b--;
+	size_t octave = b >> sub_bits_;
+	size_t sub = b & ((1 << sub_bits_) - 1);
+	return ldexp(lowest_ * (1 + (double) sub / (1 << sub_bits_)), octave);
+}
+
+void
+UwHistogram::add(double v)
+{
+	if (count_ == 0 || v < min_)
+		min_ = v;
+	if (count_ == 0 || v > max_)
+		max_ = v;
+	count_++;
+	if (buckets_.empty())
+		buckets_.assign(nBuckets(), 0);
+	buckets_[bucket(v)]++;
+}
+
+bool
+UwHistogram::merge(const UwHistogram &h)
+{
+	if (h.lowest_ != lowest_ || h.octaves_ != octaves_ ||
+			h.sub_bits_ != sub_bits_)
+		return false;
+	if (h.count_ == 0)
+		return true;
+	if (count_ == 0 || h.min_ < min_)
+		min_ = h.min_;
+	if (count_ == 0 || h.max_ > max_)
+		max_ = h.max_;
+	count_ += h.count_;
+	if (buckets_.empty())
+		buckets_.assign(nBuckets(), 0);
+	for (size_t i = 0; i < buckets_.size(); i++)
+		buckets_[i] += h.buckets_[i];
+	return true;
+}
+
+void
+UwHistogram::reset()
+{
+	count_ = 0;
+	min_ = 0;
+	max_ = 0;
+	buckets_.assign(buckets_.size(), 0);
+}
+
+double
+UwHistogram::percentile(double p) const
+{
+	if (count_ == 0)
+		return 0;
+	if (p <= 0)
+		return min_;
+	if (p >= 100)
+		return max_;
+	// rank of the sample, 1 based
+	unsigned long rank = (unsigned long) ceil(p / 100 * count_);
+	unsigned long seen = 0;
+	size_t b = 0;
+	while (b < buckets_.size()) {
+		seen += buckets_[b];
+		if (seen >= rank)
+			break;
+		b++;
+	}
+	double v = (b + 1 < buckets_.size())
+			? (lowerBound(b) + lowerBound(b + 1)) / 2
+			: max_;
+	if (v < min_)
+		return min_;
+	if (v > max_)
+		return max_;
+	return v;
+}
+
+std::string
+UwHistogram::dump() const
+{
+	std::string res;
+	char buf[96];
+	for (size_t b = 0; b < buckets_.size(); b++) {
+		if (buckets_[b] == 0)
+			continue;
+		double high = (b + 1 < buckets_.size()) ? lowerBound(b + 1) : max_;
+		snprintf(buf,
+				sizeof(buf),
+				"%s{%g %g %lu}",
+				res.empty() ? "" : " ",
+				lowerBound(b),
+				high,
+				buckets_[b]);
+		res += buf;
+	}
+	return res;
+}
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwcbr-histogram.h
+ * @author DESERT contributors
+ * @version 1.0.0
+ *
+ * \brief Provides the definition of the class <i>UwHistogram</i>.
+ *
+ * Provides the definition of the class <i>UwHistogram</i>, a fixed memory
+ * histogram of time samples used by <i>UWCBR</i> to compute percentiles.
+ */
+
+#ifndef UWCBR_HISTOGRAM_H
+#define UWCBR_HISTOGRAM_H
+
+#include <string>
+#include <vector>
+
+/**
+ * UwHistogram counts positive samples in logarithmic buckets: each power of
+ * two above the lowest value is split in 2^sub_bits linear buckets, so the
+ * relative error of a percentile is at most 2^-sub_bits. Samples below the
+ * lowest value fall in the first bucket, samples above the range in the last
+ * one. Histograms with the same layout can be merged. The buckets are
+ * allocated at the first sample, so an unused histogram costs no memory.
+ */
+class UwHistogram
+{
+public:
+	/**
+	 * Constructor of UwHistogram class.
+	 *
+	 * @param lowest Upper bound of the first bucket.
+	 * @param octaves Number of powers of two covered above <i>lowest</i>.
+	 * @param sub_bits Base 2 logarithm of the buckets per power of two.
+	 */
+	UwHistogram(double lowest = 1e-6, int octaves = 40, int sub_bits = 4);
+
+	/**
+	 * Adds a sample.
+	 *
+	 * @param v Value of the sample.
+	 */
+	void add(double v);
+
+	/**
+	 * Adds the samples of another histogram.
+	 *
+	 * @param h Histogram to merge, with the same layout.
+	 * @return <i>false</i> if the layouts differ, <i>true</i> otherwise.
+	 */
+	bool merge(const UwHistogram &h);
+
+	/**
+	 * Removes all the samples.
+	 */
+	void reset();
+
+	/**
+	 * Returns the value below which a given percentage of the samples fall,
+	 * approximated by the midpoint of its bucket.
+	 *
+	 * @param p Percentage, in [0, 100].
+	 * @return The percentile, 0 if there are no samples.
+	 */
+	double percentile(double p) const;
+
+	/**
+	 * Returns the non empty buckets as a Tcl list of {low high count}.
+	 *
+	 * @return The list of buckets.
+	 */
+	std::string dump() const;
+
+	inline unsigned long
+	count() const
+	{
+		return count_;
+	}
+
+	inline double
+	min() const
+	{
+		return count_ ? min_ : 0;
+	}
+
+	inline double
+	max() const
+	{
+		return count_ ? max_ : 0;
+	}
+
+protected:
+	/**
+	 * Returns the number of buckets of the layout.
+	 */
+	inline size_t
+	nBuckets() const
+	{
+		return 1 + ((size_t) octaves_ << sub_bits_);
+	}
+
+	/**
+	 * Returns the bucket of a value.
+	 */
+	size_t bucket(double v) const;
+
+	/**
+	 * Returns the lower bound of a bucket.
+	 */
+	double lowerBound(size_t b) const;
+
+	double lowest_; /**< Upper bound of the first bucket. */
+	int octaves_; /**< Powers of two covered above lowest_. */
+	int sub_bits_; /**< Base 2 logarithm of the buckets per power of two. */
+	unsigned long count_; /**< Number of samples. */
+	double min_; /**< Smallest sample. */
+	double max_; /**< Largest sample. */
+	std::vector<unsigned long> buckets_; /**< Samples per bucket, empty until
+											the first sample. */
+};
+
+#endif // UWCBR_HISTOGRAM_H
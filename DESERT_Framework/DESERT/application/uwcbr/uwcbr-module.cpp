@@ -46,6 +46,13 @@
 
 extern packet_t PT_UWCBR;
 
+/**
+ * Names of the columns of the log of the received packets, indexed by
+ * UwCbrLogColumn.
+ */
+static const char *const uwcbr_log_column_names[UWCBR_LOG_COLUMNS] = {
+		"rx_time", "tx_time", "sn", "src", "dst", "size", "ftt"};
+
 int hdr_uwcbr::offset_; /**< Offset used to access in <i>hdr_uwcbr</i> packets
 						   header. */
 
@@ -121,8 +128,14 @@ UwCbrModule::UwCbrModule()
 	, fttsamples(0)
 	, sumbytes(0)
 	, sumdt(0)
+	, histograms_enabler_(0)
+	, rtt_hist()
+	, ftt_hist()
+	, iat_hist()
+	, src_ftt_hist()
 	, esn(0)
 	, tracefile_enabler_(0)
+	, tracefile_flush_interval_(0)
 	, cnt(0)
 { // binding to TCL variables
 	bind("period_", &period_);
@@ -134,6 +147,10 @@ UwCbrModule::UwCbrModule()
 	bind("drop_out_of_order_", &drop_out_of_order_);
 	bind("traffic_type_", (uint *) &traffic_type_);
 	bind("tracefile_enabler_", (int *) &tracefile_enabler_);
+	bind("tracefile_flush_interval_", &tracefile_flush_interval_);
+	bind("histograms_enabler_", (int *) &histograms_enabler_);
+	for (int i = UWCBR_LOG_RX_TIME; i <= UWCBR_LOG_SIZE; i++)
+		log_columns_.push_back(i);
 	sn_check = new bool[USHRT_MAX];
 	for (int i = 0; i < USHRT_MAX; i++) {
 		sn_check[i] = false;
@@ -218,29 +235,152 @@ UwCbrModule::command(int argc, const char *const *argv)
 			string tmp_ = (char *) argv[2];
 			log_suffix = std::string(tmp_);
 			tracefilename = "tracefile" + log_suffix + ".txt";
-			if (tracefile_enabler_) {
-				tracefile.open(tracefilename , std::ios::out | std::ios::app);
+			tracefile.setPath(tracefilename);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "setLogFile") == 0) {
+			tracefilename = argv[2];
+			tracefile.setPath(tracefilename);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "setLogColumns") == 0) {
+			if (!setLogColumns(argv[2])) {
+				fprintf(stderr,
+						"CbrModule::command() invalid log columns %s\n",
+						argv[2]);
+				return TCL_ERROR;
+			}
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "gethistogram") == 0) {
+			UwHistogram *h = getHistogram(argv[2]);
+			if (h == NULL) {
+				fprintf(stderr,
+						"CbrModule::command() invalid histogram %s\n",
+						argv[2]);
+				return TCL_ERROR;
 			}
-		return TCL_OK;	
+			histogram_dump_ = h->dump();
+			tcl.result(histogram_dump_.c_str());
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "getsrchistogram") == 0) {
+			const UwHistogram *h = getSrcHistogram(atoi(argv[2]));
+			histogram_dump_ = h ? h->dump() : "";
+			tcl.result(histogram_dump_.c_str());
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "mergehistograms") == 0) {
+			UwCbrModule *m = dynamic_cast<UwCbrModule *>(tcl.lookup(argv[2]));
+			if (m == NULL) {
+				fprintf(stderr,
+						"CbrModule::command() %s is not a UW/CBR module\n",
+						argv[2]);
+				return TCL_ERROR;
+			}
+			mergeHistograms(*m);
+			return TCL_OK;
 		}
 	} else if (argc == 4) {
+		if (strcasecmp(argv[1], "getpercentile") == 0) {
+			UwHistogram *h = getHistogram(argv[2]);
+			if (h == NULL) {
+				fprintf(stderr,
+						"CbrModule::command() invalid histogram %s\n",
+						argv[2]);
+				return TCL_ERROR;
+			}
+			tcl.resultf("%f", h->percentile(atof(argv[3])));
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "getsrcpercentile") == 0) {
+			const UwHistogram *h = getSrcHistogram(atoi(argv[2]));
+			tcl.resultf("%f", h ? h->percentile(atof(argv[3])) : 0.0);
+			return TCL_OK;
+		}
 		if (strcasecmp(argv[1], "setLogSuffix") == 0){
 			string tmp_ = (char *) argv[2];
 			int precision = std::atoi(argv[3]);
 			log_suffix = std::string(tmp_);
 			tracefilename = "tracefile" + log_suffix + ".txt";
-			if (tracefile_enabler_) {
-				tracefile.open(tracefilename , std::ios::out | std::ios::app);
-				tracefile.precision(precision);
-			}
-
-		return TCL_OK;	
+			tracefile.setPath(tracefilename);
+			tracefile.setPrecision(precision);
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "setLogFile") == 0) {
+			tracefilename = argv[2];
+			tracefile.setPath(tracefilename);
+			tracefile.setPrecision(std::atoi(argv[3]));
+			return TCL_OK;
 		}
 	}
 	
 	return Module::command(argc, argv);
 }
 
+bool
+UwCbrModule::setLogColumns(const char *columns)
+{
+	std::istringstream names(columns);
+	std::string name;
+	std::string header("#");
+	std::vector<int> log_columns;
+	while (names >> name) {
+		int i = logColumn(name);
+		if (i < 0)
+			return false;
+		log_columns.push_back(i);
+		header += " ";
+		header += name;
+	}
+	if (log_columns.empty())
+		return false;
+	log_columns_ = log_columns;
+	tracefile.setHeader(header);
+	return true;
+}
+
+int
+UwCbrModule::logColumn(const std::string &name) const
+{
+	for (int i = 0; i < UWCBR_LOG_COLUMNS; i++) {
+		if (strcasecmp(name.c_str(), uwcbr_log_column_names[i]) == 0)
+			return i;
+	}
+	return -1;
+}
+
+void
+UwCbrModule::logField(int column, const Packet *p)
+{
+	hdr_cmn *ch = hdr_cmn::access(p);
+	switch (column) {
+		case UWCBR_LOG_RX_TIME:
+			tracefile.addField(NOW);
+			break;
+		case UWCBR_LOG_TX_TIME:
+			tracefile.addField(ch->timestamp());
+			break;
+		case UWCBR_LOG_SN:
+			tracefile.addField((long) HDR_UWCBR(p)->sn());
+			break;
+		case UWCBR_LOG_SRC:
+			tracefile.addField((long) hdr_uwip::access(p)->saddr());
+			break;
+		case UWCBR_LOG_DST:
+			tracefile.addField((long) hdr_uwip::access(p)->daddr());
+			break;
+		case UWCBR_LOG_SIZE:
+			tracefile.addField((long) ch->size());
+			break;
+		case UWCBR_LOG_FTT:
+			tracefile.addField(rftt);
+			break;
+	}
+}
+
+void
+UwCbrModule::logPacket(const Packet *p)
+{
+	for (size_t i = 0; i < log_columns_.size(); i++)
+		logField(log_columns_[i], p);
+	tracefile.setFlushInterval(tracefile_flush_interval_);
+	tracefile.endRow(NOW);
+}
+
 int
 UwCbrModule::crLayCommand(ClMessage *m)
 {
@@ -358,7 +498,6 @@ void
 UwCbrModule::recv(Packet *p)
 {
 	hdr_cmn *ch = hdr_cmn::access(p);
-	hdr_uwip *uwiph = hdr_uwip::access(p);
 
 	if (debug_ > 10)
 		printf("CbrModule(%d)::recv(Packet*p,Handler*) pktId %d\n",
@@ -408,13 +547,12 @@ UwCbrModule::recv(Packet *p)
 		updateRTT(rtt);
 	}
 
-	if (tracefile_enabler_) {
-		tracefile << NOW << " " << ch->timestamp() << " " << uwcbrh->sn() << " " 
-				<< (int) uwiph->saddr() << " " << (int) uwiph->daddr() << " " << ch->size() <<"\n";
-		tracefile.flush();
-	}
+	if (tracefile_enabler_)
+		logPacket(p);
 
 	updateFTT(rftt);
+	if (histograms_enabler_)
+		src_ftt_hist[hdr_uwip::access(p)->saddr()].add(rftt);
 
 	/* a new packet has been received */
 	incrPktRecv();
@@ -428,6 +566,8 @@ UwCbrModule::recv(Packet *p)
 
 	double dt = Scheduler::instance().clock() - lrtime;
 	updateThroughput(ch->size(), dt);
+	if (histograms_enabler_ && lrtime > 0)
+		iat_hist.add(dt);
 
 	lrtime = Scheduler::instance().clock();
 
@@ -512,6 +652,8 @@ UwCbrModule::updateRTT(const double &rtt)
 	sumrtt += rtt;
 	sumrtt2 += rtt * rtt;
 	rttsamples++;
+	if (histograms_enabler_)
+		rtt_hist.add(rtt);
 }
 
 void
@@ -520,6 +662,8 @@ UwCbrModule::updateFTT(const double &ftt)
 	sumftt += ftt;
 	sumftt2 += ftt * ftt;
 	fttsamples++;
+	if (histograms_enabler_)
+		ftt_hist.add(ftt);
 }
 
 void
@@ -576,6 +720,45 @@ UwCbrModule::resetStats()
 	fttsamples = 0;
 	sumbytes = 0;
 	sumdt = 0;
+	rtt_hist.reset();
+	ftt_hist.reset();
+	iat_hist.reset();
+	src_ftt_hist.clear();
+}
+
+UwHistogram *
+UwCbrModule::getHistogram(const char *name)
+{
+	if (strcasecmp(name, "rtt") == 0)
+		return &rtt_hist;
+	if (strcasecmp(name, "ftt") == 0)
+		return &ftt_hist;
+	if (strcasecmp(name, "iat") == 0)
+		return &iat_hist;
+	return NULL;
+}
+
+const UwHistogram *
+UwCbrModule::getSrcHistogram(nsaddr_t src) const
+{
+	std::map<nsaddr_t, UwHistogram>::const_iterator it =
+			src_ftt_hist.find(src);
+	return (it != src_ftt_hist.end()) ? &(it->second) : NULL;
+}
+
+void
+UwCbrModule::mergeHistograms(const UwCbrModule &m)
+{
+	if (&m == this)
+		return;
+	rtt_hist.merge(m.rtt_hist);
+	ftt_hist.merge(m.ftt_hist);
+	iat_hist.merge(m.iat_hist);
+	for (std::map<nsaddr_t, UwHistogram>::const_iterator it =
+					m.src_ftt_hist.begin();
+			it != m.src_ftt_hist.end();
+			++it)
+		src_ftt_hist[it->first].merge(it->second);
 }
 
 double
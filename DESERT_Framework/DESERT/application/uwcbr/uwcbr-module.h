@@ -44,6 +44,9 @@
 #ifndef UWCBR_MODULE_H
 #define UWCBR_MODULE_H
 
+#include "uwcbr-histogram.h"
+#include "uwcbr-stats-sink.h"
+
 #include <uwip-module.h>
 #include <uwudp-module.h>
 
@@ -53,6 +56,8 @@
 #include <string>
 #include <sstream>
 #include <climits>
+#include <map>
+#include <vector>
 
 #define UWCBR_DROP_REASON_UNKNOWN_TYPE \
 	"UKT" /**< Reason for a drop in a <i>UWCBR</i> module. */
@@ -143,6 +148,20 @@ typedef struct hdr_uwcbr {
 
 class UwCbrModule;
 
+/**
+ * Columns of the log of the packets received by a UwCbrModule.
+ */
+enum UwCbrLogColumn {
+	UWCBR_LOG_RX_TIME = 0, /**< Reception time. */
+	UWCBR_LOG_TX_TIME, /**< Generation time. */
+	UWCBR_LOG_SN, /**< Serial number. */
+	UWCBR_LOG_SRC, /**< IP of the source. */
+	UWCBR_LOG_DST, /**< IP of the destination. */
+	UWCBR_LOG_SIZE, /**< Size of the packet. */
+	UWCBR_LOG_FTT, /**< Forward Trip Time. */
+	UWCBR_LOG_COLUMNS /**< Number of columns. */
+};
+
 /**
  * UwSendTimer class is used to handle the scheduling period of <i>UWCBR</i>
  * packets.
@@ -256,6 +275,32 @@ public:
 	 */
 	virtual void resetStats();
 
+	/**
+	 * Returns a histogram of the module.
+	 *
+	 * @param name "rtt", "ftt" or "iat" (inter-arrival time).
+	 * @return Pointer to the histogram, NULL if the name is not valid.
+	 */
+	virtual UwHistogram *getHistogram(const char *name);
+
+	/**
+	 * Returns the FTT histogram of the packets received from a source.
+	 *
+	 * @param src IP of the source.
+	 * @return Pointer to the histogram, NULL if no packet was received from
+	 * <i>src</i>.
+	 */
+	virtual const UwHistogram *getSrcHistogram(nsaddr_t src) const;
+
+	/**
+	 * Adds the samples of the histograms of another module to the ones of
+	 * this module, e.g., to compute network wide percentiles at the end of a
+	 * simulation.
+	 *
+	 * @param m Module to merge.
+	 */
+	virtual void mergeHistograms(const UwCbrModule &m);
+
 	/**
 	 * Prints the IDs of the packet's headers defined by UWCBR.
 	 */
@@ -272,8 +317,12 @@ protected:
 	std::string log_suffix; /**< Possibility to insert a log suffix */
 	nsaddr_t dstAddr_; /**< IP of the destination. */
 	char priority_; /**< Priority of the data packets. */
-	std::ofstream tracefile;
-	std::string tracefilename;
+	UwStatsSink tracefile; /**< Buffered log of the received packets. */
+	std::string tracefilename; /**< Path of the log of the received packets. */
+	std::vector<int> log_columns_; /**< Columns of the log, from
+									  UwCbrLogColumn. */
+	std::string histogram_dump_; /**< Buffer returned to Tcl by the
+									histogram commands. */
 
 	bool *sn_check; /**< Used to keep track of the packets already received. */
 
@@ -322,9 +371,51 @@ protected:
 	double sumbytes; /**< Sum of bytes received. */
 	double sumdt; /**< Sum of the delays. */
 
+	int histograms_enabler_; /**< True if the histograms are updated. */
+	UwHistogram rtt_hist; /**< Histogram of the RTT samples. */
+	UwHistogram ftt_hist; /**< Histogram of the FTT samples. */
+	UwHistogram iat_hist; /**< Histogram of the inter-arrival times. */
+	std::map<nsaddr_t, UwHistogram>
+			src_ftt_hist; /**< Histograms of the FTT samples, per source. */
+
 	uint32_t esn; /**< Expected serial number. */
 
 	int tracefile_enabler_; /**< True if enable tracefile of received packets, default disabled. */
+	double tracefile_flush_interval_; /**< Simulation time between two writes
+										 of the log of the received packets,
+										 <= 0 to write every packet. */
+
+	/**
+	 * Sets the columns of the log of the received packets.
+	 *
+	 * @param columns Space separated list of column names.
+	 * @return <i>true</i> if all the names are valid, <i>false</i> otherwise.
+	 */
+	virtual bool setLogColumns(const char *columns);
+
+	/**
+	 * Returns the index of a column of the log of the received packets.
+	 * Derived modules add their columns from UWCBR_LOG_COLUMNS on.
+	 *
+	 * @param name Name of the column.
+	 * @return Index of the column, -1 if the name is not valid.
+	 */
+	virtual int logColumn(const std::string &name) const;
+
+	/**
+	 * Appends a field of a received packet to the current row of the log.
+	 *
+	 * @param column Index of the column, as returned by logColumn().
+	 * @param p Pointer to the packet received.
+	 */
+	virtual void logField(int column, const Packet *p);
+
+	/**
+	 * Appends a received packet to the log.
+	 *
+	 * @param p Pointer to the packet received.
+	 */
+	virtual void logPacket(const Packet *p);
 
 	/**
 	 * Initializes a data packet passed as argument with the default values.
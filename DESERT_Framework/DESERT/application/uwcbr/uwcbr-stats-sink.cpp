@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwcbr-stats-sink.cpp
+ * @author DESERT contributors
+ * @version 1.0.0
+ *
+ * \brief Provides the <i>UwStatsSink</i> class implementation.
+ *
+ * Provides the <i>UwStatsSink</i> class implementation.
+ */
+
+#include "uwcbr-stats-sink.h"
+
+#include <cstdlib>
+
+std::set<UwStatsSink *> UwStatsSink::sinks_;
+bool UwStatsSink::atexit_registered_ = false;
+
+UwStatsSink::UwStatsSink()
+	: file_(NULL)
+	, path_("")
+	, header_("")
+	, buffer_("")
+	, precision_(6)
+	, fields_(0)
+	, open_failed_(false)
+	, flush_interval_(0)
+	, last_flush_(0)
+{
+	if (!atexit_registered_) {
+		atexit(&UwStatsSink::flushAll);
+		atexit_registered_ = true;
+	}
+	sinks_.insert(this);
+}
+
+UwStatsSink::~UwStatsSink()
+{
+	close();
+	sinks_.erase(this);
+}
+
+void
+UwStatsSink::setPath(const std::string &path)
+{
+	close();
+	path_ = path;
+	open_failed_ = false;
+}
+
+void
+UwStatsSink::setHeader(const std::string &header)
+{
+	header_ = header;
+}
+
+bool
+UwStatsSink::open()
+{
+	if (file_ != NULL)
+		return true;
+	if (open_failed_ || path_.empty())
+		return false;
+	file_ = fopen(path_.c_str(), "a");
+	if (file_ == NULL) {
+		fprintf(stderr,
+				"UwStatsSink::open() cannot open the file %s\n",
+				path_.c_str());
+		open_failed_ = true;
+		return false;
+	}
+	if (!header_.empty() && ftell(file_) == 0)
+		fprintf(file_, "%s\n", header_.c_str());
+	return true;
+}
+
+void
+UwStatsSink::addField(double v)
+{
+	char field[64];
+	snprintf(field,
+			sizeof(field),
+			"%s%.*g",
+			fields_++ ? " " : "",
+			precision_,
+			v);
+	buffer_ += field;
+}
+
+void
+UwStatsSink::addField(long v)
+{
+	char field[32];
+	snprintf(field, sizeof(field), "%s%ld", fields_++ ? " " : "", v);
+	buffer_ += field;
+}
+
+void
+UwStatsSink::endRow(double now)
+{
+	buffer_ += '\n';
+	fields_ = 0;
+	if (buffer_.size() >= MAX_BUFFER_SIZE ||
+			now - last_flush_ >= flush_interval_) {
+		flush();
+		last_flush_ = now;
+	}
+}
+
+void
+UwStatsSink::flush()
+{
+	if (buffer_.empty())
+		return;
+	if (!open()) { // No file to write to: discard the rows
+		buffer_.clear();
+		return;
+	}
+	fwrite(buffer_.data(), 1, buffer_.size(), file_);
+	fflush(file_);
+	buffer_.clear();
+}
+
+void
+UwStatsSink::close()
+{
+	flush();
+	if (file_ != NULL) {
+		fclose(file_);
+		file_ = NULL;
+	}
+}
+
+void
+UwStatsSink::flushAll()
+{
+	for (std::set<UwStatsSink *>::iterator it = sinks_.begin();
+			it != sinks_.end();
+			++it)
+		(*it)->flush();
+}
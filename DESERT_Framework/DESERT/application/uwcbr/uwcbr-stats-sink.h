@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwcbr-stats-sink.h
+ * @author DESERT contributors
+ * @version 1.0.0
+ *
+ * \brief Provides the definition of the class <i>UwStatsSink</i>.
+ *
+ * Provides the definition of the class <i>UwStatsSink</i>, a buffered log file
+ * of statistics rows used by <i>UWCBR</i> and the modules derived from it.
+ */
+
+#ifndef UWCBR_STATS_SINK_H
+#define UWCBR_STATS_SINK_H
+
+#include <cstdio>
+#include <set>
+#include <string>
+
+/**
+ * UwStatsSink writes rows of space separated fields to a log file. The file
+ * is opened once, at the first row, and the rows are kept in memory until the
+ * flush interval (in simulation time) expires, the buffer is full, the sink
+ * is closed or the program exits.
+ */
+class UwStatsSink
+{
+public:
+	/**
+	 * Constructor of UwStatsSink class.
+	 */
+	UwStatsSink();
+
+	/**
+	 * Destructor of UwStatsSink class. Flushes and closes the file.
+	 */
+	~UwStatsSink();
+
+	/**
+	 * Sets the path of the log file, closing the previous one if any. The new
+	 * file is opened in append mode.
+	 *
+	 * @param path Path of the log file.
+	 */
+	void setPath(const std::string &path);
+
+	/**
+	 * Sets a header line written when a new, empty file is opened.
+	 *
+	 * @param header Header line, without the trailing newline.
+	 */
+	void setHeader(const std::string &header);
+
+	/**
+	 * Sets the number of significant digits of the floating point fields.
+	 *
+	 * @param precision Number of significant digits.
+	 */
+	inline void
+	setPrecision(int precision)
+	{
+		precision_ = precision;
+	}
+
+	/**
+	 * Sets the flush interval.
+	 *
+	 * @param interval Simulation time between two flushes, if <= 0 every row
+	 * is flushed.
+	 */
+	inline void
+	setFlushInterval(double interval)
+	{
+		flush_interval_ = interval;
+	}
+
+	/**
+	 * Appends a floating point field to the current row.
+	 *
+	 * @param v Value of the field.
+	 */
+	void addField(double v);
+
+	/**
+	 * Appends an integer field to the current row.
+	 *
+	 * @param v Value of the field.
+	 */
+	void addField(long v);
+
+	/**
+	 * Terminates the current row, flushing the buffer if needed.
+	 *
+	 * @param now Current simulation time.
+	 */
+	void endRow(double now);
+
+	/**
+	 * Writes the buffered rows to the file.
+	 */
+	void flush();
+
+	/**
+	 * Flushes the buffered rows and closes the file.
+	 */
+	void close();
+
+protected:
+	/**
+	 * Opens the log file, writing the header if the file is empty.
+	 *
+	 * @return <i>true</i> if the file is open, <i>false</i> otherwise.
+	 */
+	bool open();
+
+	/**
+	 * Flushes all the sinks, registered with atexit().
+	 */
+	static void flushAll();
+
+	static const size_t MAX_BUFFER_SIZE =
+			65536; /**< Size of the buffer that forces a flush. */
+
+	FILE *file_; /**< Log file, NULL if not open. */
+	std::string path_; /**< Path of the log file. */
+	std::string header_; /**< Header line of a new file. */
+	std::string buffer_; /**< Rows not yet written. */
+	int precision_; /**< Significant digits of floating point fields. */
+	int fields_; /**< Number of fields of the current row. */
+	bool open_failed_; /**< The file could not be opened. */
+	double flush_interval_; /**< Simulation time between two flushes. */
+	double last_flush_; /**< Simulation time of the last flush. */
+
+	static std::set<UwStatsSink *> sinks_; /**< Sinks alive, flushed at exit. */
+	static bool atexit_registered_; /**< flushAll() registered with atexit(). */
+};
+
+#endif // UWCBR_STATS_SINK_H
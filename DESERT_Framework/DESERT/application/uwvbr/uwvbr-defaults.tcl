@@ -42,6 +42,8 @@ Module/UW/VBR set destAddr_           0
 Module/UW/VBR set debug_              0
 Module/UW/VBR set PoissonTraffic_     1
 Module/UW/VBR set drop_out_of_order_  1
+Module/UW/VBR set traceLoop_          0
+Module/UW/VBR set traceRandomOffset_  0
 
 Module/UW/VBR instproc init {args} {
     $self next $args
@@ -40,6 +40,7 @@
 #include "uwvbr-module.h"
 
 #include <iostream>
+#include <fstream>
 #include <rng.h>
 
 extern packet_t PT_UWVBR;
@@ -79,6 +80,64 @@ public:
 	}
 } class_module_uwvbr;
 
+std::map<std::string, UwVbrTrace *> UwVbrTrace::traces_;
+
+const UwVbrTrace *
+UwVbrTrace::load(const std::string &filename)
+{
+	std::map<std::string, UwVbrTrace *>::iterator it = traces_.find(filename);
+	if (it != traces_.end())
+		return it->second;
+
+	std::ifstream input(filename.c_str());
+	if (!input.is_open()) {
+		fprintf(stderr,
+				"UwVbrTrace::load() cannot open the file %s\n",
+				filename.c_str());
+		return NULL;
+	}
+	UwVbrTrace *trace = new UwVbrTrace();
+	std::string line;
+	int line_number = 0;
+	while (std::getline(input, line)) {
+		line_number++;
+		for (size_t i = 0; i < line.size(); i++) {
+			if (line[i] == ',')
+				line[i] = ' ';
+		}
+		std::istringstream fields(line);
+		Frame f;
+		if (!(fields >> f.time)) // Empty line
+			continue;
+		if (!(fields >> f.size) || f.size < 0 ||
+				(trace->size() > 0 &&
+						f.time < trace->frames_.back().time)) {
+			fprintf(stderr,
+					"UwVbrTrace::load() invalid frame at line %d of %s\n",
+					line_number,
+					filename.c_str());
+			delete trace;
+			return NULL;
+		}
+		trace->frames_.push_back(f);
+	}
+	if (trace->size() == 0) {
+		fprintf(stderr, "UwVbrTrace::load() no frames in %s\n",
+				filename.c_str());
+		delete trace;
+		return NULL;
+	}
+
+	double first = trace->frames_.front().time;
+	for (int i = 0; i < trace->size(); i++)
+		trace->frames_[i].time -= first;
+	trace->wrap_gap_ = (trace->size() > 1)
+			? trace->frames_.back().time / (trace->size() - 1)
+			: 0;
+	traces_[filename] = trace;
+	return trace;
+}
+
 void
 UwVbrSendTimer::expire(Event *e)
 {
@@ -117,6 +176,10 @@ UwVbrModule::UwVbrModule()
 	, sendTmr_(this)
 	, period_switcher_(this)
 	, pktSize_(0)
+	, trace_(NULL)
+	, trace_idx_(0)
+	, traceLoop_(0)
+	, traceRandomOffset_(0)
 	, sumrtt(0)
 	, sumrtt2(0)
 	, rttsamples(0)
@@ -137,6 +200,8 @@ UwVbrModule::UwVbrModule()
 	bind("PoissonTraffic_", &PoissonTraffic_);
 	bind("debug_", &debug_);
 	bind("drop_out_of_order_", &drop_out_of_order_);
+	bind("traceLoop_", &traceLoop_);
+	bind("traceRandomOffset_", &traceRandomOffset_);
 	sn_check = new bool[USHRT_MAX];
 	for (int i = 0; i < USHRT_MAX; i++) {
 		sn_check[i] = false;
@@ -204,6 +269,13 @@ UwVbrModule::command(int argc, const char *const *argv)
 					txsn);
 			return TCL_OK;
 		}
+	} else if (argc == 3) {
+		if (strcasecmp(argv[1], "tracefile") == 0) {
+			trace_ = UwVbrTrace::load(argv[2]);
+			if (trace_ == NULL)
+				return TCL_ERROR;
+			return TCL_OK;
+		}
 	}
 	return Module::command(argc, argv);
 }
@@ -246,6 +318,17 @@ UwVbrModule::initPkt(Packet *p)
 void
 UwVbrModule::start()
 {
+	if (trace_ != NULL) {
+		double delay = 0;
+		trace_idx_ = 0;
+		if (traceRandomOffset_) {
+			trace_idx_ = RNG::defaultrng()->uniform(trace_->size());
+			delay = RNG::defaultrng()->uniform_double() *
+					trace_->gap(trace_idx_);
+		}
+		sendTmr_.resched(delay);
+		return;
+	}
 	sendTmr_.resched(getTimeBeforeNextPkt());
 	period_switcher_.resched(timer_switch_1_);
 }
@@ -266,9 +349,41 @@ UwVbrModule::sendPkt()
 	sendDown(p, delay);
 }
 
+void
+UwVbrModule::sendFrame()
+{
+	int remaining = (*trace_)[trace_idx_].size;
+	while (remaining > 0) {
+		int size = (pktSize_ > 0 && remaining > pktSize_) ? pktSize_
+														  : remaining;
+		Packet *p = Packet::alloc();
+		initPkt(p);
+		hdr_cmn *ch = hdr_cmn::access(p);
+		ch->size() = size;
+		remaining -= size;
+		if (debug_ > 10)
+			printf("VbrModule(%d)::sendFrame, send a pkt (%d) with sn: %d, "
+				   "frame %d\n",
+					getId(),
+					ch->uid(),
+					HDR_UWVBR(p)->sn(),
+					trace_idx_);
+		sendDown(p);
+	}
+}
+
 void
 UwVbrModule::transmit()
 {
+	if (trace_ != NULL) {
+		sendFrame();
+		if (trace_idx_ + 1 < trace_->size() || traceLoop_) {
+			// Schedule the next frame of the trace.
+			sendTmr_.resched(trace_->gap(trace_idx_));
+			trace_idx_ = (trace_idx_ + 1) % trace_->size();
+		}
+		return;
+	}
 	sendPkt();
 	// Schedule next transmission.
 	sendTmr_.resched(getTimeBeforeNextPkt());
@@ -52,6 +52,8 @@
 #include <string>
 #include <sstream>
 #include <climits>
+#include <map>
+#include <vector>
 
 #define UWVBR_DROP_REASON_UNKNOWN_TYPE \
 	"UKT" /**< Reason for a drop in a <i>UWVBR</i> module. */
@@ -121,6 +123,85 @@ typedef struct hdr_uwvbr {
 
 class UwVbrModule;
 
+/**
+ * UwVbrTrace holds a trace of frames, loaded once from a file and shared by
+ * all the UwVbrModule objects that replay it. Each line of the file contains
+ * the time of a frame, in seconds, and its size, in bytes, separated by a
+ * comma or by spaces.
+ */
+class UwVbrTrace
+{
+public:
+	/**
+	 * Frame of the trace.
+	 */
+	struct Frame {
+		double time; /**< Time of the frame, relative to the first one. */
+		int size; /**< Size of the frame in bytes. */
+	};
+
+	/**
+	 * Returns the trace of a file, reading it only the first time it is
+	 * requested.
+	 *
+	 * @param filename Name of the trace file.
+	 * @return Pointer to the trace, NULL if the file can not be parsed.
+	 */
+	static const UwVbrTrace *load(const std::string &filename);
+
+	/**
+	 * Returns the number of frames of the trace.
+	 *
+	 * @return Number of frames.
+	 */
+	inline int
+	size() const
+	{
+		return frames_.size();
+	}
+
+	/**
+	 * Returns the i-th frame of the trace.
+	 *
+	 * @param i Index of the frame.
+	 * @return Reference to the frame.
+	 */
+	inline const Frame &
+	operator[](int i) const
+	{
+		return frames_[i];
+	}
+
+	/**
+	 * Returns the time between the i-th frame and the next one. After the last
+	 * frame, the trace restarts after the mean inter-arrival time.
+	 *
+	 * @param i Index of the frame.
+	 * @return Inter-arrival time in seconds.
+	 */
+	inline double
+	gap(int i) const
+	{
+		return (i + 1 < size()) ? frames_[i + 1].time - frames_[i].time
+								: wrap_gap_;
+	}
+
+private:
+	/**
+	 * Constructor of UwVbrTrace class, used by load().
+	 */
+	UwVbrTrace()
+		: wrap_gap_(0)
+	{
+	}
+
+	std::vector<Frame> frames_; /**< Frames of the trace. */
+	double wrap_gap_; /**< Time between the last and the first frame when the
+						 trace is looped. */
+	static std::map<std::string, UwVbrTrace *>
+			traces_; /**< Traces already loaded, by file name. */
+};
+
 /**
  * UwVbrSendTimer class is used to handle the scheduling period of <i>UWVBR</i>
  * packets.
@@ -294,7 +375,15 @@ protected:
 	UwVbrPeriodSwitcher
 			period_switcher_; /**< Timer which schedules the switch between
 								 different sending periods. */
-	int pktSize_; /**< Packet size. */
+	int pktSize_; /**< Packet size. In trace mode, maximum size of a packet:
+					 larger frames are fragmented. */
+
+	const UwVbrTrace *trace_; /**< Trace replayed, NULL if not in trace mode.
+								 */
+	int trace_idx_; /**< Index of the next frame of the trace to send. */
+	int traceLoop_; /**< <i>1</i> if the trace restarts when it ends. */
+	int traceRandomOffset_; /**< <i>1</i> if the replay starts from a random
+							   frame of the trace, after a random delay. */
 
 	/* Cumulative statistics */
 	double sumrtt; /**< Sum of RTT samples. */
@@ -326,7 +415,16 @@ protected:
 	virtual void sendPkt();
 
 	/**
-	 * Creates and transmits a packet and schedules a new transmission.
+	 * Sends the current frame of the trace, fragmented in packets of at most
+	 * pktSize_ bytes.
+	 *
+	 * @see UwVbrModule::initPkt()
+	 */
+	virtual void sendFrame();
+
+	/**
+	 * Creates and transmits a packet, or a frame in trace mode, and schedules
+	 * a new transmission.
 	 *
 	 * @see UwVbrModule::sendPkt()
 	 */
@@ -145,6 +145,8 @@ bool CsmaAloha::initialized = false;
 map<CsmaAloha::CSMA_STATUS, string> CsmaAloha::status_info;
 map<CsmaAloha::CSMA_REASON_STATUS, string> CsmaAloha::reason_info;
 map<CsmaAloha::CSMA_PKT_TYPE, string> CsmaAloha::pkt_type_info;
+const char *const CsmaAloha::perf_probe_names[] = {"recvFromUpperLayers",
+		"Phy2MacStartRx", "Phy2MacEndRx", "Phy2MacEndTx", "transition"};
 
 CsmaAloha::CsmaAloha()
 	: ack_timer(this)
@@ -194,6 +196,7 @@ CsmaAloha::CsmaAloha()
 		has_buffer_queue = true;
 	if (listen_time <= 0.0)
 		listen_time = 1e-19;
+	UWPERF_INIT(perf_stats, CSMA_PERF_NPROBES, perf_probe_names);
 }
 
 CsmaAloha::~CsmaAloha()
@@ -227,6 +230,12 @@ CsmaAloha::command(int argc, const char *const *argv)
 		} else if (strcasecmp(argv[1], "getUpLayersDataRx") == 0) {
 			tcl.resultf("%d", getUpLayersDataPktsRx());
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstats") == 0) {
+			tcl.result(UWPERF_DUMP(perf_stats));
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstatsReset") == 0) {
+			UWPERF_RESET(perf_stats);
+			return TCL_OK;
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "setMacAddr") == 0) {
@@ -399,6 +408,7 @@ CsmaAloha::getBackoffTime()
 void
 CsmaAloha::recvFromUpperLayers(Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, CSMA_PERF_RECV_UPPER);
 	if (((has_buffer_queue == true) && (Q.size() < buffer_pkts)) ||
 			(has_buffer_queue == false)) {
 		initPkt(p, CSMA_DATA_PKT);
@@ -456,6 +466,7 @@ CsmaAloha::Mac2PhyStartTx(Packet *p)
 void
 CsmaAloha::Phy2MacEndTx(const Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, CSMA_PERF_END_TX);
 
 	if (debug_)
 		cout << NOW << "  CsmaAloha(" << addr
@@ -536,6 +547,7 @@ CsmaAloha::Phy2MacEndTx(const Packet *p)
 void
 CsmaAloha::Phy2MacStartRx(const Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, CSMA_PERF_START_RX);
 	if (debug_)
 		cout << NOW << "  CsmaAloha(" << addr
 			 << ")::Phy2MacStartRx() rx Packet " << endl;
@@ -572,6 +584,7 @@ CsmaAloha::Phy2MacStartRx(const Packet *p)
 void
 CsmaAloha::Phy2MacEndRx(Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, CSMA_PERF_END_RX);
 
 	hdr_cmn *ch = HDR_CMN(p);
 	packet_t rx_pkt_type = ch->ptype();
@@ -48,6 +48,7 @@
 #include <fstream>
 
 #include <mphy.h>
+#include "uwperfstats.h"
 
 #define CSMA_DROP_REASON_WRONG_STATE                                         \
 	"WST" /**< The protocol cannot receive this kind of packet in this state \
@@ -587,6 +588,7 @@ protected:
 	virtual void
 	refreshState(CSMA_STATUS state)
 	{
+		UWPERF_COUNT(perf_stats, CSMA_PERF_TRANSITION);
 		prev_prev_state = prev_state;
 		prev_state = curr_state;
 		curr_state = state;
@@ -804,6 +806,21 @@ protected:
 
 	ofstream fout; /**< Object that handles the output file where the protocol
 					  writes the state transistions */
+
+	/**
+	 * Probes of the hot-path instrumentation (see uwperfstats.h).
+	 */
+	enum CSMA_PERF_PROBE {
+		CSMA_PERF_RECV_UPPER = 0,
+		CSMA_PERF_START_RX,
+		CSMA_PERF_END_RX,
+		CSMA_PERF_END_TX,
+		CSMA_PERF_TRANSITION,
+		CSMA_PERF_NPROBES
+	};
+	static const char *const perf_probe_names[CSMA_PERF_NPROBES]; /**< Names
+									of the probes. */
+	UWPERF_MEMBER(perf_stats) /**< Hot-path counters and timers. */
 };
 
 #endif /* CSMA_H */
@@ -51,11 +51,11 @@ extern packet_t PT_CA_ACK;
 
 typedef struct hdr_ca_RTS {
 private:
-	uint8_t tx_time;
+	uint16_t tx_time; /**< Expected DATA transmission time, milliseconds */
 
 public:
 	static int offset_;
-	uint8_t &
+	uint16_t &
 	get_tx_time()
 	{
 		return tx_time;
@@ -79,11 +79,11 @@ public:
 
 typedef struct hdr_ca_CTS {
 private:
-	uint8_t tx_time;
+	uint16_t tx_time; /**< Expected DATA transmission time, milliseconds */
 
 public:
 	static int offset_;
-	uint8_t &
+	uint16_t &
 	get_tx_time()
 	{
 		return tx_time;
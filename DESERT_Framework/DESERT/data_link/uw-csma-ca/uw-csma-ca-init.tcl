@@ -33,8 +33,10 @@ PacketHeaderManager set tab_(PacketHeader/CA_RTS) 1
 PacketHeaderManager set tab_(PacketHeader/CA_CTS) 1
 
 Module/UW/CSMA_CA set queue_size_ 10
-Module/UW/CSMA_CA set backoff_delta_ 1
-Module/UW/CSMA_CA set backoff_max 20
+Module/UW/CSMA_CA set cw_min_ 4
+Module/UW/CSMA_CA set cw_max_ 64
+Module/UW/CSMA_CA set slot_time_ 0.5
+Module/UW/CSMA_CA set nav_guard_ 1
 Module/UW/CSMA_CA set data_size_ 1000
 Module/UW/CSMA_CA set bitrate_ 1800
 Module/UW/CSMA_CA set cts_wait_val_ 10
@@ -42,6 +42,7 @@
 #include <string>
 #include <stdio.h>
 #include <stdlib.h>
+#include <limits.h>
 #include "mac.h"
 #include "mmac.h"
 
@@ -132,7 +133,10 @@ CsmaCa::CsmaCa()
 	, cts_timer(this, CSMA_CA_CTS_TIMER)
 	, data_timer(this, CSMA_CA_DATA_TIMER)
 	, ack_timer(this, CSMA_CA_ACK_TIMER)
-	, backoff_delta(0)
+	, cw_min(4)
+	, cw_max(64)
+	, slot_time(0.5)
+	, nav_guard(1)
 	, ack_mode(CSMA_CA_NO_ACK_MODE)
 	, state(CSMA_CA_IDLE)
 	, previous_state(CSMA_CA_IDLE)
@@ -144,21 +148,32 @@ CsmaCa::CsmaCa()
 	, ack_pkt_dropped(0)
 	, log_level(CSMA_CA_ERROR)
 	, actual_data_packet(0)
+	, cw(4)
+	, nav_end(0)
+	, rng(new RNG())
 	, logfile("/dev/null")
 {
 	bind("queue_size_", (int *) &max_queue_size);
-	bind("backoff_delta_", (int *) &backoff_delta);
-	bind("backoff_max", (int *) &backoff_max);
+	bind("cw_min_", (int *) &cw_min);
+	bind("cw_max_", (int *) &cw_max);
+	bind("slot_time_", (double *) &slot_time);
+	bind("nav_guard_", (double *) &nav_guard);
 	bind("data_size_", (int *) &data_size);
 	bind("bitrate_", (int *) &bitrate);
 	bind("cts_wait_val_", (int *) &cts_wait_val);
 	bind("data_wait_val_", (int *) &data_wait_val);
 	bind("ack_wait_val_", (int *) &ack_wait_val);
 	bind("log_level_", (int *) &log_level);
+	cw = cw_min;
+	// Own stream, seeded from the default RNG so that runs still depend on
+	// the seed chosen in the script
+	rng->set_seed(RNG::RAW_SEED_SOURCE,
+			RNG::defaultrng()->uniform(INT_MAX - 1) + 1);
 }
 
 CsmaCa::~CsmaCa()
 {
+	delete rng;
 }
 
 void
@@ -185,14 +200,22 @@ CsmaCa::ack_timer_fired()
 {
 	if (state != CSMA_CA_WAIT_ACK) {
 		LOGERR("Ack timer fired but not waiting for an ACK\n");
+		state_Idle();
+	} else {
+		increaseCw();
+		state_Backoff();
 	}
-	state_Idle();
 }
 
 void
 CsmaCa::backoff_timer_fired()
 {
 	if (getState() == CSMA_CA_BACKOFF) {
+		if (isNavBusy()) {
+			LOGINFO("NAV extended during backoff");
+			state_Backoff();
+			return;
+		}
 		LOGINFO("Backoff end");
 		state_Idle();
 	} else {
@@ -205,8 +228,8 @@ CsmaCa::cts_timer_fired()
 {
 	if (getState() == CSMA_CA_WAIT_CTS) {
 		LOGINFO("CTS Timer expired");
-		// state_Idle();
-		state_Backoff(1);
+		increaseCw();
+		state_Backoff();
 	} else {
 		LOGERR("CTS timer expired but not waiting for a CTS");
 	}
@@ -234,7 +257,6 @@ CsmaCa::initializeLog()
 	if (!outLog) {
 		cout << "Error creating log for Csma-Ca" << endl;
 	}
-	srand(time(NULL) + 100 * addr);
 }
 
 void
@@ -325,6 +347,7 @@ CsmaCa::stateRxACK(Packet *ack)
 		if (state == CSMA_CA_WAIT_ACK) {
 			LOGINFO("Ack received\n");
 			ack_timer.force_cancel();
+			resetCw();
 			state_Idle();
 			return (0);
 		} else {
@@ -372,6 +395,8 @@ CsmaCa::stateRxData(Packet *p)
 		}
 	} else {
 		LOGWRN("Received a Data Packet not for me");
+		if (ack_mode == CSMA_CA_ACK_MODE)
+			updateNav(nav_guard);
 		return (-2);
 	}
 }
@@ -392,6 +417,12 @@ CsmaCa::stateRxRTS(hdr_ca_RTS *rts, int mac_src, int mac_dst)
 			LOGERR("Actual actual_expected_tx_time is 0");
 			return (ERROR);
 		}
+		if (isNavBusy()) {
+			actual_mac_data_src = 0;
+			actual_expected_tx_time = 0;
+			LOGWRN("Received an RTS while the NAV is set");
+			return (WRONG_STATE);
+		}
 		if (getState() == CSMA_CA_IDLE || getState() == CSMA_CA_BACKOFF) {
 			if (getState() == CSMA_CA_BACKOFF)
 				backoff_timer.force_cancel();
@@ -408,6 +439,7 @@ CsmaCa::stateRxRTS(hdr_ca_RTS *rts, int mac_src, int mac_dst)
 		return (NOT_FOR_US);
 	} else {
 		LOGDBG("Received an RTS not for us");
+		updateNav(rts->get_tx_time() / 1000.0 + 2 * nav_guard);
 		return (NOT_FOR_US);
 	}
 }
@@ -429,7 +461,10 @@ CsmaCa::state_Idle()
 	LOGINFO("State IDLE");
 	updateState(CSMA_CA_IDLE);
 	if (data_q.size() > 0) {
-		extractDataPacket();
+		if (isNavBusy())
+			state_Backoff();
+		else
+			extractDataPacket();
 	}
 }
 
@@ -442,12 +477,14 @@ CsmaCa::stateRxCTS(hdr_ca_CTS *cts, int mac_src, int mac_dst)
 		cts_timer.force_cancel();
 		stateTxData();
 		return (0);
-	} else if (getState() == CSMA_CA_IDLE) {
-		state_Backoff(cts->get_tx_time());
+	}
+	if (mac_dst != addr)
+		updateNav(cts->get_tx_time() / 1000.0 + nav_guard);
+	if (getState() == CSMA_CA_IDLE) {
+		state_Backoff();
 		return (0);
 	} else {
-		LOGERR("Overheared a CTS not for me and not in IDLE. Discarding \
-				and not setting up backoff");
+		LOGINFO("Overheared a CTS not for me and not in IDLE. NAV updated");
 		return (NOT_FOR_ME);
 	}
 }
@@ -460,12 +497,21 @@ CsmaCa::stateTxData()
 }
 
 void
-CsmaCa::state_Backoff(int tx_time)
+CsmaCa::state_Backoff()
 {
 	LOGINFO("State Backoff");
 	updateState(CSMA_CA_BACKOFF);
-	int random = rand() % (int) backoff_max + (int) (tx_time + backoff_delta);
-	backoff_timer.resched(random);
+	double backoff = rng->uniform(cw) * slot_time;
+	if (isNavBusy())
+		backoff += nav_end - NOW;
+	backoff_timer.resched(backoff);
+}
+
+void
+CsmaCa::updateNav(double duration)
+{
+	if (NOW + duration > nav_end)
+		nav_end = NOW + duration;
 }
 
 void
@@ -500,6 +546,7 @@ CsmaCa::Phy2MacEndTx(const Packet *p)
 			state_Wait_ACK();
 		} else {
 			actual_data_packet = 0;
+			resetCw();
 			state_Idle();
 		}
 	}
@@ -612,19 +659,19 @@ CsmaCa::state_Wait_Data()
 }
 
 void
-CsmaCa::buildRTShdr(hdr_ca_RTS **rts, uint8_t tx_time)
+CsmaCa::buildRTShdr(hdr_ca_RTS **rts, uint16_t tx_time)
 {
 	(*rts)->set_tx_time(tx_time);
 }
 
 void
-CsmaCa::buildCTShdr(hdr_ca_CTS **cts, uint8_t tx_time)
+CsmaCa::buildCTShdr(hdr_ca_CTS **cts, uint16_t tx_time)
 {
 	(*cts)->set_tx_time(tx_time);
 }
 
 Packet *
-CsmaCa::buildPacket(int mac_dest, csma_ca_pkt_type_t type, uint8_t tx_time)
+CsmaCa::buildPacket(int mac_dest, csma_ca_pkt_type_t type, uint16_t tx_time)
 {
 	Packet *p;
 	switch (type) {
@@ -633,7 +680,7 @@ CsmaCa::buildPacket(int mac_dest, csma_ca_pkt_type_t type, uint8_t tx_time)
 			hdr_cmn *ch_r = hdr_cmn::access(p);
 			hdr_mac *mac_r = HDR_MAC(p);
 			ch_r->ptype() = PT_CA_RTS;
-			ch_r->size() = sizeof(hdr_ca_RTS); // 8; /* 8 bit for tx_time */
+			ch_r->size() = sizeof(hdr_ca_RTS); /* 16 bit for tx_time */
 			mac_r->set(MF_CONTROL, addr, mac_dest);
 			hdr_ca_RTS *rts = CA_RTS_HDR_ACCESS(p);
 			buildRTShdr(&rts, tx_time);
@@ -643,7 +690,7 @@ CsmaCa::buildPacket(int mac_dest, csma_ca_pkt_type_t type, uint8_t tx_time)
 			hdr_cmn *ch_c = hdr_cmn::access(p);
 			hdr_mac *mac_c = HDR_MAC(p);
 			ch_c->ptype() = PT_CA_CTS;
-			ch_c->size() = sizeof(hdr_ca_CTS); // 8; /* 8 bit for tx_time */
+			ch_c->size() = sizeof(hdr_ca_CTS); /* 16 bit for tx_time */
 			mac_c->set(MF_CONTROL, addr, mac_dest);
 			hdr_ca_CTS *cts = CA_CTS_HDR_ACCESS(p);
 			buildCTShdr(&cts, tx_time);
@@ -40,12 +40,14 @@
 #define CSMA_CA_H
 
 #include <mmac.h>
+#include <rng.h>
 #include <queue>
 #include <sstream>
 #include <fstream>
 #include <unistd.h>
 #include <iostream>
 #include <time.h>
+#include <cmath>
 
 #include "uw-csma-ca-hdrs.h"
 
@@ -232,10 +234,10 @@ protected:
 	 */
 	virtual void state_Idle();
 	/**
-	 * Backoff state
-	 * @param int Transmission time sent on over-heared RTS
+	 * Backoff state: waits until the NAV expires, then for a random number
+	 * of slots drawn from the current contention window
 	 */
-	virtual void state_Backoff(int tx_time);
+	virtual void state_Backoff();
 	/**
 	 * Transmit a data packet
 	 * @param Packet* Pointer to data packet to be transmitted
@@ -345,48 +347,85 @@ private:
 	void ack_timer_fired();
 	/**
 	 * Compute transmission time of a packet using known bitrate
-	 * @return int tranmission time
+	 * @return int tranmission time in milliseconds, as carried by RTS and CTS
 	 */
 	inline int
 	computeTxTime()
 	{
-		return (int) ((data_size * 8) / bitrate);
+		int tx_time = (int) ceil((data_size * 8000.0) / bitrate);
+		return (tx_time > 0xFFFF ? 0xFFFF : tx_time);
+	}
+	/**
+	 * Extends the NAV, if the new reservation ends later than the current one
+	 * @param double duration of the reservation starting now, seconds
+	 */
+	void updateNav(double duration);
+	/**
+	 * @return true if the channel is reserved by an overheard exchange
+	 */
+	inline bool
+	isNavBusy()
+	{
+		return (nav_end > NOW);
+	}
+	/**
+	 * Doubles the contention window after a failed exchange, up to cw_max
+	 */
+	inline void
+	increaseCw()
+	{
+		cw = (2 * cw > cw_max) ? cw_max : 2 * cw;
+	}
+	/**
+	 * Resets the contention window after a successful exchange
+	 */
+	inline void
+	resetCw()
+	{
+		cw = cw_min;
 	}
 
 	/* Header build Methods */
 	/**
 	 * Build an RTS header
 	 * @param hdr_ca_RTS** pointer to RTS header to be built
-	 * @param uint8_t expected tx time of DATA packet
+	 * @param uint16_t expected tx time of DATA packet
 	 */
-	void buildRTShdr(hdr_ca_RTS **rts, uint8_t tx_time);
+	void buildRTShdr(hdr_ca_RTS **rts, uint16_t tx_time);
 	/**
 	 * Build an CTS header
 	 * @param hdr_ca_CTS** pointer to CTS header to be built
-	 * @param uint8_t expected tx time of DATA packet
+	 * @param uint16_t expected tx time of DATA packet
 	 */
-	void buildCTShdr(hdr_ca_CTS **cts, uint8_t tx_time);
+	void buildCTShdr(hdr_ca_CTS **cts, uint16_t tx_time);
 	/**
 	 * Build a generic packet
 	 * @param int MAC destination
 	 * @param csma_ca_pkt_type_t type of packet to build
-	 * @param uint8_t expected tx time of DATA packet
+	 * @param uint16_t expected tx time of DATA packet
 	 */
-	Packet *buildPacket(int mac_dest, csma_ca_pkt_type_t type, uint8_t tx_time);
+	Packet *buildPacket(int mac_dest, csma_ca_pkt_type_t type, uint16_t tx_time);
 
 	/* config from tcl */
 	int max_queue_size; /**< Maximum dimension of Queue */
 	int data_size; /**< Size of DATA packet */
 	int bitrate; /**< Bit rate adopted */
-	int backoff_delta; /**< Delta value (configurable) to be added to backoff*/
-	int backoff_max; /**< Maximum value in range of backoff */
+	int cw_min; /**< Initial contention window, in slots */
+	int cw_max; /**< Maximum contention window, in slots */
+	double slot_time; /**< Duration of a backoff slot, seconds */
+	double nav_guard; /**< Time added to the reservations of overheard
+						 packets for control packets and propagation */
 	int cts_wait_val; /**< Timer duration of CTS */
 	int data_wait_val; /**< Timer duration of DATA */
 	int ack_wait_val; /**< Timer duration of ACK */
 
 	/* status variables */
 	int actual_mac_data_src; /**< Source MAC of DATA packet we are handling */
-	int actual_expected_tx_time; /**< Tx time of DATA packet we are handling */
+	int actual_expected_tx_time; /**< Tx time of DATA packet we are handling,
+									milliseconds */
+	int cw; /**< Current contention window, in slots */
+	double nav_end; /**< Time at which the NAV expires */
+	RNG *rng; /**< Random number generator of the module */
 	Packet *actual_data_packet; /**< Pointer to DATA packet we are handling */
 	std::queue<Packet *> data_q; /**< Size of DATA packet */
 	ack_modes_t ack_mode; /**< ACK mode (configurable */
@@ -32,39 +32,53 @@
  * @author Federico Guerra
  * @version 1.0.0
  *
- * \brief Provides the implementation of the CrossLayerMessage that represent
- * the WakeUP tone for data PHY layer
+ * \brief Provides the implementation of the CrossLayerMessage used by the MAC
+ * to read the tone counter of the WakeUp PHY
  *
  */
 
 #include "clmsg-wakeUp-tone.h"
 
-#include <iostream>
+#include <cassert>
 
-ClMessage_t CLMSG_MAC2PHY_TXTONE;
+ClMessage_t CLMSG_MAC2PHY_GETTONES;
 
-ClMsgMac2PhyTxTone::ClMsgMac2PhyTxTone()
-	: done(false)
-	, ClMessage(TLOHI_WAKEUPTONE_VERBOSITY, CLMSG_MAC2PHY_TXTONE)
+ClMsgMac2PhyGetTones::ClMsgMac2PhyGetTones(int dest_module_id)
+	: ClMessage(TLOHI_WAKEUPTONE_VERBOSITY, CLMSG_MAC2PHY_GETTONES, UNICAST,
+			  dest_module_id)
+	, tones(0)
+	, tone_time(0)
 {
 }
 
 ClMessage *
-ClMsgMac2PhyTxTone::copy()
+ClMsgMac2PhyGetTones::copy()
 {
 	// Supporting only synchronous messages!!!
 	assert(0);
+	return (0);
 }
 
-///// new clmsg MAC2PHY
-bool
-ClMsgMac2PhyTxTone::getStatus()
+int
+ClMsgMac2PhyGetTones::getTones()
 {
-	return (done);
+	return (tones);
 }
 
 void
-ClMsgPhy2MacIsAwake::setStatus(bool flag)
+ClMsgMac2PhyGetTones::setTones(int value)
 {
-	done = flag;
+	tones = value;
+}
+
+double
+ClMsgMac2PhyGetTones::getToneTime()
+{
+	return (tone_time);
+}
+
+void
+ClMsgMac2PhyGetTones::setToneTime(double time)
+{
+	tone_time = time;
 }
@@ -32,8 +32,8 @@
  * @author Federico Guerra
  * @version 1.0.0
  *
- * \brief Provides the implementation of the CrossLayerMessage that represent
- * the WakeUP tone for data PHY layer
+ * \brief Provides the CrossLayerMessage used by the MAC to read the tone
+ * counter of the WakeUp PHY
  *
  */
 
@@ -45,23 +45,22 @@
 
 #define TLOHI_WAKEUPTONE_VERBOSITY 3
 
-extern ClMessage_t CLMSG_MAC2PHY_TXTONE;
-/**
- * Class that represent the Crosslayer Service Access Point
- */
-class ClSAP;
+extern ClMessage_t CLMSG_MAC2PHY_GETTONES;
 
 /**
- * Class that describe the Mac2PhyTxTone CrossLayer message
+ * Class that describe the Mac2PhyGetTones CrossLayer message. The WakeUp PHY
+ * fills it with the number of tones acquired and the time they kept the
+ * receiver busy since the beginning of the simulation.
  */
-class ClMsgMac2PhyTxTone : public ClMessage
+class ClMsgMac2PhyGetTones : public ClMessage
 {
 
 public:
 	/**
 	 * Constructor of the class
+	 * @param int dest_module_id id of the WakeUp PHY
 	 */
-	ClMsgMac2PhyTxTone();
+	ClMsgMac2PhyGetTones(int dest_module_id);
 
 	/**
 	 * Copy the message
@@ -70,18 +69,29 @@ public:
 	ClMessage *copy();
 
 	/**
-	 * Return the status of the message
-	 * @return status
+	 * Return the number of tones acquired
+	 * @return number of tones
+	 */
+	int getTones();
+	/**
+	 * Set the number of tones acquired
+	 * @param int number of tones
+	 */
+	void setTones(int tones);
+	/**
+	 * Return the time in which the receiver was busy with tones
+	 * @return busy time [s]
 	 */
-	bool getStatus();
+	double getToneTime();
 	/**
-	 * Set the status of the message
-	 * @param bool status of the message
+	 * Set the time in which the receiver was busy with tones
+	 * @param double busy time [s]
 	 */
-	void setStatus(bool status);
+	void setToneTime(double time);
 
 private:
-	bool done; /**< Flag that indicates whether the message has been sent */
+	int tones; /**< Number of tones acquired */
+	double tone_time; /**< Time in which the receiver was busy with tones */
 };
 
 #endif /* TLOHI_WAKEUPTONE_CLMSG_H */
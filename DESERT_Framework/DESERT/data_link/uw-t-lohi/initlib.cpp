@@ -41,6 +41,7 @@
 
 #include "uw-mac-TLohi.h"
 #include "uw-phy-WakeUp.h"
+#include "clmsg-wakeUp-tone.h"
 
 extern EmbeddedTcl TlohiInitTclCode;
 
@@ -58,6 +59,7 @@ Uwtlohi_Init()
 
 	PT_TLOHI = p_info::addPacket("TLOHI");
 	PT_WKUP = p_info::addPacket("WKUP");
+	CLMSG_MAC2PHY_GETTONES = ClMessage::addClMessage();
 	TlohiInitTclCode.load();
 
 	return 0;
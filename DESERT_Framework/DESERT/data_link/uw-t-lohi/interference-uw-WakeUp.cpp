@@ -38,13 +38,10 @@
  */
 
 #include "interference-uw-WakeUp.h"
+#include "uw-phy-WakeUp.h"
 
-// #include <iostream>
-// #include <iomanip>
 #include "mphy.h"
 
-#define UW_WAKEUP_MODNAME "WKUP"
-
 /**
  * Class that represents the binding with the tcl configuration script
  */
@@ -70,6 +67,7 @@ public:
 } class_minterference_miv_wkup;
 
 MInterfMivUwWakeUp::MInterfMivUwWakeUp()
+	: tones(0)
 {
 }
 
@@ -77,12 +75,21 @@ MInterfMivUwWakeUp::~MInterfMivUwWakeUp()
 {
 }
 
+void
+MInterfMivUwWakeUp::addToInterference(Packet *p)
+{
+	hdr_MPhy *ph = HDR_MPHY(p);
+	if (ph->modulationType == MPhy_WakeUp::getToneModId())
+		tones++;
+	else
+		MInterferenceMIV::addToInterference(p);
+}
+
 double
 MInterfMivUwWakeUp::getInterferencePower(Packet *p)
 {
 	hdr_MPhy *ph = HDR_MPHY(p);
-	if ((ph->modulationType) != UW_WAKEUP_MODNAME)
-		return (getInterferencePower(ph->Pr, ph->rxtime, ph->duration));
-	else
+	if (ph->modulationType == MPhy_WakeUp::getToneModId())
 		return 0;
+	return (MInterferenceMIV::getInterferencePower(p));
 }
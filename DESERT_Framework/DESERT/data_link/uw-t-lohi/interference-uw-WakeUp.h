@@ -43,8 +43,11 @@
 #include <interference_miv.h>
 
 /**
- * Class that describe the interference model for the Tone channel
- *
+ * Class that describe the interference model for the Tone channel. Tones,
+ * recognized by the modulation id of MPhy_WakeUp, are neither stored in nor
+ * looked up from the list of interferers: the tone PHY resolves their
+ * overlaps by itself and counts them for the MAC. Any other packet is
+ * handled as in MInterferenceMIV.
  */
 class MInterfMivUwWakeUp : public MInterferenceMIV
 {
@@ -63,8 +66,24 @@ public:
 	 * @param Packet* pointer to the interfering packet
 	 */
 	virtual void addToInterference(Packet *p);
+	/**
+	 * Returns the interference power suffered by a packet
+	 * @param Packet* pointer to the packet
+	 * @return interference power, zero for tones
+	 */
+	virtual double getInterferencePower(Packet *p);
+	/**
+	 * Returns the number of tones that skipped the interference list
+	 * @return number of tones
+	 */
+	int
+	getTones()
+	{
+		return tones;
+	}
 
-	//  protected:
+protected:
+	int tones; /**< Tones that skipped the interference list */
 };
 
 #endif /* INTERFERENCE_UW_WAKEUP_H */
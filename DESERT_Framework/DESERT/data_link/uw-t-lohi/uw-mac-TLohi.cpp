@@ -39,6 +39,7 @@
 #include "uw-mac-TLohi.h"
 #include "wake-up-pkt-hdr.h"
 #include "uw-phy-WakeUp.h"
+#include "clmsg-wakeUp-tone.h"
 #include <clmsg-discovery.h>
 #include <mac.h>
 #include <cmath>
@@ -237,6 +238,7 @@ MMacTLOHI::MMacTLOHI()
 	, last_data_id_rx(NOT_SET)
 	, curr_data_pkt(0)
 	, curr_contenders(0)
+	, cr_tone_time(0)
 	, tone_pkts_tx(0)
 	, tone_pkts_rx(0)
 	, curr_tx_tries(0)
@@ -733,6 +735,14 @@ MMacTLOHI::countContenders(double time_interval)
 	return (contenders_no);
 }
 
+double
+MMacTLOHI::getToneTime()
+{
+	ClMsgMac2PhyGetTones m(tone_phy_id);
+	sendSyncClMsgDown(&m);
+	return (m.getToneTime());
+}
+
 void
 MMacTLOHI::Phy2MacEndTx(const Packet *p)
 { // si occupa dei cambi stato
@@ -1029,13 +1039,12 @@ MMacTLOHI::rxTone(Packet *p)
 
 		case (STATE_WAIT_END_CONTENTION): {
 
-			int contenders = countContenders(tone_time_interval);
-			curr_contenders += contenders;
-
+			// contenders are counted at the end of the CR from the tone
+			// counter of the tone PHY
 			if (debug_ > 0)
 				cout << NOW << "  MMacTLOHI(" << addr
-					 << ")::Phy2MacEndRx() contenders number = " << contenders
-					 << " ; current contenters = " << curr_contenders << endl;
+					 << ")::Phy2MacEndRx() TONE rx in CR, time interval = "
+					 << tone_time_interval << endl;
 
 		} break;
 
@@ -1181,6 +1190,7 @@ MMacTLOHI::stateStartContention()
 	hdr_mac *mach = HDR_MAC(curr_data_pkt);
 	curr_dest_addr = mach->macDA(); // indirizzo destinazione
 
+	cr_tone_time = getToneTime();
 	txTone();
 }
 
@@ -1226,6 +1236,8 @@ MMacTLOHI::stateCountContenders()
 	if (print_transitions)
 		printStateInfo();
 
+	curr_contenders = countContenders(getToneTime() - cr_tone_time);
+
 	if (curr_contenders == 0) {
 		refreshReason(REASON_NO_CONTENDERS);
 		stateTxData();
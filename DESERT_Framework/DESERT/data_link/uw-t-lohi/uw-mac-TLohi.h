@@ -340,6 +340,12 @@ protected:
 	 * @return the number of contenders
 	 */
 	virtual int countContenders(double time);
+	/**
+	 * Reads from the tone PHY the time spent receiving tones since the
+	 * beginning of the simulation
+	 * @return tone busy time [s]
+	 */
+	virtual double getToneTime();
 	/**
 	 * Send the Tone to the tone PHY layer
 	 */
@@ -648,6 +654,8 @@ protected:
 	Packet *curr_data_pkt; /**< Pointer to the current data packet */
 	int curr_contenders; /**< Number of contenders in current Contention Round
 							*/
+	double cr_tone_time; /**< Tone busy time of the tone PHY at the start of
+							the current Contention Round */
 	int curr_tx_rounds; /**< Number of current transmission round */
 	int curr_tx_tries; /**< Number of current transmission tries */
 
@@ -41,6 +41,7 @@
 #include <iostream>
 
 #include "uw-phy-WakeUp.h"
+#include "clmsg-wakeUp-tone.h"
 #include <rng.h>
 #include <underwater-mpropagation.h>
 #include <uwlib.h>
@@ -107,11 +108,11 @@ MPhy_WakeUp::MPhy_WakeUp()
 	: PktRx(0)
 	, txActive(false)
 	, droppedPktsTxPending(0)
+	, tones_rx(0)
+	, tone_busy_time(0)
+	, tone_busy_end(0)
 {
-	if (!initialized) {
-		modid = MPhy::registerModulationType(UW_WAKEUP_MODNAME);
-		initialized = true;
-	}
+	getToneModId();
 	bind("AcquisitionThreshold_dB_", (double *) &AcquisitionThreshold_dB_);
 	bind("ToneDuration_", (double *) &ToneDuration_);
 	bind("MaxTxRange_", (double *) &MaxTxRange_);
@@ -136,6 +137,40 @@ MPhy_WakeUp::command(int argc, const char *const *argv)
 	return (MPhy::command(argc, argv));
 }
 
+int
+MPhy_WakeUp::recvSyncClMsg(ClMessage *m)
+{
+	if (m->type() == CLMSG_MAC2PHY_GETTONES) {
+		ClMsgMac2PhyGetTones *msg = dynamic_cast<ClMsgMac2PhyGetTones *>(m);
+		msg->setTones(tones_rx);
+		msg->setToneTime(tone_busy_time);
+		return 0;
+	}
+	return MPhy::recvSyncClMsg(m);
+}
+
+int
+MPhy_WakeUp::getToneModId()
+{
+	if (!initialized) {
+		modid = MPhy::registerModulationType(UW_WAKEUP_MODNAME);
+		initialized = true;
+	}
+	return modid;
+}
+
+void
+MPhy_WakeUp::countTone(double start_time, double end_time)
+{
+	tones_rx++;
+	if (start_time < tone_busy_end)
+		start_time = tone_busy_end;
+	if (end_time > start_time)
+		tone_busy_time += end_time - start_time;
+	if (end_time > tone_busy_end)
+		tone_busy_end = end_time;
+}
+
 int
 MPhy_WakeUp::getModulationType(Packet *)
 {
@@ -240,6 +275,7 @@ MPhy_WakeUp::startRx(Packet *p)
 
 				// ideal synchronization
 				PktRx = p;
+				countTone(wkuph->startRx_time, wkuph->endRx_time);
 
 				// Notify the MAC
 				Phy2MacStartRx(p);
@@ -275,6 +311,7 @@ MPhy_WakeUp::startRx(Packet *p)
 
 				wkuph->startRx_time = ph->rxtime;
 				wkuph->endRx_time = ph->rxtime + getTxDuration(p);
+				countTone(wkuph->startRx_time, wkuph->endRx_time);
 				return;
 			} else { // below threshold
 				if (debug_)
@@ -104,6 +104,20 @@ public:
 	 *
 	 **/
 	virtual int command(int argc, const char *const *argv);
+	/**
+	 * Cross-Layer messages synchronous interpreter. It answers to
+	 * ClMsgMac2PhyGetTones with the tone counter.
+	 *
+	 * @param ClMessage* an instance of ClMessage that represent the message
+	 * received
+	 * @return <i>0</i> if successful.
+	 */
+	virtual int recvSyncClMsg(ClMessage *m);
+	/**
+	 * Returns the modulation id of the tones, registering it if needed
+	 * @return modulation id of the tones
+	 */
+	static int getToneModId();
 
 protected:
 	/**
@@ -158,6 +172,12 @@ protected:
 	 * Used for debug purposes. Permit a step-by-step behaviour of the PHY layer
 	 */
 	virtual void waitForUser();
+	/**
+	 * Accounts a tone acquired by the receiver in the tone counter
+	 * @param double start_time start of the reception of the tone
+	 * @param double end_time end of the reception of the tone
+	 */
+	void countTone(double start_time, double end_time);
 
 	Packet *PktRx; /**< Pointer to the packeti in reception */
 
@@ -177,6 +197,11 @@ protected:
 
 	int droppedPktsTxPending; /**< Total number of dropped pkts due to tx
 								 pending */
+
+	int tones_rx; /**< Tones acquired, also the chain-synched ones */
+	double tone_busy_time; /**< Total time in which at least one acquired
+							  tone was being received */
+	double tone_busy_end; /**< End of the last acquired tone */
 };
 
 #endif /* UW_WAKEUP_H */
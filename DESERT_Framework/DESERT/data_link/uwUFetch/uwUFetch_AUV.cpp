@@ -227,6 +227,7 @@ uwUFetch_AUV::uwUFetch_AUV()
 	bind("HEAD_NODE_4_", (int *) &HEAD_NODE_4);
 	bind("MODE_COMM_", (int *) &mode_comm_hn_auv);
 	bind("NUM_HN_NETWORK_", (int *) &NUM_HN_NET);
+	bind("CANDIDATE_ORDER_", (int *) &candidate_order_);
 
 } // end uwUFetch_AUV()
 
@@ -1349,17 +1350,14 @@ uwUFetch_AUV::RTS_rx()
 	 */
 	double bck_time_choice_rts_by_HN = (double) rtsh->backoff_time_RTS() / 1000;
 
-	Q_rts_mac_HN.push(mach->macSA()); // store the MAC address of the HN that
-	// has sent the RTS packet to the AUV
-	Q_rts_n_pcks_HN_want_tx_AUV.push(rtsh->num_DATA_pcks()); // store the number
-															 // of DATA packets
-															 // that the HN want
-															 // to tx to
-	// the AUV
-	Q_rts_backoff_time.push(bck_time_choice_rts_by_HN); // store the back-off
-														// time choice by the HN
-														// before to transmit
-	// a RTS packet
+	// Store the HN that has sent the RTS packet to the AUV, with the number
+	// of DATA packets it wants to tx and the backoff time it has chosen
+	if (Q_rts_candidates.empty())
+		Q_rts_candidates.setOrder(candidate_order_);
+	Q_rts_candidates.push(mach->macSA(),
+			rtsh->num_DATA_pcks(),
+			bck_time_choice_rts_by_HN,
+			NOW);
 
 	if (debugMio_)
 		out_file_logging << NOW << "uwUFetch_AUV(" << addr
@@ -1453,13 +1451,13 @@ uwUFetch_AUV::RtsTOExpired()
 							"timeout is expired."
 						 << std::endl;
 
-	if (!Q_rts_mac_HN.empty()) {
+	if (!Q_rts_candidates.empty()) {
 		// Queue is not empty.
 		if (debug_)
 			std::cout
 					<< NOW << " uwUFetch_AUV (" << addr
 					<< ") ::RtsTOExpired() ---->AUV has received "
-					<< Q_rts_mac_HN.size() << " RTS"
+					<< Q_rts_candidates.size() << " RTS"
 					<< " packets within the interval time pre-established, so "
 					<< " transmit a CTS packet." << std::endl;
 		if (debugMio_)
@@ -1530,17 +1528,15 @@ uwUFetch_AUV::state_CTS_tx()
 	cmh->ptype() = PT_CTS_UFETCH;
 	cmh->size() = sizeof(hdr_CTS_UFETCH);
 
-	mach->set(MF_CONTROL, addr, Q_rts_mac_HN.front());
+	mach->set(MF_CONTROL, addr, Q_rts_candidates.front().mac);
 	mach->macSA() = addr;
-	mach->macDA() = Q_rts_mac_HN.front();
+	mach->macDA() = Q_rts_candidates.front().mac;
 
 	// Filling the HEADER of the CTS packet
-	if (Q_rts_n_pcks_HN_want_tx_AUV.front() <= NUM_MAX_DATA_AUV_WANT_RX) {
-		ctsh->num_DATA_pcks_MAX_rx() =
-				Q_rts_n_pcks_HN_want_tx_AUV.front(); // Maximum number of DATA
-													 // packets that the AUV
-													 // want to
-		// receive from the HN that is being to cts
+	if (Q_rts_candidates.front().n_pcks <= NUM_MAX_DATA_AUV_WANT_RX) {
+		// Maximum number of DATA packets that the AUV want to receive from
+		// the HN that is being to cts
+		ctsh->num_DATA_pcks_MAX_rx() = Q_rts_candidates.front().n_pcks;
 	} else {
 		ctsh->num_DATA_pcks_MAX_rx() =
 				NUM_MAX_DATA_AUV_WANT_RX; // Maximum number of DATA packets that
@@ -1549,12 +1545,9 @@ uwUFetch_AUV::state_CTS_tx()
 	}
 
 	number_data_pck_AUV_rx_exact = ctsh->num_DATA_pcks_MAX_rx();
-	ctsh->mac_addr_HN_ctsed() = Q_rts_mac_HN.front(); // Mac address of the HN
-													  // that the AUV is being
-													  // to cts
-	mac_addr_HN_ctsed = Q_rts_mac_HN.front(); // Store the mac address of the HN
-											  // that the AUV is being
-	// to cts
+	// Mac address of the HN that the AUV is being to cts
+	ctsh->mac_addr_HN_ctsed() = Q_rts_candidates.front().mac;
+	mac_addr_HN_ctsed = Q_rts_candidates.front().mac;
 
 	curr_CTS_pck_tx = p->copy();
 
@@ -1936,11 +1929,7 @@ uwUFetch_AUV::updateQueueRTS()
 						 << ")::updateQueueRTS()______________________Update "
 							"the queue of RTS received."
 						 << std::endl;
-	while (!Q_rts_mac_HN.empty()) {
-		Q_rts_mac_HN.pop();
-		Q_rts_n_pcks_HN_want_tx_AUV.pop();
-		Q_rts_backoff_time.pop();
-	}
+	Q_rts_candidates.clear();
 }
 
 void
@@ -48,6 +48,8 @@
 #include <map>
 #include <queue>
 
+#include "uwUFetch_candidates.h"
+
 #define UWFETCH_AUV_DROP_REASON_ERROR \
 	"DERR" /**<  Packet dropped: Packet corrupted */
 #define UWFETCH_AUV_DROP_REASON_UNKNOWN_TYPE \
@@ -1129,15 +1131,13 @@ protected:
 	// STRUCTURES USED
 	std::queue<Packet *> Q_data_AUV; /**< Queue of DATA packets stored by the
 										AUV and received from HNs */
-	std::queue<int> Q_rts_mac_HN; /**< Queue of HN MAC address from which AUV
-									 has received correctly the RTS packet */
-	std::queue<int> Q_rts_n_pcks_HN_want_tx_AUV; /**< Queue that store the
-													number of DATA packets that
-													the single HN want to tx to
-													the AUV. */
-	std::queue<double> Q_rts_backoff_time; /**< Queue that stored the backoff
-											  time choice by the single HN
-											  before to transmit RTS packet */
+	uwUFetch_candidate_queue Q_rts_candidates; /**< HNs from which the AUV
+												  has received correctly the
+												  RTS packet, with the number
+												  of DATA packets they want to
+												  tx and their backoff time */
+	int candidate_order_; /**< Order in which the HNs are served, see
+							 UWUFETCH_CANDIDATE_ORDER */
 
 	// VARIABLES THAT INDICATE IN WHICH STATE THE NODE IS IN THAT MOMENT AND THE
 	// REASON BECAUSE THE NODE PASS FROM A STATE TO ANOTHER ONE
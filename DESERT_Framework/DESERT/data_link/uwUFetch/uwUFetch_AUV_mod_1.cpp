@@ -170,6 +170,7 @@ uwUFetch_AUV::uwUFetch_AUV()
 	bind("HEAD_NODE_4_", (int *) &HEAD_NODE_4);
 	bind("MODE_COMM_", (int *) &mode_comm_hn_auv);
 	bind("NUM_HN_NETWORK_", (int *) &NUM_HN_NET);
+	bind("CANDIDATE_ORDER_", (int *) &candidate_order_);
 
 } // end uwUFetch_AUV()
 
@@ -714,9 +715,7 @@ uwUFetch_AUV::Phy2MacEndRx(Packet *p)
 						incrData_Rx_by_AUV();
 						incrTotal_Data_Rx_corrupted_by_AUV();
 
-						curr_DATA_pck_rx = p->copy();
-
-						hdr_uwcbr *cbrh = HDR_UWCBR(curr_DATA_pck_rx);
+						hdr_uwcbr *cbrh = HDR_UWCBR(p);
 
 						if (debugMio_)
 							out_file_logging << NOW << "uwUFetch_AUV(" << addr
@@ -740,9 +739,7 @@ uwUFetch_AUV::Phy2MacEndRx(Packet *p)
 									  << " packet from HN(" << mach->macSA()
 									  << "): DROP IT." << std::endl;
 
-						curr_DATA_pck_rx = p->copy();
-
-						hdr_uwcbr *cbrh = HDR_UWCBR(curr_DATA_pck_rx);
+						hdr_uwcbr *cbrh = HDR_UWCBR(p);
 
 						if (debugMio_)
 							out_file_logging
@@ -769,7 +766,7 @@ uwUFetch_AUV::Phy2MacEndRx(Packet *p)
 
 					incrData_Rx_by_AUV();
 
-					curr_DATA_pck_rx = p->copy();
+					curr_DATA_pck_rx = p;
 
 					hdr_uwcbr *cbrh = HDR_UWCBR(curr_DATA_pck_rx);
 
@@ -782,8 +779,6 @@ uwUFetch_AUV::Phy2MacEndRx(Packet *p)
 										 << ")_id_pck:" << cbrh->sn() << ""
 										 << "_IT_S_CORRECT." << std::endl;
 
-					Packet::free(p);
-
 					refreshReason(
 							UWUFETCH_AUV_STATUS_CHANGE_DATA_PCK_FINISHED_TO_RX);
 					DATA_rx();
@@ -1136,17 +1131,14 @@ uwUFetch_AUV::RTS_rx()
 	 */
 	double bck_time_choice_rts_by_HN = (double) rtsh->backoff_time_RTS() / 1000;
 
-	Q_rts_mac_HN.push(mach->macSA()); // store the MAC address of the HN that
-	// has sent the RTS packet to the AUV
-	Q_rts_n_pcks_HN_want_tx_AUV.push(rtsh->num_DATA_pcks()); // store the number
-															 // of DATA packets
-															 // that the HN want
-															 // to tx to
-	// the AUV
-	Q_rts_backoff_time.push(bck_time_choice_rts_by_HN); // store the back-off
-														// time choice by the HN
-														// before to transmit
-	// a RTS packet
+	// Store the HN that has sent the RTS packet to the AUV, with the number
+	// of DATA packets it wants to tx and the backoff time it has chosen
+	if (Q_rts_candidates.empty())
+		Q_rts_candidates.setOrder(candidate_order_);
+	Q_rts_candidates.push(mach->macSA(),
+			rtsh->num_DATA_pcks(),
+			bck_time_choice_rts_by_HN,
+			NOW);
 
 	if (debugMio_)
 		out_file_logging << NOW << "uwUFetch_AUV(" << addr
@@ -1271,17 +1263,15 @@ uwUFetch_AUV::state_CTS_tx()
 	cmh->ptype() = PT_CTS_UFETCH;
 	cmh->size() = sizeof(hdr_CTS_UFETCH);
 
-	mach->set(MF_CONTROL, addr, Q_rts_mac_HN.front());
+	mach->set(MF_CONTROL, addr, Q_rts_candidates.front().mac);
 	mach->macSA() = addr;
-	mach->macDA() = Q_rts_mac_HN.front();
+	mach->macDA() = Q_rts_candidates.front().mac;
 
 	// Filling the HEADER of the CTS packet
-	if (Q_rts_n_pcks_HN_want_tx_AUV.front() <= NUM_MAX_DATA_AUV_WANT_RX) {
-		ctsh->num_DATA_pcks_MAX_rx() =
-				Q_rts_n_pcks_HN_want_tx_AUV.front(); // Maximum number of DATA
-													 // packets that the AUV
-													 // want to
-		// receive from the HN that is being to cts
+	if (Q_rts_candidates.front().n_pcks <= NUM_MAX_DATA_AUV_WANT_RX) {
+		// Maximum number of DATA packets that the AUV want to receive from
+		// the HN that is being to cts
+		ctsh->num_DATA_pcks_MAX_rx() = Q_rts_candidates.front().n_pcks;
 	} else {
 		ctsh->num_DATA_pcks_MAX_rx() =
 				NUM_MAX_DATA_AUV_WANT_RX; // Maximum number of DATA packets that
@@ -1290,11 +1280,9 @@ uwUFetch_AUV::state_CTS_tx()
 	}
 
 	number_data_pck_AUV_rx_exact = ctsh->num_DATA_pcks_MAX_rx();
-	ctsh->mac_addr_HN_ctsed() = Q_rts_mac_HN.front(); // Mac address of the HN
-													  // that the AUV is being
-													  // to cts
-	mac_addr_HN_ctsed = Q_rts_mac_HN.front(); // Store the mac address of the HN
-											  // that the AUV is being to cts
+	// Mac address of the HN that the AUV is being to cts
+	ctsh->mac_addr_HN_ctsed() = Q_rts_candidates.front().mac;
+	mac_addr_HN_ctsed = Q_rts_candidates.front().mac;
 
 	curr_CTS_pck_tx = p->copy();
 
@@ -1427,17 +1415,6 @@ uwUFetch_AUV::DATA_rx()
 				  << " MAC address: " << mac_addr_HN_in_data << "."
 				  << std::endl;
 
-	/**
-	 * save the data packet in the QUEUE of the AUV
-	 * an pass it to the application layer
-	 */
-	Q_data_AUV.push(
-			curr_DATA_pck_rx
-					->copy()); // Save the data packets in the QUEUE of the AUV
-	sendUp(curr_DATA_pck_rx->copy()); // Pass the DATA packets received from the
-									  // AUV at the CBR level
-	Q_data_AUV.pop();
-
 	hdr_uwcbr *cbrh = HDR_UWCBR(curr_DATA_pck_rx);
 
 	if (debugMio_)
@@ -1448,7 +1425,9 @@ uwUFetch_AUV::DATA_rx()
 				<< ")_id_pck:" << cbrh->sn() << ""
 				<< "_IS_PASSED_TO_APP_LAYER." << std::endl;
 
-	Packet::free(curr_DATA_pck_rx);
+	// Pass the DATA packet received from the HN to the CBR level
+	sendUp(curr_DATA_pck_rx);
+	curr_DATA_pck_rx = NULL;
 
 	if (debug_)
 		std::cout << NOW << " uwUFetch_AUV (" << addr
@@ -1702,11 +1681,7 @@ uwUFetch_AUV::updateQueueRTS()
 					 "list of queue"
 				  << "  node from which it has received the RTS packets."
 				  << std::endl;
-	while (!Q_rts_mac_HN.empty()) {
-		Q_rts_mac_HN.pop();
-		Q_rts_n_pcks_HN_want_tx_AUV.pop();
-		Q_rts_backoff_time.pop();
-	}
+	Q_rts_candidates.clear();
 }
 
 void
@@ -403,9 +403,7 @@ uwUFetch_AUV::Phy2MacEndRx_without(Packet *p)
 					incrData_Rx_by_AUV();
 					incrTotal_Data_Rx_corrupted_by_AUV();
 
-					curr_DATA_pck_rx = p->copy();
-
-					hdr_uwcbr *cbrh = HDR_UWCBR(curr_DATA_pck_rx);
+					hdr_uwcbr *cbrh = HDR_UWCBR(p);
 
 					if (debugMio_)
 						out_file_logging << NOW << "uwUFetch_AUV(" << addr
@@ -438,9 +436,7 @@ uwUFetch_AUV::Phy2MacEndRx_without(Packet *p)
 									 "enabled to receive the DATA"
 								  << " packet: DROP IT." << std::endl;
 
-					curr_DATA_pck_rx = p->copy();
-
-					hdr_uwcbr *cbrh = HDR_UWCBR(curr_DATA_pck_rx);
+					hdr_uwcbr *cbrh = HDR_UWCBR(p);
 
 					if (debugMio_)
 						out_file_logging
@@ -476,7 +472,7 @@ uwUFetch_AUV::Phy2MacEndRx_without(Packet *p)
 									 << std::endl;
 				DATA_timer_first_pck.force_cancel();
 
-				curr_DATA_pck_rx = p->copy();
+				curr_DATA_pck_rx = p;
 
 				hdr_uwcbr *cbrh = HDR_UWCBR(curr_DATA_pck_rx);
 
@@ -488,8 +484,6 @@ uwUFetch_AUV::Phy2MacEndRx_without(Packet *p)
 									 << ")_id_pck:" << cbrh->sn() << ""
 									 << "_IT_S_CORRECT." << std::endl;
 
-				Packet::free(p);
-
 				refreshReason(
 						UWUFETCH_AUV_STATUS_CHANGE_DATA_PCK_FINISHED_TO_RX);
 				DATA_rx();
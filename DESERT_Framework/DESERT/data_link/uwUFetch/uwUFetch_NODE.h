@@ -50,6 +50,8 @@
 #include <cassert>
 #include <queue>
 #include <map>
+
+#include "uwUFetch_candidates.h"
 //#include "uwmphy_modem_cmn_hdr.h"
 
 #define UWFETCH_NODE_DROP_REASON_UNKNOWN_TYPE \
@@ -2544,18 +2546,14 @@ protected:
 	std::queue<int> Q_data_source_SN; /**< Queue that contain the MAC address
 										 from which the HN has received the DATA
 										 packet */
-	std::queue<int> Q_probbed_mac_HN; /**< Queue that store the MAC address of
-										 the SN from which the HN has received
-										 correctly the PROBE packets */
-	std::queue<int>
-			Q_probbed_n_pcks_NODE_want_tx_HN; /**< Queue that store the number
-												 of DATA packets that the single
-												 SN want to tx to the HN. */
-	std::queue<double> Q_probbed_backoff_time; /**< Queue that stored the
-												  backoff time choice by the
-												  single nodes before to
-												  transmit the PROBE packet to
-												  the HN */
+	uwUFetch_candidate_queue Q_probbed_candidates; /**< SNs from which the HN
+													  has received correctly
+													  the PROBE packet, with
+													  the number of DATA
+													  packets they want to tx
+													  and their backoff time */
+	int candidate_order_; /**< Order in which the SNs are polled, see
+							 UWUFETCH_CANDIDATE_ORDER */
 
 	// EXTRA
 	UWUFETCH_NODE_STATUS_CHANGE last_reason; /**< Last reason because the SN or
@@ -427,7 +427,7 @@ uwUFetch_NODE::Phy2MacEndRx_HN(Packet *p)
 					while ((!Q_data.empty()) &&
 							(index_q <= MAX_PCK_HN_WANT_RX_FROM_NODE)) {
 						// Pick up the first element of the queue
-						curr_DATA_NODE_pck_tx_HN = (Q_data.front())->copy();
+						curr_DATA_NODE_pck_tx_HN = Q_data.front();
 						// Remove the element from the queue that we have pick
 						// up the packet
 						Q_data.pop();
@@ -1295,7 +1295,7 @@ uwUFetch_NODE::stateIdle_HN()
 	int index_q = 0;
 	while ((!Q_data.empty()) && (index_q <= MAX_PCK_HN_WANT_RX_FROM_NODE)) {
 		// Pick up the first element of the queue
-		curr_DATA_NODE_pck_tx_HN = (Q_data.front())->copy();
+		curr_DATA_NODE_pck_tx_HN = Q_data.front();
 		// Remove the element from the queue that we have pick up the packet
 		Q_data.pop();
 		// Add the packet to the queue of data packets that HN will transmit to
@@ -1439,7 +1439,7 @@ uwUFetch_NODE::BeaconTxTOExpire()
 	int index_q = 0;
 	while ((!Q_data.empty()) && (index_q <= MAX_PCK_HN_WANT_RX_FROM_NODE)) {
 		// Pick up the first element of the queue
-		curr_DATA_NODE_pck_tx_HN = (Q_data.front())->copy();
+		curr_DATA_NODE_pck_tx_HN = Q_data.front();
 		// Remove the element from the queue that we have pick up the packet
 		Q_data.pop();
 		// Add the packet to the queue of data packets that HN will transmit to
@@ -2028,7 +2028,7 @@ uwUFetch_NODE::state_DATA_HN_first_tx()
 					<< std::endl;
 
 		// Pick up the first element of the queue
-		curr_DATA_HN_pck_tx = (Q_data_HN.front())->copy();
+		curr_DATA_HN_pck_tx = Q_data_HN.front();
 		// Remove the element from the queue that we have pick up
 		Q_data_HN.pop();
 
@@ -2119,7 +2119,7 @@ uwUFetch_NODE::state_DATA_HN_tx()
 							 << "." << std::endl;
 
 		// Pick up the first element of the queue
-		curr_DATA_HN_pck_tx = (Q_data_HN.front())->copy();
+		curr_DATA_HN_pck_tx = Q_data_HN.front();
 		// Remove the element from the queue that we have pick up
 		Q_data_HN.pop();
 
@@ -2209,11 +2209,7 @@ void
 uwUFetch_NODE::state_BEACON_tx()
 {
 
-	while (!Q_probbed_mac_HN.empty()) {
-		Q_probbed_mac_HN.pop();
-		Q_probbed_n_pcks_NODE_want_tx_HN.pop();
-		Q_probbed_backoff_time.pop();
-	}
+	Q_probbed_candidates.clear();
 
 	if (debug_)
 		std::cout << NOW << " uwUFetch_NODE (" << addr
@@ -2415,7 +2411,7 @@ uwUFetch_NODE::ProbeTOExpired()
 							"timeout expired."
 						 << std::endl;
 
-	if ((Q_probbed_mac_HN.empty()) &&
+	if ((Q_probbed_candidates.empty()) &&
 			(getCBeaconPckTx_by_HN() == MAX_ALLOWED_CBEACON_TX)) {
 
 		if (debug_)
@@ -2452,7 +2448,7 @@ uwUFetch_NODE::ProbeTOExpired()
 
 		stateIdle_HN();
 
-	} else if ((Q_probbed_mac_HN.empty()) &&
+	} else if ((Q_probbed_candidates.empty()) &&
 			(getCBeaconPckTx_by_HN() < MAX_ALLOWED_CBEACON_TX)) {
 
 		if (debug_)
@@ -2489,7 +2485,7 @@ uwUFetch_NODE::ProbeTOExpired()
 		if (debug_)
 			std::cout << NOW << " uwUFetch_NODE (" << addr
 					  << ") ::ProbeTOExpired() ---->HN has received "
-					  << (Q_probbed_mac_HN.size())
+					  << (Q_probbed_candidates.size())
 					  << " PROBE packets, so start a new transmission of POLL "
 						 "packet."
 					  << std::endl;
@@ -2530,16 +2526,14 @@ uwUFetch_NODE::PROBE_rx()
 	 *  to the HN
 	 *
 	 */
-	Q_probbed_mac_HN.push(
-			mach->macSA()); // store the MAC address of the NODE that
-	// has sent the PROBE packet to the HN
-	Q_probbed_n_pcks_NODE_want_tx_HN.push(
-			probeh->n_DATA_pcks_Node_tx()); // store the number of packets that
-											// the NODE want to tx at
-	// the HN
-	Q_probbed_backoff_time.push((double) probeh->backoff_time_PROBE() /
-			1000); // store the back-off time choice by the NODE before
-	// to transmit the PROBE packet
+	// Store the NODE that has sent the PROBE packet to the HN, with the
+	// number of DATA packets it wants to tx and the backoff time it has chosen
+	if (Q_probbed_candidates.empty())
+		Q_probbed_candidates.setOrder(candidate_order_);
+	Q_probbed_candidates.push(mach->macSA(),
+			probeh->n_DATA_pcks_Node_tx(),
+			(double) probeh->backoff_time_PROBE() / 1000,
+			NOW);
 
 	if (debugMio_)
 		out_file_logging << NOW << "uwUFetch_HEAD_NODE(" << addr
@@ -2589,7 +2583,7 @@ uwUFetch_NODE::PROBE_rx()
 
 	Packet::free(curr_PROBE_HN_pck_rx);
 
-	if (Q_probbed_mac_HN.size() == MAX_POLLED_NODE) {
+	if (Q_probbed_candidates.size() == MAX_POLLED_NODE) {
 		// MAXIMUM number of PROBE packet is received by the HN
 
 		if (debug_)
@@ -2644,7 +2638,8 @@ uwUFetch_NODE::state_wait_other_PROBE()
 		std::cout << NOW << " uwUFetch_NODE (" << addr
 				  << ") ::state_wait_other_PROBE() ---->HN is waiting the "
 					 "reception of"
-				  << " PROBE packet number: " << (Q_probbed_mac_HN.size() + 1)
+				  << " PROBE packet number: "
+				  << (Q_probbed_candidates.size() + 1)
 				  << std::endl;
 
 	if (debugMio_)
@@ -2711,18 +2706,16 @@ uwUFetch_NODE::state_POLL_tx()
 	cmh->ptype() = PT_POLL_UFETCH;
 	cmh->size() = sizeof(hdr_POLL_UFETCH);
 
-	mach->set(MF_CONTROL, addr, Q_probbed_mac_HN.front());
+	mach->set(MF_CONTROL, addr, Q_probbed_candidates.front().mac);
 	mach->macSA() = addr;
-	mach->macDA() = Q_probbed_mac_HN.front();
+	mach->macDA() = Q_probbed_candidates.front().mac;
 
 	// Filling the HEADER of the POLL packet
-	if (Q_probbed_n_pcks_NODE_want_tx_HN.front() <=
+	if (Q_probbed_candidates.front().n_pcks <=
 			MAX_PCK_HN_WANT_RX_FROM_NODE) {
-		pollh->num_DATA_pcks_MAX_rx() =
-				Q_probbed_n_pcks_NODE_want_tx_HN.front(); // Maximum number of
-														  // DATA packets that
-														  // the HN want to
-		// receive from the NODE that is being to poll
+		// Maximum number of DATA packets that the HN want to receive from
+		// the NODE that is being to poll
+		pollh->num_DATA_pcks_MAX_rx() = Q_probbed_candidates.front().n_pcks;
 	} else {
 		pollh->num_DATA_pcks_MAX_rx() =
 				MAX_PCK_HN_WANT_RX_FROM_NODE; // Maximum numbero of DATA packets
@@ -2730,13 +2723,9 @@ uwUFetch_NODE::state_POLL_tx()
 		// receive from the NODE that is being to poll
 	}
 	number_data_pck_HN_rx_exact = pollh->num_DATA_pcks_MAX_rx();
-	pollh->mac_addr_Node_polled() =
-			Q_probbed_mac_HN.front(); // Mac address of the NODE that the HN is
-									  // being to poll
-	mac_addr_NODE_polled = Q_probbed_mac_HN.front(); // Store the mac address of
-													 // the NODE that the HN is
-													 // being
-	// to poll
+	// Mac address of the NODE that the HN is being to poll
+	pollh->mac_addr_Node_polled() = Q_probbed_candidates.front().mac;
+	mac_addr_NODE_polled = Q_probbed_candidates.front().mac;
 
 	if (debugMio_)
 		out_file_logging << NOW << "uwUFetch_HEAD_NODE(" << addr
@@ -2937,7 +2926,7 @@ uwUFetch_NODE::DataTOExpired()
 
 	// Verify if another node can be polled, or the HN will start the
 	// transmission of CBEACON
-	if ((Q_probbed_mac_HN.empty()) &&
+	if ((Q_probbed_candidates.empty()) &&
 			(getCBeaconPckTx_by_HN() == MAX_ALLOWED_CBEACON_TX)) {
 		// There aren't another node to poll, and the maximum number of CBEACONS
 		// are transmitted
@@ -2977,7 +2966,7 @@ uwUFetch_NODE::DataTOExpired()
 
 		stateIdle_HN();
 
-	} else if ((Q_probbed_mac_HN.empty()) &&
+	} else if ((Q_probbed_candidates.empty()) &&
 			(getCBeaconPckTx_by_HN() < MAX_ALLOWED_CBEACON_TX)) {
 		// There aren't another node to poll, and the maximum number of CBEACONS
 		// are not transmitted
@@ -3136,7 +3125,7 @@ uwUFetch_NODE::DATA_rx()
 
 			// Verify if another node can be polled, or the HN will start the
 			// transmission of CBEACON
-			if ((Q_probbed_mac_HN.empty()) &&
+			if ((Q_probbed_candidates.empty()) &&
 					(getCBeaconPckTx_by_HN() == MAX_ALLOWED_CBEACON_TX)) {
 				// There aren't another node to poll, and the maximum number of
 				// CBEACONS are transmitted
@@ -3170,7 +3159,7 @@ uwUFetch_NODE::DATA_rx()
 
 				stateIdle_HN();
 
-			} else if ((Q_probbed_mac_HN.empty()) &&
+			} else if ((Q_probbed_candidates.empty()) &&
 					(getCBeaconPckTx_by_HN() < MAX_ALLOWED_CBEACON_TX)) {
 				// There aren't another node to poll, and the maximum number of
 				// CBEACONS are not transmitted
@@ -3262,11 +3251,7 @@ void
 uwUFetch_NODE::state_CBEACON_tx()
 {
 
-	while (!Q_probbed_mac_HN.empty()) {
-		Q_probbed_mac_HN.pop();
-		Q_probbed_n_pcks_NODE_want_tx_HN.pop();
-		Q_probbed_backoff_time.pop();
-	}
+	Q_probbed_candidates.clear();
 	// HN transmit a CBEACON packet to the sensor nodes
 
 	if (debug_)
@@ -3462,9 +3447,9 @@ uwUFetch_NODE::getDataTimerValue()
 	RTT = getRTT();
 
 	int pck_tx_number = 0;
-	if (Q_probbed_n_pcks_NODE_want_tx_HN.front() <=
+	if (Q_probbed_candidates.front().n_pcks <=
 			MAX_PCK_HN_WANT_RX_FROM_NODE) {
-		pck_tx_number = Q_probbed_n_pcks_NODE_want_tx_HN.front();
+		pck_tx_number = Q_probbed_candidates.front().n_pcks;
 	} else {
 		pck_tx_number = MAX_PCK_HN_WANT_RX_FROM_NODE;
 	}
@@ -3560,9 +3545,7 @@ uwUFetch_NODE::updateListProbbedNode()
 				  << " MAC address: " << mac_addr_NODE_polled
 				  << ", so remove the NODE from the list." << std::endl;
 
-	Q_probbed_mac_HN.pop();
-	Q_probbed_n_pcks_NODE_want_tx_HN.pop();
-	Q_probbed_backoff_time.pop();
+	Q_probbed_candidates.pop();
 
 } // end updateListProbbedNode();
 
@@ -339,7 +339,7 @@ uwUFetch_NODE::Phy2MacEndRx_HN(Packet *p)
 					while ((!Q_data.empty()) &&
 							(index_q <= MAX_PCK_HN_WANT_RX_FROM_NODE)) {
 						// Pick up the first element of the queue
-						curr_DATA_NODE_pck_tx_HN = (Q_data.front())->copy();
+						curr_DATA_NODE_pck_tx_HN = Q_data.front();
 						// Remove the element from the queue that we have pick
 						// up the packet
 						Q_data.pop();
@@ -662,13 +662,11 @@ uwUFetch_NODE::Phy2MacEndRx_HN(Packet *p)
 
 				rx_DATA_finish_HN_time = NOW;
 
-				curr_DATA_HN_pck_rx = p->copy();
-
 				incrDataPckRx_by_HN();
 				incrTotalDataPckRx_by_HN();
 				incrTotalDataPckRx_corrupted_by_HN();
 
-				hdr_uwcbr *cbrh = HDR_UWCBR(curr_DATA_HN_pck_rx);
+				hdr_uwcbr *cbrh = HDR_UWCBR(p);
 
 				if (debugMio_)
 					out_file_logging << NOW << "uwUFetch_HEAD_NODE(" << addr
@@ -699,14 +697,12 @@ uwUFetch_NODE::Phy2MacEndRx_HN(Packet *p)
 				incrDataPckRx_by_HN();
 				incrTotalDataPckRx_by_HN();
 
-				curr_DATA_HN_pck_rx = p->copy();
+				curr_DATA_HN_pck_rx = p;
 
 				hdr_uwcbr *cbrh = HDR_UWCBR(curr_DATA_HN_pck_rx);
 
 				refreshReason(UWUFETCH_NODE_STATUS_CHANGE_DATA_RX);
 
-				Packet::free(p);
-
 				DATA_rx();
 			}
 		}
@@ -1100,7 +1096,7 @@ uwUFetch_NODE::stateIdle_HN()
 	int index_q = 0;
 	while ((!Q_data.empty()) && (index_q <= MAX_PCK_HN_WANT_RX_FROM_NODE)) {
 		// Pick up the first element of the queue
-		curr_DATA_NODE_pck_tx_HN = (Q_data.front())->copy();
+		curr_DATA_NODE_pck_tx_HN = Q_data.front();
 		// Remove the element from the queue that we have pick up the packet
 		Q_data.pop();
 		// Add the packet to the queue of data packets that HN will transmit to
@@ -1252,7 +1248,7 @@ uwUFetch_NODE::BeaconTxTOExpire()
 	int index_q = 0;
 	while ((!Q_data.empty()) && (index_q <= MAX_PCK_HN_WANT_RX_FROM_NODE)) {
 		// Pick up the first element of the queue
-		curr_DATA_NODE_pck_tx_HN = (Q_data.front())->copy();
+		curr_DATA_NODE_pck_tx_HN = Q_data.front();
 		// Remove the element from the queue that we have pick up the packet
 		Q_data.pop();
 		// Add the packet to the queue of data packets that HN will transmit to
@@ -1745,7 +1741,7 @@ uwUFetch_NODE::state_DATA_HN_first_tx()
 					  << mac_addr_AUV_in_CTS << std::endl;
 
 		// Pick up the first element of the queue
-		curr_DATA_HN_pck_tx = (Q_data_HN.front())->copy();
+		curr_DATA_HN_pck_tx = Q_data_HN.front();
 		// Remove the element from the queue that we have pick up
 		Q_data_HN.pop();
 
@@ -1867,7 +1863,7 @@ uwUFetch_NODE::state_DATA_HN_tx()
 					  << " MAC address: " << mac_addr_AUV_in_CTS << std::endl;
 
 		// Pick up the first element of the queue
-		curr_DATA_HN_pck_tx = (Q_data_HN.front())->copy();
+		curr_DATA_HN_pck_tx = Q_data_HN.front();
 		// Remove the element from the queue that we have pick up
 		Q_data_HN.pop();
 
@@ -2003,11 +1999,7 @@ void
 uwUFetch_NODE::state_BEACON_tx()
 {
 
-	while (!Q_probbed_mac_HN.empty()) {
-		Q_probbed_mac_HN.pop();
-		Q_probbed_n_pcks_NODE_want_tx_HN.pop();
-		Q_probbed_backoff_time.pop();
-	}
+	Q_probbed_candidates.clear();
 
 	if (debug_)
 		std::cout << NOW << " uwUFetch_NODE (" << addr
@@ -2194,7 +2186,7 @@ uwUFetch_NODE::ProbeTOExpired()
 							"timeout_expired."
 						 << std::endl;
 
-	if ((Q_probbed_mac_HN.empty()) &&
+	if ((Q_probbed_candidates.empty()) &&
 			(getCBeaconPckTx_by_HN() == MAX_ALLOWED_CBEACON_TX)) {
 
 		if (debug_)
@@ -2231,7 +2223,7 @@ uwUFetch_NODE::ProbeTOExpired()
 
 		stateIdle_HN();
 
-	} else if ((Q_probbed_mac_HN.empty()) &&
+	} else if ((Q_probbed_candidates.empty()) &&
 			(getCBeaconPckTx_by_HN() < MAX_ALLOWED_CBEACON_TX)) {
 
 		if (debug_)
@@ -2268,7 +2260,7 @@ uwUFetch_NODE::ProbeTOExpired()
 		if (debug_)
 			std::cout << NOW << " uwUFetch_NODE (" << addr
 					  << ") ::ProbeTOExpired() ---->HN has received "
-					  << (Q_probbed_mac_HN.size())
+					  << (Q_probbed_candidates.size())
 					  << " PROBE packets, so start a new transmission of POLL "
 						 "packet."
 					  << std::endl;
@@ -2303,16 +2295,14 @@ uwUFetch_NODE::PROBE_rx()
 	 *  to the HN
 	 *
 	 */
-	Q_probbed_mac_HN.push(
-			mach->macSA()); // store the MAC address of the NODE that
-	// has sent the PROBE packet to the HN
-	Q_probbed_n_pcks_NODE_want_tx_HN.push(
-			probeh->n_DATA_pcks_Node_tx()); // store the number of packets that
-											// the NODE want to tx at
-	// the HN
-	Q_probbed_backoff_time.push((double) probeh->backoff_time_PROBE() /
-			1000); // store the back-off time choice by the NODE before
-	// to transmit the PROBE packet
+	// Store the NODE that has sent the PROBE packet to the HN, with the
+	// number of DATA packets it wants to tx and the backoff time it has chosen
+	if (Q_probbed_candidates.empty())
+		Q_probbed_candidates.setOrder(candidate_order_);
+	Q_probbed_candidates.push(mach->macSA(),
+			probeh->n_DATA_pcks_Node_tx(),
+			(double) probeh->backoff_time_PROBE() / 1000,
+			NOW);
 
 	if (debugMio_)
 		out_file_logging << NOW << "uwUFetch_HEAD_NODE(" << addr
@@ -2349,7 +2339,7 @@ uwUFetch_NODE::PROBE_rx()
 
 	Packet::free(curr_PROBE_HN_pck_rx);
 
-	if (Q_probbed_mac_HN.size() == MAX_POLLED_NODE) {
+	if (Q_probbed_candidates.size() == MAX_POLLED_NODE) {
 		// MAXIMUM number of PROBE packet is received by the HN
 
 		if (debug_)
@@ -2402,7 +2392,8 @@ uwUFetch_NODE::state_wait_other_PROBE()
 		std::cout << NOW << " uwUFetch_NODE (" << addr
 				  << ") ::state_wait_other_PROBE() ---->HN is waiting the "
 					 "reception of"
-				  << " PROBE packet number: " << (Q_probbed_mac_HN.size() + 1)
+				  << " PROBE packet number: "
+				  << (Q_probbed_candidates.size() + 1)
 				  << std::endl;
 
 	if (debugMio_)
@@ -2451,18 +2442,16 @@ uwUFetch_NODE::state_POLL_tx()
 	cmh->ptype() = PT_POLL_UFETCH;
 	cmh->size() = sizeof(hdr_POLL_UFETCH);
 
-	mach->set(MF_CONTROL, addr, Q_probbed_mac_HN.front());
+	mach->set(MF_CONTROL, addr, Q_probbed_candidates.front().mac);
 	mach->macSA() = addr;
-	mach->macDA() = Q_probbed_mac_HN.front();
+	mach->macDA() = Q_probbed_candidates.front().mac;
 
 	// Filling the HEADER of the POLL packet
-	if (Q_probbed_n_pcks_NODE_want_tx_HN.front() <=
+	if (Q_probbed_candidates.front().n_pcks <=
 			MAX_PCK_HN_WANT_RX_FROM_NODE) {
-		pollh->num_DATA_pcks_MAX_rx() =
-				Q_probbed_n_pcks_NODE_want_tx_HN.front(); // Maximum number of
-														  // DATA packets that
-														  // the HN want to
-		// receive from the NODE that is being to poll
+		// Maximum number of DATA packets that the HN want to receive from
+		// the NODE that is being to poll
+		pollh->num_DATA_pcks_MAX_rx() = Q_probbed_candidates.front().n_pcks;
 	} else {
 		pollh->num_DATA_pcks_MAX_rx() =
 				MAX_PCK_HN_WANT_RX_FROM_NODE; // Maximum numbero of DATA packets
@@ -2470,13 +2459,9 @@ uwUFetch_NODE::state_POLL_tx()
 		// receive from the NODE that is being to poll
 	}
 	number_data_pck_HN_rx_exact = pollh->num_DATA_pcks_MAX_rx();
-	pollh->mac_addr_Node_polled() =
-			Q_probbed_mac_HN.front(); // Mac address of the NODE that the HN is
-									  // being to poll
-	mac_addr_NODE_polled = Q_probbed_mac_HN.front(); // Store the mac address of
-													 // the NODE that the HN is
-													 // being
-	// to poll
+	// Mac address of the NODE that the HN is being to poll
+	pollh->mac_addr_Node_polled() = Q_probbed_candidates.front().mac;
+	mac_addr_NODE_polled = Q_probbed_candidates.front().mac;
 
 	if (debugMio_)
 		out_file_logging << NOW << "uwUFetch_HEAD_NODE(" << addr
@@ -2661,7 +2646,7 @@ uwUFetch_NODE::DataTOExpired()
 
 	// Verify if another node can be polled, or the HN will start the
 	// transmission of CBEACON
-	if ((Q_probbed_mac_HN.empty()) &&
+	if ((Q_probbed_candidates.empty()) &&
 			(getCBeaconPckTx_by_HN() == MAX_ALLOWED_CBEACON_TX)) {
 		// There aren't another node to poll, and the maximum number of CBEACONS
 		// are transmitted
@@ -2700,7 +2685,7 @@ uwUFetch_NODE::DataTOExpired()
 
 		stateIdle_HN();
 
-	} else if ((Q_probbed_mac_HN.empty()) &&
+	} else if ((Q_probbed_candidates.empty()) &&
 			(getCBeaconPckTx_by_HN() < MAX_ALLOWED_CBEACON_TX)) {
 		// There aren't another node to poll, and the maximum number of CBEACONS
 		// are not transmitted
@@ -2812,13 +2797,11 @@ uwUFetch_NODE::DATA_rx()
 					  << std::endl;
 
 		// save the data packet in the QUEUE of the HN
-		Q_data_HN.push(curr_DATA_HN_pck_rx->copy()); // Save the data packets in
-													 // the QUEUE of the HN
+		Q_data_HN.push(curr_DATA_HN_pck_rx);
 		Q_data_source_SN.push(mac_addr_NODE_in_data); // Save the MAC address
 													  // from which the data
 													  // packet it's arrived.
-
-		Packet::free(curr_DATA_HN_pck_rx);
+		curr_DATA_HN_pck_rx = NULL;
 
 		if (getDataPckRx_by_HN() == number_data_pck_HN_rx_exact) {
 			// Another DATA packet can not be received by the HN
@@ -2854,7 +2837,7 @@ uwUFetch_NODE::DATA_rx()
 
 			// Verify if another node can be polled, or the HN will start the
 			// transmission of CBEACON
-			if ((Q_probbed_mac_HN.empty()) &&
+			if ((Q_probbed_candidates.empty()) &&
 					(getCBeaconPckTx_by_HN() == MAX_ALLOWED_CBEACON_TX)) {
 				// There aren't another node to poll, and the maximum number of
 				// CBEACONS are transmitted
@@ -2888,7 +2871,7 @@ uwUFetch_NODE::DATA_rx()
 
 				stateIdle_HN();
 
-			} else if ((Q_probbed_mac_HN.empty()) &&
+			} else if ((Q_probbed_candidates.empty()) &&
 					(getCBeaconPckTx_by_HN() < MAX_ALLOWED_CBEACON_TX)) {
 				// There aren't another node to poll, and the maximum number of
 				// CBEACONS are not transmitted
@@ -2980,11 +2963,7 @@ void
 uwUFetch_NODE::state_CBEACON_tx()
 {
 
-	while (!Q_probbed_mac_HN.empty()) {
-		Q_probbed_mac_HN.pop();
-		Q_probbed_n_pcks_NODE_want_tx_HN.pop();
-		Q_probbed_backoff_time.pop();
-	}
+	Q_probbed_candidates.clear();
 	// HN transmit a CBEACON packet to the sensor nodes
 	if (debug_)
 		std::cout << NOW << " uwUFetch_NODE (" << addr
@@ -3174,9 +3153,9 @@ uwUFetch_NODE::getDataTimerValue()
 	RTT = getRTT();
 
 	int pck_tx_number = 0;
-	if (Q_probbed_n_pcks_NODE_want_tx_HN.front() <=
+	if (Q_probbed_candidates.front().n_pcks <=
 			MAX_PCK_HN_WANT_RX_FROM_NODE) {
-		pck_tx_number = Q_probbed_n_pcks_NODE_want_tx_HN.front();
+		pck_tx_number = Q_probbed_candidates.front().n_pcks;
 	} else {
 		pck_tx_number = MAX_PCK_HN_WANT_RX_FROM_NODE;
 	}
@@ -3274,9 +3253,7 @@ uwUFetch_NODE::updateListProbbedNode()
 				  << " MAC address: " << mac_addr_NODE_polled
 				  << ", so remove the NODE from the list." << std::endl;
 
-	Q_probbed_mac_HN.pop();
-	Q_probbed_n_pcks_NODE_want_tx_HN.pop();
-	Q_probbed_backoff_time.pop();
+	Q_probbed_candidates.pop();
 
 } // end updateListProbbedNode();
 
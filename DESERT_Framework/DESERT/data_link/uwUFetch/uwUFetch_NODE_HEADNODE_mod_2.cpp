@@ -93,7 +93,7 @@ uwUFetch_NODE::Phy2MacEndRx_HN_without(Packet *p)
 				while ((!Q_data.empty()) &&
 						(index_q <= MAX_PCK_HN_WANT_RX_FROM_NODE)) {
 					// Pick up the first element of the queue
-					curr_DATA_NODE_pck_tx_HN = (Q_data.front())->copy();
+					curr_DATA_NODE_pck_tx_HN = Q_data.front();
 					// Remove the element from the queue that we have pick up
 					// the packet
 					Q_data.pop();
@@ -272,15 +272,13 @@ uwUFetch_NODE::Phy2MacEndRx_HN_without(Packet *p)
 								 "by the HN"
 							  << " is corrupted: DROP IT" << std::endl;
 
-				curr_DATA_HN_pck_rx = p->copy();
-
 				rx_DATA_finish_HN_time = NOW;
 
 				incrDataPckRx_by_HN();
 				incrTotalDataPckRx_by_HN();
 				incrTotalDataPckRx_corrupted_by_HN();
 
-				hdr_uwcbr *cbrh = HDR_UWCBR(curr_DATA_HN_pck_rx);
+				hdr_uwcbr *cbrh = HDR_UWCBR(p);
 
 				if (debugMio_)
 					out_file_logging << NOW << "uwUFetch_HEAD_NODE(" << addr
@@ -311,12 +309,10 @@ uwUFetch_NODE::Phy2MacEndRx_HN_without(Packet *p)
 				incrDataPckRx_by_HN();
 				incrTotalDataPckRx_by_HN();
 
-				curr_DATA_HN_pck_rx = p->copy();
+				curr_DATA_HN_pck_rx = p;
 
 				refreshReason(UWUFETCH_NODE_STATUS_CHANGE_DATA_RX);
 
-				Packet::free(p);
-
 				DATA_rx();
 			}
 		}
@@ -588,7 +584,7 @@ uwUFetch_NODE::state_DATA_HN_first_tx_without()
 				  << mac_addr_AUV_in_trigger << std::endl;
 
 	// Pick up the first element of the queue
-	curr_DATA_HN_pck_tx = (Q_data_HN.front())->copy();
+	curr_DATA_HN_pck_tx = Q_data_HN.front();
 	// Remove the element from the queue that we have pick up
 	Q_data_HN.pop();
 
@@ -686,7 +682,7 @@ uwUFetch_NODE::state_DATA_HN_tx_without()
 				  << " MAC address: " << mac_addr_AUV_in_trigger << std::endl;
 
 	// Pick up the first element of the queue
-	curr_DATA_HN_pck_tx = (Q_data_HN.front())->copy();
+	curr_DATA_HN_pck_tx = Q_data_HN.front();
 	// Remove the element from the queue that we have pick up
 	Q_data_HN.pop();
 
@@ -257,6 +257,7 @@ uwUFetch_NODE::uwUFetch_NODE()
 	bind("TIME_TO_WAIT_CTS_", (double *) &T_CTS);
 	bind("MODE_COMM_", (int *) &MODE_COMM_HN_AUV);
 	bind("BURST_DATA_", (int *) &MODE_BURST_DATA);
+	bind("CANDIDATE_ORDER_", (int *) &candidate_order_);
 } // end uwUFetch_NODE()
 
 int
@@ -2226,7 +2227,7 @@ uwUFetch_NODE::state_DATA_NODE_first_tx()
 				  << mac_addr_HN_in_poll << std::endl;
 
 	// Pick up the first element of the queue
-	curr_DATA_NODE_pck_tx = (Q_data.front())->copy();
+	curr_DATA_NODE_pck_tx = Q_data.front();
 	// Remove the element from the queue that we have pick up the packet
 	Q_data.pop();
 
@@ -2302,7 +2303,7 @@ uwUFetch_NODE::state_DATA_NODE_tx()
 				  << " address: " << mac_addr_HN_in_poll << std::endl;
 
 	// Pick up the first element of the queue
-	curr_DATA_NODE_pck_tx = (Q_data.front())->copy();
+	curr_DATA_NODE_pck_tx = Q_data.front();
 	// Remove the element from the queue that we have pick up the packet
 	Q_data.pop();
 
@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file    uwUFetch_candidates.h
+ * @author DESERT contributors
+ * @version 1.0.0
+ *
+ * \brief	Queue of the nodes that asked to be served, i.e., the HNs that sent
+ * a RTS to the AUV or the SNs that sent a PROBE to the HN.
+ */
+
+#ifndef UWUFETCH_CANDIDATES_H
+#define UWUFETCH_CANDIDATES_H
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Order in which the candidates are served.
+ */
+enum UWUFETCH_CANDIDATE_ORDER {
+	UWUFETCH_CANDIDATE_ORDER_ARRIVAL = 0, /**< Order of reception. */
+	UWUFETCH_CANDIDATE_ORDER_BACKOFF /**< Shortest backoff first. */
+};
+
+/**
+ * Node that asked to be served, with the information carried by its RTS or
+ * PROBE packet.
+ */
+struct uwUFetch_candidate {
+	int mac; /**< MAC address of the node. */
+	int n_pcks; /**< Number of DATA packets the node wants to transmit. */
+	double backoff; /**< Backoff time chosen by the node [s]. */
+	double arrival; /**< Time of reception of the request [s]. */
+	unsigned long seq; /**< Reception order, breaks ties. */
+};
+
+/**
+ * Priority queue of uwUFetch_candidate, replacing the parallel queues of MAC
+ * addresses, number of packets and backoff times.
+ */
+class uwUFetch_candidate_queue
+{
+public:
+	uwUFetch_candidate_queue()
+		: order_(UWUFETCH_CANDIDATE_ORDER_ARRIVAL)
+		, seq_(0)
+	{
+	}
+
+	/**
+	 * Sets the order in which the candidates are served. To be called while
+	 * the queue is empty.
+	 */
+	inline void
+	setOrder(int order)
+	{
+		order_ = (order == UWUFETCH_CANDIDATE_ORDER_BACKOFF)
+				? UWUFETCH_CANDIDATE_ORDER_BACKOFF
+				: UWUFETCH_CANDIDATE_ORDER_ARRIVAL;
+	}
+
+	/**
+	 * Adds a candidate.
+	 *
+	 * @param mac MAC address of the node
+	 * @param n_pcks number of DATA packets the node wants to transmit
+	 * @param backoff backoff time chosen by the node [s]
+	 * @param arrival time of reception of the request [s]
+	 */
+	void
+	push(int mac, int n_pcks, double backoff, double arrival)
+	{
+		uwUFetch_candidate c;
+		c.mac = mac;
+		c.n_pcks = n_pcks;
+		c.backoff = backoff;
+		c.arrival = arrival;
+		c.seq = seq_++;
+		heap_.push_back(c);
+		std::push_heap(heap_.begin(), heap_.end(), later(order_));
+	}
+
+	/**
+	 * @return the next candidate to serve; the queue must not be empty
+	 */
+	inline const uwUFetch_candidate &
+	front() const
+	{
+		return heap_.front();
+	}
+
+	/**
+	 * Removes the next candidate to serve.
+	 */
+	void
+	pop()
+	{
+		std::pop_heap(heap_.begin(), heap_.end(), later(order_));
+		heap_.pop_back();
+	}
+
+	/**
+	 * Removes all the candidates, keeping the allocated storage.
+	 */
+	inline void
+	clear()
+	{
+		heap_.clear();
+		seq_ = 0;
+	}
+
+	inline bool
+	empty() const
+	{
+		return heap_.empty();
+	}
+
+	inline size_t
+	size() const
+	{
+		return heap_.size();
+	}
+
+private:
+	/**
+	 * Heap comparator: true if <i>a</i> has to be served after <i>b</i>.
+	 */
+	struct later {
+		UWUFETCH_CANDIDATE_ORDER order;
+
+		later(UWUFETCH_CANDIDATE_ORDER o)
+			: order(o)
+		{
+		}
+
+		bool
+		operator()(const uwUFetch_candidate &a,
+				const uwUFetch_candidate &b) const
+		{
+			if (order == UWUFETCH_CANDIDATE_ORDER_BACKOFF &&
+					a.backoff != b.backoff)
+				return a.backoff > b.backoff;
+			return a.seq > b.seq;
+		}
+	};
+
+	UWUFETCH_CANDIDATE_ORDER order_; /**< Order of service. */
+	unsigned long seq_; /**< Sequence number of the next candidate. */
+	std::vector<uwUFetch_candidate> heap_; /**< Binary heap of candidates. */
+};
+
+#endif
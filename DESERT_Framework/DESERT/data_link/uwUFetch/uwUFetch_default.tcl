@@ -59,6 +59,8 @@ PacketHeaderManager set tab_(PacketHeader/CBEACON_UFETCH) 1
 															           ;#1=without RTS & CTS
 	Module/UW/UFETCH/NODE set  BURST_DATA_                           0 ;#0=without burst data
 															           ;#1=with burst data
+	Module/UW/UFETCH/NODE set  CANDIDATE_ORDER_                      0 ;#0=poll the SNs in order of PROBE reception
+															           ;#1=poll first the SN with the shortest backoff
 
 	Module/UW/UFETCH/AUV    set T_min_RTS_                              1.0  ;# Lower Bound of time interval in which head node choice the backoff before to transmit a RTS packet
     Module/UW/UFETCH/AUV    set T_max_RTS_                              5.0  ;# Upper Bound of time interval in which head node choice the backoff before to transmit a RTS packet
@@ -79,4 +81,6 @@ PacketHeaderManager set tab_(PacketHeader/CBEACON_UFETCH) 1
 	Module/UW/UFETCH/AUV    set NUM_HN_NETWORK_ 					    4	
     Module/UW/UFETCH/AUV    set MODE_COMM_ 							    0 ;#0=with RTS & CTS
 															              ;#1=without RTS & CTS
+    Module/UW/UFETCH/AUV    set CANDIDATE_ORDER_ 					    0 ;#0=serve the HNs in order of RTS reception
+															              ;#1=serve first the HN with the shortest backoff
 
@@ -373,6 +373,9 @@ MMacDACAP::MMacDACAP()
 	, last_reason(NOT_SET)
 	, backoff_first_start(NOT_SET)
 	, curr_data_pkt(0)
+	, tx_time_pkt(0)
+	, tx_time_cache()
+	, wait_time_cache()
 	, TxActive(false)
 	, RxActive(false)
 	, defer_data(false)
@@ -437,6 +440,8 @@ MMacDACAP::MMacDACAP()
 
 MMacDACAP::~MMacDACAP()
 {
+	if (tx_time_pkt)
+		Packet::free(tx_time_pkt);
 }
 
 // TCL command interpreter
@@ -593,40 +598,37 @@ MMacDACAP::initInfo()
 double
 MMacDACAP::computeTxTime(int type)
 {
-
-	double duration;
-	Packet *temp_data_pkt;
+	int size = 0;
 
 	if (type == DATA_PKT) {
-		if (!Q.empty()) {
-			temp_data_pkt = (Q.front())->copy();
-			hdr_cmn *ch = HDR_CMN(temp_data_pkt);
-			ch->size() = HDR_size + ch->size();
-		} else {
-			temp_data_pkt = Packet::alloc();
-			hdr_cmn *ch = HDR_CMN(temp_data_pkt);
-			ch->size() = HDR_size + max_payload;
-		}
+		if (!Q.empty())
+			size = HDR_size + HDR_CMN(Q.front())->size();
+		else
+			size = HDR_size + max_payload;
 	} else if (type == RTS_PKT) {
-		temp_data_pkt = Packet::alloc();
-		hdr_cmn *ch = HDR_CMN(temp_data_pkt);
-		ch->size() = RTS_size;
+		size = RTS_size;
 	} else if (type == CTS_PKT) {
-		temp_data_pkt = Packet::alloc();
-		hdr_cmn *ch = HDR_CMN(temp_data_pkt);
-		ch->size() = CTS_size;
+		size = CTS_size;
 	} else if (type == ACK_PKT) {
-		temp_data_pkt = Packet::alloc();
-		hdr_cmn *ch = HDR_CMN(temp_data_pkt);
-		ch->size() = ACK_size;
+		size = ACK_size;
 	} else if (type == WRN_PKT) {
-		temp_data_pkt = Packet::alloc();
-		hdr_cmn *ch = HDR_CMN(temp_data_pkt);
-		ch->size() = WRN_size;
+		size = WRN_size;
 	}
-	duration = Mac2PhyTxDuration(temp_data_pkt);
-	Packet::free(temp_data_pkt);
-	return (duration);
+
+	map<int, TxTimeEntry>::iterator it = tx_time_cache.find(type);
+	if (it != tx_time_cache.end() && it->second.size == size)
+		return (it->second.duration);
+
+	if (!tx_time_pkt) {
+		tx_time_pkt = Packet::alloc();
+		HDR_CMN(tx_time_pkt)->ptype() = PT_DACAP;
+	}
+	HDR_CMN(tx_time_pkt)->size() = size;
+
+	TxTimeEntry &entry = tx_time_cache[type];
+	entry.size = size;
+	entry.duration = Mac2PhyTxDuration(tx_time_pkt);
+	return (entry.duration);
 }
 
 double
@@ -674,6 +676,24 @@ MMacDACAP::computeWaitTime(int mode, double distance)
 	return (T_w);
 }
 
+double
+MMacDACAP::getWaitTime(int mac_addr, double distance)
+{
+	double t_data = computeTxTime(DATA_PKT);
+
+	map<int, WaitTimeEntry>::iterator it = wait_time_cache.find(mac_addr);
+	if (it != wait_time_cache.end() && it->second.distance == distance &&
+			it->second.t_data == t_data && it->second.mode == op_mode)
+		return (it->second.T_w);
+
+	WaitTimeEntry &entry = wait_time_cache[mac_addr];
+	entry.distance = distance;
+	entry.t_data = t_data;
+	entry.mode = op_mode;
+	entry.T_w = computeWaitTime(op_mode, distance);
+	return (entry.T_w);
+}
+
 inline void
 MMacDACAP::exitBackoff()
 {
@@ -1090,10 +1110,17 @@ MMacDACAP::txAck()
 void
 MMacDACAP::txData()
 {
-	Packet *data_pkt = (Q.front())->copy();
+	Packet *data_pkt;
 
-	if ((op_mode == NO_ACK_MODE))
-		queuePop(true);
+	if ((op_mode == NO_ACK_MODE)) {
+		// no retransmissions: the queued packet itself goes down
+		data_pkt = Q.front();
+		Q.pop();
+		waitEndTime(true);
+	} else {
+		// kept in the queue until ACKed or dropped
+		data_pkt = (Q.front())->copy();
+	}
 
 	incrDataPktsTx();
 	Mac2PhyStartTx(data_pkt);
@@ -2070,7 +2097,7 @@ MMacDACAP::stateWaitXData()
 	printStateInfo();
 
 	timer.resched(2.0 * max_prop_delay + computeTxTime(DATA_PKT) +
-			computeWaitTime(op_mode, ((max_prop_delay * 2.0) * 1500.0)));
+			getWaitTime(NOT_SET, (max_prop_delay * 2.0) * 1500.0));
 }
 
 void
@@ -2156,7 +2183,7 @@ MMacDACAP::stateWaitData()
 	printStateInfo();
 
 	timer.resched(2.0 * max_prop_delay + computeTxTime(DATA_PKT) +
-			computeWaitTime(op_mode, (max_prop_delay * 2.0) * 1500.0) +
+			getWaitTime(NOT_SET, (max_prop_delay * 2.0) * 1500.0) +
 			wait_costant);
 }
 
@@ -2179,7 +2206,7 @@ MMacDACAP::stateDeferData()
 	refreshState(STATE_DEFER_DATA);
 	incrTotalDeferTimes();
 
-	double defer_delay = computeWaitTime(op_mode, session_distance);
+	double defer_delay = getWaitTime(curr_dest_addr, session_distance);
 	deferEndTime(defer_delay);
 
 	if (debug_) {
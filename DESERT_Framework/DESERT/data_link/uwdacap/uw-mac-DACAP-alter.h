@@ -226,10 +226,21 @@ protected:
 	 *
 	 */
 	virtual double computeWaitTime(int mode, double distance);
+	/**
+	 * Returns the T_w parameter for a neighbour, computing it again only if
+	 * the distance measured for that neighbour, the DATA tx duration or the
+	 * mode changed since the last call
+	 *
+	 * @param mac_addr MAC address of the neighbour
+	 * @param distance between the sender and the neighbour
+	 * @return double the value of T_w
+	 */
+	virtual double getWaitTime(int mac_addr, double distance);
 	/**
 	 * Computes the time that is needed to transmit a packet, implementing a
 	 * CrLayMessage for asking
-	 * the PHY layer to perform this calculation
+	 * the PHY layer to perform this calculation. The PHY is asked again only
+	 * when the size of the packet type changes.
 	 *
 	 * @param type of the packet
 	 * @return double the time needed for transmission in seconds
@@ -820,6 +831,27 @@ protected:
 
 	Packet *curr_data_pkt; /**< Pointer to the current data packet */
 
+	/**
+	 * Transmission time of a packet type
+	 */
+	struct TxTimeEntry {
+		int size; /**< Size of the packet, bytes */
+		double duration; /**< Transmission time returned by the PHY */
+	};
+	/**
+	 * T_w computed for a neighbour
+	 */
+	struct WaitTimeEntry {
+		double distance; /**< Distance of the neighbour */
+		double t_data; /**< DATA transmission time */
+		int mode; /**< ACK or NO_ACK mode */
+		double T_w; /**< Resulting T_w */
+	};
+
+	Packet *tx_time_pkt; /**< Packet used only to ask the PHY the tx times */
+	map<int, TxTimeEntry> tx_time_cache; /**< Tx times by packet type */
+	map<int, WaitTimeEntry> wait_time_cache; /**< T_w by neighbour address */
+
 	int last_data_id_tx; /**< Unique ID of the last data packet transmitted */
 	int last_data_id_rx; /**< Unique ID of the last data packet received */
 
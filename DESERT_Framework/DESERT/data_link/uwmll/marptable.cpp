@@ -51,21 +51,47 @@ UWARPTable::~UWARPTable()
 {
 }
 
+bool
+UWARPTable::addEntry(nsaddr_t addr, int mac)
+{
+	UWARPEntry *e = getEntry(addr);
+	if (!e)
+		return false;
+	e->state_ = UWARP_STATIC;
+	e->macaddr_ = mac;
+	e->expire_ = 0;
+	return true;
+}
+
+void
+UWARPTable::learnEntry(nsaddr_t addr, int mac, double expire)
+{
+	UWARPEntry *e = getEntry(addr);
+	if (!e || e->state_ == UWARP_STATIC)
+		return;
+	e->state_ = UWARP_LEARNT;
+	e->macaddr_ = mac;
+	e->expire_ = expire;
+}
+
 void
-UWARPTable::addEntry(UWARPEntry *entry)
+UWARPTable::setNegative(nsaddr_t addr, double expire)
 {
-	table_[entry->ipaddr_] = entry;
+	UWARPEntry *e = getEntry(addr);
+	if (!e || e->state_ == UWARP_STATIC)
+		return;
+	e->state_ = UWARP_NEGATIVE;
+	e->expire_ = expire;
 }
 
 UWARPEntry *
-UWARPTable::lookup(nsaddr_t addr)
+UWARPTable::getEntry(nsaddr_t addr)
 {
-	map<nsaddr_t, UWARPEntry *>::iterator it;
-	it = table_.find(addr);
-	if (it != table_.end())
-		return it->second;
-	else
+	if (addr < 0 || addr > UWARP_MAX_ADDR)
 		return 0;
+	if ((size_t) addr >= table_.size())
+		table_.resize(addr + 1);
+	return &table_[addr];
 }
 
 void
@@ -45,7 +45,7 @@
 #define UW_ARPTABLE_H
 
 #include <packet.h>
-#include <map>
+#include <vector>
 
 #ifndef EADDRNOTAVAIL
 #define EADDRNOTAVAIL 125
@@ -57,39 +57,44 @@
 
 #define ARP_MAX_REQUEST_COUNT 3
 
+/** Highest network address that can be stored in the ARP table */
+#define UWARP_MAX_ADDR 0xffff
+
+/**
+ * State of an ARP table entry
+ */
+enum UWARP_STATE {
+	UWARP_FREE = 0, /**< No information about the address. */
+	UWARP_STATIC, /**< Set from Tcl, never expires. */
+	UWARP_LEARNT, /**< Learnt from the received traffic. */
+	UWARP_NEGATIVE /**< Address that could not be resolved. */
+};
+
 /**
  * ARP table entry
  */
 class UWARPEntry
 {
 public:
-	/**
-	 * Constructor
-	 * @param dst Destination network address
-	 */
-	UWARPEntry(nsaddr_t dst)
-		: up_(0)
+	/** Constructor */
+	UWARPEntry()
+		: state_(UWARP_FREE)
 		, macaddr_(0)
-		, ipaddr_(dst)
-		, hold_(0)
-		, count_(0)
+		, expire_(0)
 	{
 	}
 
-	/** Is address up? */
-	int up_;
-	/** network address */
-	nsaddr_t ipaddr_;
+	/** State of the entry, see UWARP_STATE */
+	int state_;
 	/** mac address */
 	int macaddr_;
-	/** cached packet */
-	Packet *hold_;
-	/** Number of tries */
-	int count_;
+	/** Expiration time of a learnt or negative entry, 0 if it never expires */
+	double expire_;
 };
 
 /**
- * ARP table
+ * ARP table, stored as a vector of entries indexed by network address. The
+ * vector grows up to the highest address inserted.
  */
 class UWARPTable
 {
@@ -100,17 +105,41 @@ public:
 	~UWARPTable();
 
 	/**
-	 * Add entry to ARP table
-	 * @param entry UWARPEntry to add
+	 * Add a static entry to ARP table
+	 * @param addr network address
+	 * @param mac mac address
+	 * @return false if the address is out of range
 	 */
-	void addEntry(UWARPEntry *entry);
+	bool addEntry(nsaddr_t addr, int mac);
+
+	/**
+	 * Add a learnt entry to ARP table. Static entries are not overwritten.
+	 * @param addr network address
+	 * @param mac mac address
+	 * @param expire expiration time, 0 if it never expires
+	 */
+	void learnEntry(nsaddr_t addr, int mac, double expire);
+
+	/**
+	 * Mark an address as not resolvable. Static entries are not overwritten.
+	 * @param addr network address
+	 * @param expire expiration time, 0 if it never expires
+	 */
+	void setNegative(nsaddr_t addr, double expire);
 
 	/**
 	 * Lookup entry in table
 	 * @param addr network address to look for
-	 * @return If entry found, a pointer to an UWARPEntry, else null
+	 * @return If addr is in the range of the table, a pointer to its
+	 * UWARPEntry (possibly UWARP_FREE), else null
 	 */
-	UWARPEntry *lookup(nsaddr_t addr);
+	inline const UWARPEntry *
+	lookup(nsaddr_t addr) const
+	{
+		if (addr < 0 || (size_t) addr >= table_.size())
+			return 0;
+		return &table_[addr];
+	}
 
 	/**
 	 * Remove all entries in table
@@ -118,8 +147,15 @@ public:
 	void clear();
 
 private:
-	/** The ARP table as an associative array */
-	map<nsaddr_t, UWARPEntry *> table_;
+	/**
+	 * Return the entry of the given address, growing the table if needed
+	 * @param addr network address
+	 * @return pointer to the entry, null if addr is out of range
+	 */
+	UWARPEntry *getEntry(nsaddr_t addr);
+
+	/** The ARP table, indexed by network address */
+	std::vector<UWARPEntry> table_;
 };
 
 #endif /* ARPTABLE_H */
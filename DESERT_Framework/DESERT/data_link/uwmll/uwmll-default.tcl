@@ -37,3 +37,6 @@
 
 Module/UW/MLL set debug_                 0
 Module/UW/MLL set enable_addr_copy_      0
+Module/UW/MLL set learn_arp_             0
+Module/UW/MLL set arp_timeout_           0
+Module/UW/MLL set arp_neg_timeout_       0
@@ -74,13 +74,20 @@ public:
 UWMllModule::UWMllModule()
 	: seqno_(0)
 	, n_arp_pkt_drop(0)
+	, learn_arp_(0)
+	, arp_timeout_(0)
+	, arp_neg_timeout_(0)
 {
 	arptable_ = new UWARPTable();
 	bind("enable_addr_copy_", (int *) &enable_addr_copy);
+	bind("learn_arp_", (int *) &learn_arp_);
+	bind("arp_timeout_", (double *) &arp_timeout_);
+	bind("arp_neg_timeout_", (double *) &arp_neg_timeout_);
 }
 
 UWMllModule::~UWMllModule()
 {
+	delete arptable_;
 }
 
 int
@@ -116,11 +123,12 @@ UWMllModule::command(int argc, const char *const *argv)
 	}
 	if (argc == 4) {
 		if (strcasecmp(argv[1], "addentry") == 0) {
-			nsaddr_t ipaddr = atoi(argv[2]);
-			UWARPEntry *e = new UWARPEntry(ipaddr);
-			e->macaddr_ = atoi(argv[3]);
-			e->up_ = 1;
-			arptable_->addEntry(e);
+			if (!arptable_->addEntry(atoi(argv[2]), atoi(argv[3]))) {
+				fprintf(stderr,
+						"UWMllModule::addentry: IP address %s out of range\n",
+						argv[2]);
+				return TCL_ERROR;
+			}
 			return TCL_OK;
 		}
 	}
@@ -205,6 +213,10 @@ UWMllModule::sendDown(Packet *p)
 		Module::sendDown(p);
 	} else {
 		if (enable_addr_copy == 0) {
+			if (tx == UWMLL_ARP_NEGATIVE_HIT) {
+				drop(p, 1, UWMLL_DROP_REASON_NOT_IN_ARP_LIST);
+				return;
+			}
 			std::cerr << NOW << "Node(" << mh->macSA()
 					  << ")::UwMLL_Module -> WARNING: Entry not found for IP "
 						 "address "
@@ -220,21 +232,46 @@ UWMllModule::sendDown(Packet *p)
 int
 UWMllModule::arpResolve(nsaddr_t dst, Packet *p)
 {
-	hdr_mac *mh = HDR_MAC(p);
-	UWARPEntry *llinfo;
-	llinfo = arptable_->lookup(dst);
+	const UWARPEntry *llinfo = arptable_->lookup(dst);
 
-	// Found entry, set dest and return
-	if (llinfo && llinfo->up_) {
-		mh->macDA() = llinfo->macaddr_;
-		return 0;
+	if (llinfo) {
+		switch (llinfo->state_) {
+			case UWARP_LEARNT:
+				if (llinfo->expire_ > 0 && NOW >= llinfo->expire_)
+					break;
+			// Fall through
+			case UWARP_STATIC:
+				// Found entry, set dest and return
+				HDR_MAC(p)->macDA() = llinfo->macaddr_;
+				return 0;
+			case UWARP_NEGATIVE:
+				if (llinfo->expire_ == 0 || NOW < llinfo->expire_)
+					return UWMLL_ARP_NEGATIVE_HIT;
+				break;
+		}
 	}
+	arptable_->setNegative(
+			dst, arp_neg_timeout_ > 0 ? NOW + arp_neg_timeout_ : 0);
 	return EADDRNOTAVAIL;
 }
 
+void
+UWMllModule::arpLearn(Packet *p)
+{
+	if (!learn_arp_)
+		return;
+	nsaddr_t src = HDR_UWIP(p)->saddr();
+	int mac = HDR_MAC(p)->macSA();
+	if (src == 0 || src == UWIP_BROADCAST || mac == MAC_BROADCAST)
+		return;
+	arptable_->learnEntry(
+			src, mac, arp_timeout_ > 0 ? NOW + arp_timeout_ : 0);
+}
+
 void
 UWMllModule::sendUp(Packet *p)
 {
+	arpLearn(p);
 	Module::sendUp(p);
 }
 
@@ -58,6 +58,9 @@
 
 #define UWMLL_DROP_REASON_NOT_IN_ARP_LIST "NAL"
 
+/** Error returned by arpResolve for an address already known as unresolved */
+#define UWMLL_ARP_NEGATIVE_HIT (-EADDRNOTAVAIL)
+
 /**
  * Module for ARP-resolve.
  * Should live between one or more IPModule and one MMacModule
@@ -114,10 +117,17 @@ protected:
 	 * Resolve MAC address for given dst address
 	 * @param dst IP destination address
 	 * @param p packet which requested the resolv, will be cached
-	 * @return 0 if ARP request successfully sent, otherwise some error number
+	 * @return 0 if ARP request successfully sent, UWMLL_ARP_NEGATIVE_HIT if
+	 * dst is in the negative cache, otherwise some error number
 	 */
 	virtual int arpResolve(nsaddr_t dst, Packet *p);
 
+	/**
+	 * Learn the ARP entry of the source of a received packet, if enabled
+	 * @param p received packet
+	 */
+	virtual void arpLearn(Packet *p);
+
 	inline void
 	incrArpPktDrop()
 	{
@@ -144,6 +154,15 @@ protected:
 	int enable_addr_copy; /** enable the copy of the IP address as MAC address
 							 */
 	/** valid only if MAC_ADDR = IP on the node*/
+
+	int learn_arp_; /**< If 1, the pair (IP source, MAC source) of the
+					   received packets is added to the ARP table. Valid only
+					   if the IP source is a neighbour, e.g., single hop. */
+	double arp_timeout_; /**< Lifetime of the learnt entries [s], 0 for no
+							aging. */
+	double arp_neg_timeout_; /**< Lifetime of the negative entries [s], 0 if
+								they expire only when the address is added or
+								learnt. */
 };
 
 #endif
@@ -73,6 +73,58 @@ public:
 	}
 } class_module_uwpolling_auv;
 
+ProbbedNodeQueue::ProbbedNodeQueue()
+	: heap_()
+	, next_order_(0)
+{
+}
+
+void
+ProbbedNodeQueue::push(const probbed_node &node)
+{
+	entry e;
+	e.node = node;
+	e.weight = node.policy_weight;
+	e.order = next_order_;
+	next_order_ += 2;
+	heap_.push_back(e);
+	std::push_heap(heap_.begin(), heap_.end(), pollAfter);
+}
+
+void
+ProbbedNodeQueue::pushSink(const probbed_node &sink, uint n_pkts, uint max_pkts)
+{
+	entry e;
+	e.node = sink;
+	e.weight = DBL_MAX; // first of all, if no node has to be polled before
+	e.order = -1;
+	std::vector<entry> pending(heap_);
+	while (!pending.empty() && n_pkts <= max_pkts) {
+		std::pop_heap(pending.begin(), pending.end(), pollAfter);
+		const entry &prev = pending.back();
+		n_pkts += prev.node.n_pkts;
+		e.weight = prev.weight;
+		e.order = prev.order + 1;
+		pending.pop_back();
+	}
+	heap_.push_back(e);
+	std::push_heap(heap_.begin(), heap_.end(), pollAfter);
+}
+
+void
+ProbbedNodeQueue::pop()
+{
+	std::pop_heap(heap_.begin(), heap_.end(), pollAfter);
+	heap_.pop_back();
+}
+
+void
+ProbbedNodeQueue::clear()
+{
+	heap_.clear();
+	next_order_ = 0;
+}
+
 Uwpolling_AUV::~Uwpolling_AUV()
 {
 }
@@ -801,7 +853,7 @@ Uwpolling_AUV::ChangeNodePolled()
 		std::cout << getEpoch() << "::" << NOW << "::Uwpolling_AUV(" << addr
 				  << ")::CHANGE_NODE_POLLED::" << std::endl;
 	if (polling_index > 1) {
-		list_probbed_node.erase(list_probbed_node.begin());
+		list_probbed_node.pop();
 		polling_index--;
 		TxEnabled = true;
 		stateTx();
@@ -956,24 +1008,16 @@ Uwpolling_AUV::SortNode2Poll()
 	/**ELEMENTS SHOULD BE ORDERED, ONLY NEED TO INSERT SINK IN THE RIGHT POSITION*/
 	uint n_pkts = tx_buffer.size() + temp_buffer.size();
 	if (!sink_inserted) {
-		std::vector<probbed_node>::iterator it = list_probbed_node.begin();
-		for(; it!= list_probbed_node.end(); it++) {
-			if (n_pkts > max_tx_pkts)
-				break;
-			n_pkts += (*it).n_pkts;
-		}
-		list_probbed_node.insert(it,probbed_sink);
+		list_probbed_node.pushSink(probbed_sink, n_pkts, max_tx_pkts);
 		sink_inserted = true;
 	}
-	std::vector<probbed_node>::iterator it = list_probbed_node.begin();
-	
 
 	if (!list_probbed_node.empty()){
-		curr_polled_node_address = list_probbed_node[0].mac_address;
-		N_expected_pkt = list_probbed_node[0].n_pkts;
-		curr_Tmeasured = list_probbed_node[0].Tmeasured;
-		curr_node_id = list_probbed_node[0].id_node;
-		curr_is_sink = list_probbed_node[0].is_sink_;
+		curr_polled_node_address = list_probbed_node.front().mac_address;
+		N_expected_pkt = list_probbed_node.front().n_pkts;
+		curr_Tmeasured = list_probbed_node.front().Tmeasured;
+		curr_node_id = list_probbed_node.front().id_node;
+		curr_is_sink = list_probbed_node.front().is_sink_;
 	}
 }
 
@@ -1228,11 +1272,10 @@ void
 Uwpolling_AUV::handleAck()
 {
 	hdr_ACK_SINK* ackh = HDR_ACK_SINK(curr_ack_packet);
-	std::vector<uint16_t> & ack_list = ackh->id_ack();
 
 	Packet* front_p = temp_buffer.back();
 	hdr_AUV_MULE* auvh_tmp = HDR_AUV_MULE(front_p);
-	if (ack_list.front() == auvh_tmp->pkt_uid()+1) {
+	if (ackh->n_ack() > 0 && ackh->id_ack(0) == auvh_tmp->pkt_uid()+1) {
 		if (debug_)
 			std::cout << getEpoch() << "::" << NOW << "::Uwpolling_AUV(" << addr 
 					<< ")::handleAck()::NO_ERROR" << std::endl;
@@ -1243,8 +1286,7 @@ Uwpolling_AUV::handleAck()
 			Packet* p = temp_buffer.back();
 			temp_buffer.pop_back();
 			hdr_AUV_MULE* auvh = HDR_AUV_MULE(p);
-			if(std::find(ack_list.begin(),ack_list.end(),auvh->pkt_uid()) 
-					!= ack_list.end()) {
+			if (ackh->hasAck(auvh->pkt_uid())) {
 				if (debug_)
 					std::cout << getEpoch() << "::" << NOW << "::Uwpolling_AUV(" << addr 
 						<< ")::handleAck()::RX_ACK,PKT_ID" 
@@ -1322,13 +1364,7 @@ Uwpolling_AUV::addNode2List()
 	} else { //never received a packet form this node
 		new_node.policy_weight = DBL_MAX; //MAX PRIORITY
 	}
-	std::vector<probbed_node>::iterator it = list_probbed_node.begin();
-	for (;it != list_probbed_node.end(); it++) {
-		if ((*it).policy_weight < new_node.policy_weight) {
-			break;
-		}
-	}
-	list_probbed_node.insert(it,new_node);
+	list_probbed_node.push(new_node);
 	polling_index ++;
 }
 
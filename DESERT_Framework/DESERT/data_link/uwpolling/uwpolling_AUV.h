@@ -48,6 +48,7 @@
 #include <map>
 #include <set>
 #include <queue>
+#include <vector>
 #include <fstream>
 #include <ostream>
 #include <chrono>
@@ -175,6 +176,107 @@ typedef struct probbed_node {
 
 } probbed_node;
 
+/**
+ * Priority queue of the nodes to POLL, kept as a binary heap. Nodes are
+ * polled by decreasing policy_weight and, among equal weights, in the order
+ * in which their PROBE has been received. Insertions and removals of the
+ * next node to poll cost O(log n).
+ */
+class ProbbedNodeQueue
+{
+public:
+	/**
+	 * Constructor of the ProbbedNodeQueue class
+	 */
+	ProbbedNodeQueue();
+
+	/**
+	 * Inserts a node using its policy_weight as priority
+	 * @param node node to insert
+	 */
+	void push(const probbed_node &node);
+
+	/**
+	 * Inserts the sink after the first nodes in polling order, stopping as
+	 * soon as the number of packets accumulated exceeds <i>max_pkts</i>
+	 * @param sink element with the sink probe data
+	 * @param n_pkts packets already scheduled, i.e., in the AUV buffer
+	 * @param max_pkts maximum number of packets the AUV can transmit
+	 */
+	void pushSink(const probbed_node &sink, uint n_pkts, uint max_pkts);
+
+	/**
+	 * Removes the next node to poll
+	 */
+	void pop();
+
+	/**
+	 * @return reference to the next node to poll
+	 */
+	const probbed_node &
+	front() const
+	{
+		return (heap_[0].node);
+	}
+
+	/**
+	 * Removes all the nodes
+	 */
+	void clear();
+
+	/**
+	 * @return true if no node is stored
+	 */
+	bool
+	empty() const
+	{
+		return (heap_.empty());
+	}
+
+	/**
+	 * @return number of stored nodes
+	 */
+	uint
+	size() const
+	{
+		return (heap_.size());
+	}
+
+	/**
+	 * Access to the i-th stored node, in heap order and not in polling order
+	 * @param i index of the node, lower than size()
+	 */
+	const probbed_node &
+	operator[](uint i) const
+	{
+		return (heap_[i].node);
+	}
+
+private:
+	/** Element of the heap */
+	struct entry {
+		probbed_node node; /**< Node data */
+		double weight; /**< Priority, higher first */
+		long order; /**< Tie breaker, lower first */
+	};
+
+	/**
+	 * Heap comparator
+	 * @return true if <i>a</i> has to be polled after <i>b</i>
+	 */
+	static bool
+	pollAfter(const entry &a, const entry &b)
+	{
+		if (a.weight != b.weight)
+			return (a.weight < b.weight);
+		return (a.order > b.order);
+	}
+
+	std::vector<entry> heap_; /**< Binary heap of the nodes */
+	long next_order_; /**< Tie breaker of the next pushed node, always even so
+						 that the sink can be placed between two nodes */
+};
+
 /**
  * Class used to represent the UWPOLLING MAC layer of the AUV
  */
@@ -1011,8 +1113,8 @@ protected:
 	AckTimer ack_timer; /**< ACK Timer */
 
 	// internal AUV structure for list of polled node
-	std::vector<probbed_node> list_probbed_node; /**< list of nodes that have
-												   sent correctly the PROBE */
+	ProbbedNodeQueue list_probbed_node; /**< list of nodes that have
+										   sent correctly the PROBE */
 	probbed_node probbed_sink; /**<Element with sink probe data */
 	int polling_index; /**< Index of the node that the AUV is polling */
 	bool sink_inserted; /** true if the sink has been inserted in the list*/
@@ -403,19 +403,20 @@ Uwpolling_SINK::initPkt(UWPOLLING_PKT_TYPE pkt_type)
 		mach->ftype() = MF_CONTROL;
 		mach->macDA() = AUV_mac_addr;
 		mach->macSA() = addr;
-		std::vector<uint16_t> & ack = ackh->id_ack();
+		ackh->n_ack() = 0;
+		uint max_ack = std::min(max_n_ack, (uint) MAX_ACK_SINK_IDS);
 		std::list<uint16_t>::iterator it = missing_id_list.begin();
 		if (it == missing_id_list.end()) {
-			if (ack.size() <= max_n_ack) {
-				ack.push_back(last_rx+1);
+			if (max_ack > 0) {
+				ackh->addAck(last_rx+1);
 			} else {
 				std::cout << "Uwpolling_SINK(" << addr << ")::max number of "
 					<< "ack reached" << std::endl;
 			}
 		} else {
 			for (; it!= missing_id_list.end(); it++){
-				if (ack.size() <= max_n_ack) {
-					ack.push_back(*it);	
+				if (ackh->n_ack() < max_ack) {
+					ackh->addAck(*it);
 				} else {
 					std::cout << "Uwpolling_SINK(" << addr << ")::max number "
 						<< "of ack reached" << std::endl;
@@ -423,10 +424,10 @@ Uwpolling_SINK::initPkt(UWPOLLING_PKT_TYPE pkt_type)
 				}
 			}
 		}
-		ch->size() = ack.size() * sizeof(uint16_t);
+		ch->size() = ackh->n_ack() * sizeof(uint16_t);
 		if (debug_)
 			std::cout << NOW << "Uwpolling_SINK(" << addr
-					<< ")::ack list size=" << ack.size() << std::endl;
+					<< ")::ack list size=" << ackh->n_ack() << std::endl;
 		curr_ack_pkt = p->copy();
 		Packet::free(p);
 	}
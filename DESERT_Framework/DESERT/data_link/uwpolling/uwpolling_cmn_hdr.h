@@ -73,6 +73,8 @@ static const double MIN_T_POLL = 5; /**< Minimum duration of the POLL timer */
 static const double MIN_T_DATA = 5; /**< Minimum duration of the DATA timer */
 static const int MAX_BUFFER_SIZE =
 		100; /**< Maximum size of the queue in number of packets */
+static const int MAX_ACK_SINK_IDS =
+		100; /**< Maximum number of ids carried by an ACK of the SINK */
 static const int prop_speed =
 		1500; /**< Typical underwater sound propagation speed */
 
@@ -359,16 +361,58 @@ typedef struct hdr_AUV_MULE {
  * Header of the ACK sent by the SINK
  */
 typedef struct hdr_ACK_SINK {
-	std::vector<uint16_t> id_ack_; /**< ACK is the id of the wrong packets */
+	uint16_t id_ack_[MAX_ACK_SINK_IDS]; /**< ACK is the id of the wrong
+										   packets, or the id of the next
+										   expected one if none is missing */
+	uint16_t n_ack_; /**< Number of valid ids in id_ack_ */
 	static int offset_; /**< Required by the PacketHeaderManager. */
 
 	/**
-	 * Reference to the id_ack_ variable
+	 * Reference to the n_ack_ variable
 	 */
-	std::vector<uint16_t> &
-	id_ack()
+	uint16_t &
+	n_ack()
 	{
-		return (id_ack_);
+		return (n_ack_);
+	}
+
+	/**
+	 * Reference to the i-th id of the ACK list
+	 * @param i index of the id, lower than n_ack()
+	 */
+	uint16_t &
+	id_ack(int i)
+	{
+		return (id_ack_[i]);
+	}
+
+	/**
+	 * Appends an id to the ACK list
+	 * @param id id of the packet to acknowledge
+	 * @return false if the list is full and the id has not been added
+	 */
+	bool
+	addAck(uint16_t id)
+	{
+		if (n_ack_ >= MAX_ACK_SINK_IDS)
+			return false;
+		id_ack_[n_ack_++] = id;
+		return true;
+	}
+
+	/**
+	 * Checks if an id is in the ACK list
+	 * @param id id of the packet
+	 * @return true if the id is in the list
+	 */
+	bool
+	hasAck(uint16_t id) const
+	{
+		for (int i = 0; i < n_ack_; i++) {
+			if (id_ack_[i] == id)
+				return true;
+		}
+		return false;
 	}
 
 	/**
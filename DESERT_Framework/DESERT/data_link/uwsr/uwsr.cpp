@@ -66,11 +66,17 @@ public:
 	}
 } class_module_uwsr;
 
+const char *const MMacUWSR::perf_probe_names[] = {"recvFromUpperLayers",
+		"Phy2MacStartRx", "Phy2MacEndRx", "Phy2MacEndTx", "checkAckTimer",
+		"transition"};
+
 void
 MMacUWSR::AckTimer::expire(Event *e)
 {
 	timer_status = UWSR_EXPIRED;
 	module->incrPktsLostCount();
+	if (slot != NULL)
+		module->ackTimerExpired(slot);
 
 	if (module->curr_state == UWSR_STATE_WAIT_ACK ||
 			module->curr_state == UWSR_STATE_PRE_TX_DATA) {
@@ -163,6 +169,142 @@ MMacUWSR::WaitTxTimer::expire(Event *e)
 	}
 }
 
+MMacUWSR::TxWindow::TxWindow(MMacUWSR *m, int capacity)
+	: pending(0)
+	, module(m)
+	, slots()
+	, head(0)
+	, span(0)
+	, live(0)
+	, sorted(true)
+{
+	capacity = max(1, capacity);
+	for (int i = 0; i < capacity; i++)
+		slots.push_back(new TxSlot(module));
+}
+
+MMacUWSR::TxWindow::~TxWindow()
+{
+	for (size_t i = 0; i < slots.size(); i++) {
+		slots[i]->ack_timer.stop();
+		if (slots[i]->pkt != NULL)
+			Packet::free(slots[i]->pkt);
+		delete slots[i];
+	}
+}
+
+MMacUWSR::TxSlot *
+MMacUWSR::TxWindow::push(Packet *p, int seq_num)
+{
+	if (span == (int) slots.size())
+		compact();
+	if (span > 0 && at(span - 1)->seq_num >= seq_num)
+		sorted = false;
+
+	TxSlot *slot = at(span);
+	slot->pkt = p;
+	slot->seq_num = seq_num;
+	slot->tx_rounds = 0;
+	slot->ack_pending = false;
+	span++;
+	live++;
+	return slot;
+}
+
+void
+MMacUWSR::TxWindow::release(TxSlot *slot)
+{
+	slot->ack_timer.stop();
+	slot->pkt = NULL;
+	slot->tx_rounds = 0;
+	slot->ack_pending = false;
+	live--;
+	trim();
+}
+
+MMacUWSR::TxSlot *
+MMacUWSR::TxWindow::find(int seq_num)
+{
+	if (sorted) {
+		int low = 0;
+		int high = span - 1;
+		while (low <= high) {
+			int mid = (low + high) / 2;
+			TxSlot *slot = at(mid);
+			if (slot->seq_num == seq_num)
+				return (slot->pkt != NULL ? slot : NULL);
+			else if (slot->seq_num < seq_num)
+				low = mid + 1;
+			else
+				high = mid - 1;
+		}
+	} else {
+		for (int i = 0; i < span; i++) {
+			TxSlot *slot = at(i);
+			if (slot->pkt != NULL && slot->seq_num == seq_num)
+				return slot;
+		}
+	}
+	return NULL;
+}
+
+MMacUWSR::TxSlot *
+MMacUWSR::TxWindow::front()
+{
+	return (live > 0 ? at(0) : NULL);
+}
+
+MMacUWSR::TxSlot *
+MMacUWSR::TxWindow::waitingTx(bool last)
+{
+	if (live == pending)
+		return NULL;
+	for (int i = 0; i < span; i++) {
+		TxSlot *slot = at(last ? span - 1 - i : i);
+		if (slot->pkt != NULL && !slot->ack_pending)
+			return slot;
+	}
+	return NULL;
+}
+
+void
+MMacUWSR::TxWindow::trim()
+{
+	while (span > 0 && at(0)->pkt == NULL) {
+		head = (head + 1) % slots.size();
+		span--;
+	}
+	while (span > 0 && at(span - 1)->pkt == NULL)
+		span--;
+	if (span == 0) {
+		head = 0;
+		sorted = true;
+	}
+}
+
+void
+MMacUWSR::TxWindow::compact()
+{
+	std::vector<TxSlot *> ring;
+	std::vector<TxSlot *> free_slots;
+	for (size_t i = 0; i < slots.size(); i++) {
+		TxSlot *slot = at(i);
+		if ((int) i < span && slot->pkt != NULL)
+			ring.push_back(slot);
+		else
+			free_slots.push_back(slot);
+	}
+	ring.insert(ring.end(), free_slots.begin(), free_slots.end());
+	if (live == (int) slots.size()) {
+		size_t capacity = 2 * slots.size();
+		while (ring.size() < capacity)
+			ring.push_back(new TxSlot(module));
+	}
+	slots.swap(ring);
+	head = 0;
+	span = live;
+}
+
 const double MMacUWSR::prop_speed = 1500.0;
 bool MMacUWSR::initialized = false;
 
@@ -172,7 +314,6 @@ map<MMacUWSR::UWSR_PKT_TYPE, string> MMacUWSR::pkt_type_info;
 
 MMacUWSR::MMacUWSR()
 	: wait_tx_timer(this)
-	, ack_timer(this)
 	, listen_timer(this)
 	, backoff_timer(this)
 	, txsn(1)
@@ -206,7 +347,11 @@ MMacUWSR::MMacUWSR()
 	, hit_count(0)
 	, total_pkts_tx(0)
 	, latest_ack_timeout(0)
-
+	, mapTxWindow()
+	, queued_pkts(0)
+	, pending_acks(0)
+	, expired_acks(0)
+	, expired_slots()
 {
 	mac2phy_delay_ = 1e-19;
 	curr_tx_rounds = 0;
@@ -234,10 +379,14 @@ MMacUWSR::MMacUWSR()
 		has_buffer_queue = true;
 	if (listen_time <= 0.0)
 		listen_time = 1e-19;
+	UWPERF_INIT(perf_stats, UWSR_PERF_NPROBES, perf_probe_names);
 }
 
 MMacUWSR::~MMacUWSR()
 {
+	map<macAddress, TxWindow *>::iterator it_w;
+	for (it_w = mapTxWindow.begin(); it_w != mapTxWindow.end(); it_w++)
+		delete it_w->second;
 }
 
 // TCL command interpreter
@@ -258,7 +407,7 @@ MMacUWSR::command(int argc, const char *const *argv)
 		}
 		// stats functions
 		else if (strcasecmp(argv[1], "getQueueSize") == 0) {
-			tcl.resultf("%d", mapPacket.size());
+			tcl.resultf("%d", queued_pkts);
 			return TCL_OK;
 		} else if (strcasecmp(argv[1], "getBackoffCount") == 0) {
 			tcl.resultf("%d", getBackoffCount());
@@ -266,6 +415,12 @@ MMacUWSR::command(int argc, const char *const *argv)
 		} else if (strcasecmp(argv[1], "getAvgPktsTxIn1RTT") == 0) {
 			tcl.resultf("%f", getAvgPktsTxIn1RTT());
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstats") == 0) {
+			tcl.result(UWPERF_DUMP(perf_stats));
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstatsReset") == 0) {
+			UWPERF_RESET(perf_stats);
+			return TCL_OK;
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "setMacAddr") == 0) {
@@ -441,18 +596,75 @@ MMacUWSR::getPktsCanSendIn1RTT(int mac_addr)
 	return min(calWindowSize(mac_addr), pkts_can_send_1RTT);
 }
 
-bool
-MMacUWSR::chkItemInmapTxRounds(int mac_addr, int seq_num)
+MMacUWSR::TxSlot *
+MMacUWSR::getFirstSlot()
 {
-	map<usrPair, txRounds>::iterator it_t;
-	it_t = mapTxRounds.find(make_pair(mac_addr, seq_num));
-	if (uwsr_debug)
-		cout << NOW << " MMacUWSR(" << addr << ")::chkItemInmapTxRounds()"
-			 << endl;
-	if (it_t != mapTxRounds.end())
-		return true;
-	else
-		return false;
+	map<macAddress, TxWindow *>::iterator it_w;
+	for (it_w = mapTxWindow.begin(); it_w != mapTxWindow.end(); it_w++) {
+		if (it_w->second->size() > 0)
+			return it_w->second->front();
+	}
+	return NULL;
+}
+
+void
+MMacUWSR::putPktInQueue(Packet *p)
+{
+	int mac_addr = getMacAddress(p);
+	TxWindow *w = getTxWindow(mac_addr);
+	if (w == NULL) {
+		w = new TxWindow(this,
+				(buffer_pkts > 0 ? buffer_pkts : UWSR_WINDOW_INIT_SIZE));
+		mapTxWindow.insert(make_pair(mac_addr, w));
+	}
+	w->push(p, getPktSeqNum(p));
+	queued_pkts++;
+}
+
+void
+MMacUWSR::eraseSlot(int mac_addr, TxSlot *slot)
+{
+	clearAckTimer(mac_addr, slot);
+	Packet::free(slot->pkt);
+	getTxWindow(mac_addr)->release(slot);
+	queued_pkts--;
+}
+
+void
+MMacUWSR::startAckTimer(int mac_addr, TxSlot *slot, double timeout)
+{
+	if (slot->ack_pending) {
+		if (slot->ack_timer.isExpired())
+			expired_acks--;
+	} else {
+		slot->ack_pending = true;
+		getTxWindow(mac_addr)->pending++;
+		pending_acks++;
+	}
+	slot->ack_timer.stop();
+	slot->ack_timer.schedule(timeout);
+}
+
+void
+MMacUWSR::clearAckTimer(int mac_addr, TxSlot *slot)
+{
+	if (!slot->ack_pending)
+		return;
+	if (slot->ack_timer.isExpired())
+		expired_acks--;
+	slot->ack_timer.stop();
+	slot->ack_pending = false;
+	getTxWindow(mac_addr)->pending--;
+	pending_acks--;
+}
+
+void
+MMacUWSR::ackTimerExpired(TxSlot *slot)
+{
+	if (!slot->ack_pending)
+		return;
+	expired_acks++;
+	expired_slots.push_back(slot);
 }
 
 double
@@ -499,37 +711,15 @@ MMacUWSR::checkMultipleTx(int rcv_mac_addr)
 		cout << NOW << " MMacUWSR(" << addr
 			 << ")::checkMultipleTx() rcv mac addr " << rcv_mac_addr << endl;
 
-	Packet *nxt_data_pkt;
-
-	map<usrPair, Packet *>::iterator it_p;
-	map<usrPair, AckTimer>::iterator it_a;
-
-	int nxt_mac_addr;
-
-	if (mapPacket.size() == 0)
+	if (queued_pkts == 0)
 		return false;
-	else if (mapPacket.size() <= mapAckTimer.size())
+	else if (queued_pkts <= pending_acks)
 		return false;
 	else if (getPktsCanSendIn1RTT(rcv_mac_addr) < 2)
 		return false;
 	else {
-		for (it_p = mapPacket.begin(); it_p != mapPacket.end(); it_p++) {
-			it_a = mapAckTimer.find((*it_p).first);
-			if ((*it_a).first != (*it_p).first) {
-				nxt_data_pkt = (*it_p).second;
-				if (uwsr_debug)
-					cout << NOW << " MMacUWSR(" << addr
-						 << ")::Next Packet transmitting: " << nxt_data_pkt
-						 << endl;
-				hdr_mac *mach = HDR_MAC(nxt_data_pkt);
-				nxt_mac_addr = mach->macDA();
-				if (rcv_mac_addr == nxt_mac_addr)
-					break;
-			} else
-				nxt_mac_addr = -1;
-		}
-
-		if (rcv_mac_addr == nxt_mac_addr &&
+		TxWindow *w = getTxWindow(rcv_mac_addr);
+		if (w != NULL && w->size() > w->pending &&
 				getPktsCanSendIn1RTT(rcv_mac_addr) > getPktsSentIn1RTT())
 			return true;
 		else
@@ -540,50 +730,28 @@ MMacUWSR::checkMultipleTx(int rcv_mac_addr)
 int
 MMacUWSR::checkAckTimer(CHECK_ACK_TIMER type)
 {
+	UWPERF_SCOPE(perf_stats, UWSR_PERF_CHECK_ACK_TIMER);
 
-	int iteration_count = 0;
-	int active_count = 0;
+	int active_count = pending_acks - expired_acks;
+	int expired_count = expired_acks;
 	int idle_count = 0;
-	int expired_count = 0;
 	int value = 0;
 
-	map<usrPair, AckTimer>::iterator it_a;
-
-	for (it_a = mapAckTimer.begin(); it_a != mapAckTimer.end(); it_a++) {
-		if (((*it_a).second).isActive()) {
-			active_count += 1;
-		} else if (((*it_a).second).isExpired()) {
-			expired_count += 1;
-		} else if (((*it_a).second).isIdle()) {
-			idle_count += 1;
-		} else {
-			cerr << "Ack Timer is in wrong state" << endl;
-			exit(1);
-		}
-		iteration_count += 1;
-	}
-
 	if (uwsr_debug)
 		cout << NOW << " MMacUWSR(" << addr
-			 << ")::No of item in ack map: " << mapAckTimer.size() << endl;
-	if (uwsr_debug)
-		cout << NOW << " MMacUWSR(" << addr
-			 << ")::No of iteration count: " << iteration_count << endl;
+			 << ")::No of item in ack map: " << pending_acks << endl;
 	if (uwsr_debug)
 		cout << NOW << " MMacUWSR(" << addr
 			 << ")::No of active count: " << active_count << endl;
 	if (uwsr_debug)
 		cout << NOW << " MMacUWSR(" << addr
 			 << ")::No of expired count: " << expired_count << endl;
-	if (uwsr_debug)
-		cout << NOW << " MMacUWSR(" << addr
-			 << ")::No of idle count: " << idle_count << endl;
 
 	if (type == CHECK_ACTIVE) {
-		if (mapAckTimer.size() == 0) {
+		if (pending_acks == 0) {
 			value = 1;
 		} else {
-			value = floor(active_count / mapAckTimer.size());
+			value = active_count / pending_acks;
 		}
 	} else if (type == CHECK_EXPIRED) {
 		value = expired_count;
@@ -610,38 +778,25 @@ MMacUWSR::eraseExpiredItemsFrommapAckandCalc()
 		cout << NOW << " MMacUWSR(" << addr
 			 << ")::Erasing expired items from map ack and calc" << endl;
 
-	map<usrPair, AckTimer>::iterator it_a1, it_a2;
-
-	it_a1 = mapAckTimer.begin();
-
-	while (it_a1 != mapAckTimer.end()) {
-
-		it_a2 = it_a1;
-		it_a1++;
-
-		if (((*it_a2).second).isExpired()) {
-			int mac_addr = (it_a2->first).first;
-			int seq_num = (it_a2->first).second;
-			eraseItemFrommapAckTimer(mac_addr, seq_num);
-			eraseItemFrommapCalcAck(mac_addr, seq_num);
-		} else {
-			// do nothing
-		}
+	std::vector<TxSlot *> slots;
+	slots.swap(expired_slots);
+	for (size_t i = 0; i < slots.size(); i++) {
+		TxSlot *slot = slots[i];
+		if (slot->ack_pending && slot->ack_timer.isExpired())
+			clearAckTimer(getMacAddress(slot->pkt), slot);
 	}
 }
 
 double
 MMacUWSR::computeTxTime(UWSR_PKT_TYPE type)
 {
-	map<usrPair, Packet *>::iterator it_p;
-
 	double duration;
 	Packet *temp_data_pkt;
 
 	if (type == UWSR_DATA_PKT) {
-		if (!mapPacket.empty()) {
-			it_p = mapPacket.begin();
-			temp_data_pkt = ((*it_p).second)->copy();
+		TxSlot *slot = getFirstSlot();
+		if (slot != NULL) {
+			temp_data_pkt = slot->pkt->copy();
 			hdr_cmn *ch = HDR_CMN(temp_data_pkt);
 			ch->size() = HDR_size + ch->size();
 		} else {
@@ -692,7 +847,9 @@ MMacUWSR::getBackoffTime()
 void
 MMacUWSR::recvFromUpperLayers(Packet *p)
 {
-	if (((has_buffer_queue == true) && (mapPacket.size() < buffer_pkts)) ||
+	UWPERF_SCOPE(perf_stats, UWSR_PERF_RECV_UPPER);
+	if (((has_buffer_queue == true) &&
+				(buffer_pkts < 0 || queued_pkts < buffer_pkts)) ||
 			(has_buffer_queue == false)) {
 		initPkt(p, UWSR_DATA_PKT);
 		putPktInQueue(p);
@@ -748,6 +905,7 @@ MMacUWSR::Mac2PhyStartTx(Packet *p)
 void
 MMacUWSR::Phy2MacEndTx(const Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, UWSR_PERF_END_TX);
 
 	hdr_cmn *ch = hdr_cmn::access(p);
 	int seq_num = ch->uid();
@@ -783,11 +941,9 @@ MMacUWSR::Phy2MacEndTx(const Packet *p)
 
 			ack_time = NOW + ack_timeout_time;
 
-			putAckTimerInMap(dst_mac_addr, seq_num);
-			map<usrPair, AckTimer>::iterator it_a;
-			it_a = mapAckTimer.find(make_pair(dst_mac_addr, seq_num));
-			((*it_a).second).stop();
-			((*it_a).second).schedule(ack_timeout_time);
+			TxSlot *slot = findSlot(dst_mac_addr, seq_num);
+			if (slot != NULL)
+				startAckTimer(dst_mac_addr, slot, ack_timeout_time);
 
 			if (uwsr_debug)
 				cout << NOW << " MMacUWSR(" << addr
@@ -895,6 +1051,7 @@ MMacUWSR::Phy2MacEndTx(const Packet *p)
 void
 MMacUWSR::Phy2MacStartRx(const Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, UWSR_PERF_START_RX);
 	if (uwsr_debug)
 		cout << NOW << " MMacUWSR(" << addr << ")::Phy2MacStartRx() rx Packet "
 			 << endl;
@@ -934,6 +1091,7 @@ MMacUWSR::Phy2MacStartRx(const Packet *p)
 void
 MMacUWSR::Phy2MacEndRx(Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, UWSR_PERF_END_RX);
 
 	hdr_cmn *ch = HDR_CMN(p);
 	packet_t rx_pkt_type = ch->ptype();
@@ -950,7 +1108,6 @@ MMacUWSR::Phy2MacEndRx(Packet *p)
 
 	double distance = diff_time * prop_speed;
 	int seq_num = getPktSeqNum(p);
-	map<usrPair, AckTimer>::iterator it_a;
 
 	if (uwsr_debug)
 		cout << NOW << " MMacUWSR(" << addr << ")::Phy2MacEndRx() "
@@ -974,8 +1131,8 @@ MMacUWSR::Phy2MacEndRx(Packet *p)
 	} else {
 		if (dest_mac == addr || dest_mac == MAC_BROADCAST) {
 			if (rx_pkt_type == PT_MMAC_ACK) {
-				it_a = mapAckTimer.find(make_pair(source_mac, seq_num));
-				if (it_a != mapAckTimer.end()) {
+				TxSlot *slot = findSlot(source_mac, seq_num);
+				if (slot != NULL && slot->ack_pending) {
 					refreshReason(UWSR_REASON_ACK_RX);
 					stateRxAck(p);
 				} else {
@@ -1002,14 +1159,8 @@ MMacUWSR::stateTxData()
 		cout << NOW << " MMacUWSR(" << addr << ")::stateTxData" << endl;
 
 	Packet *data_pkt = curr_data_pkt->copy(); // copio pkt
-	int seq_num = getPktSeqNum(data_pkt);
-	int mac_addr = getMacAddress(data_pkt);
 
 	start_tx_time = NOW;
-	map<usrPair, txStartTime>::iterator it_ca;
-	it_ca = mapCalcAck.find(make_pair(mac_addr, seq_num));
-	if (it_ca == mapCalcAck.end())
-		putStartTxTimeInMap(mac_addr, seq_num, start_tx_time);
 
 	incrDataPktsTx();
 
@@ -1113,7 +1264,7 @@ MMacUWSR::stateCheckAckExpired()
 	if (print_transitions)
 		printStateInfo();
 
-	if (mapAckTimer.size() == 0)
+	if (pending_acks == 0)
 		stateIdle();
 	else if (checkAckTimer(CHECK_ACTIVE)) {
 		refreshReason(UWSR_REASON_WAIT_ACK_PENDING);
@@ -1238,7 +1389,7 @@ MMacUWSR::stateIdle()
 	if (print_transitions)
 		printStateInfo();
 
-	if (!mapPacket.empty()) {
+	if (queued_pkts > 0) {
 		refreshReason(UWSR_REASON_LISTEN);
 		stateListen();
 	}
@@ -1323,21 +1474,21 @@ bool
 MMacUWSR::prepBeforeTx(int mac_addr, int seq_num)
 {
 
+	TxSlot *slot = findSlot(mac_addr, seq_num);
+	assert(slot != NULL);
+
 	if (uwsr_debug)
 		cout << NOW << " MMacUWSR(" << addr
-			 << ")::prepBeforeTx(), is item in tx rounds map "
-			 << chkItemInmapTxRounds(mac_addr, seq_num) << endl;
+			 << ")::prepBeforeTx(), tx rounds " << slot->tx_rounds << endl;
 
-	if (chkItemInmapTxRounds(mac_addr, seq_num)) {
-		if (getCurrTxRounds(mac_addr, seq_num) < max_tx_tries + 1) {
+	if (slot->tx_rounds > 0) {
+		if (slot->tx_rounds < max_tx_tries + 1) {
 
 			last_sent_data_id = seq_num;
-			incrCurrTxRounds(mac_addr, seq_num);
+			slot->tx_rounds++;
 			return true;
 		} else {
-			eraseItemFromPktQueue(mac_addr, seq_num);
-			eraseItemFromTxRounds(mac_addr, seq_num);
-			eraseItemFrommapAckTimer(mac_addr, seq_num);
+			eraseSlot(mac_addr, slot);
 			incrDroppedPktsTx();
 
 			refreshReason(UWSR_REASON_MAX_TX_TRIES);
@@ -1352,7 +1503,8 @@ MMacUWSR::prepBeforeTx(int mac_addr, int seq_num)
 		listen_timer.resetCounter();
 		backoff_timer.resetCounter();
 
-		setCurrTxRounds(mac_addr, seq_num);
+		curr_tx_rounds = 1;
+		slot->tx_rounds = curr_tx_rounds;
 		return true;
 	}
 }
@@ -1377,71 +1529,55 @@ MMacUWSR::statePreTxData()
 	if (print_transitions)
 		printStateInfo();
 
-	map<usrPair, Packet *>::iterator it_p;
-	map<usrPair, AckTimer>::iterator it_a;
-
+	TxSlot *slot = NULL;
 	int curr_mac_addr;
 	int seq_num;
 
-	it_p = mapPacket.begin();
-	if (mapPacket.size() == 0) {
+	if (queued_pkts == 0) {
 		stateIdle();
-	} else if (mapAckTimer.size() == 0) {
-		curr_data_pkt = (*it_p).second;
-		if (uwsr_debug)
-			cout << NOW << " MMacUWSR(" << addr
-				 << ")::Packet transmitting: " << curr_data_pkt << endl;
-		seq_num = getPktSeqNum(curr_data_pkt);
-		if (uwsr_debug)
-			cout << NOW << " MMacUWSR(" << addr << ")::seq_num: " << seq_num
-				 << endl;
-
-		hdr_mac *mach = HDR_MAC(curr_data_pkt);
-		curr_mac_addr = mach->macDA();
-
-		if (prepBeforeTx(curr_mac_addr, seq_num)) {
-			if (prev_state == UWSR_STATE_LISTEN) {
-				stateTxData();
-			} else {
-				stateCheckWaitTxExpired();
-			}
-		} else
-			stateIdle();
-	} else if (mapPacket.size() > mapAckTimer.size()) {
-		// 		int seq_num;
-		for (it_p = mapPacket.begin(); it_p != mapPacket.end(); it_p++) {
-			it_a = mapAckTimer.find((*it_p).first);
-			if ((*it_a).first != (*it_p).first) {
-				// it_p = mapPacket.begin();
-				curr_data_pkt = (*it_p).second;
-				if (uwsr_debug)
-					cout << NOW << " MMacUWSR(" << addr
-						 << ")::Packet transmitting: " << curr_data_pkt << endl;
-				seq_num = getPktSeqNum(curr_data_pkt);
-				if (uwsr_debug)
-					cout << NOW << " MMacUWSR(" << addr
-						 << ")::seq_num: " << seq_num << endl;
-				hdr_mac *mach = HDR_MAC(curr_data_pkt);
-				curr_mac_addr = mach->macDA();
-				if (prev_state == UWSR_STATE_TX_DATA) {
-					if (curr_mac_addr == prv_mac_addr)
-						break;
-					// 				  else continue;
-				} else
-					break;
-			}
+		return;
+	} else if (pending_acks == 0) {
+		slot = getFirstSlot();
+	} else if (queued_pkts > pending_acks) {
+		TxWindow *w = NULL;
+		if (prev_state == UWSR_STATE_TX_DATA)
+			w = getTxWindow(prv_mac_addr);
+		if (w != NULL)
+			slot = w->waitingTx();
+		if (slot == NULL && prev_state == UWSR_STATE_TX_DATA) {
+			map<macAddress, TxWindow *>::reverse_iterator it_w;
+			for (it_w = mapTxWindow.rbegin();
+					slot == NULL && it_w != mapTxWindow.rend(); it_w++)
+				slot = it_w->second->waitingTx(true);
+		} else if (slot == NULL) {
+			map<macAddress, TxWindow *>::iterator it_w;
+			for (it_w = mapTxWindow.begin();
+					slot == NULL && it_w != mapTxWindow.end(); it_w++)
+				slot = it_w->second->waitingTx();
 		}
-		if (prepBeforeTx(curr_mac_addr, seq_num)) {
-			if (prev_state == UWSR_STATE_LISTEN) {
-				stateTxData();
-			} else {
-				stateCheckWaitTxExpired();
-			}
-		} else
-			stateIdle();
 	} else {
 		stateCheckAckExpired();
+		return;
 	}
+
+	curr_data_pkt = slot->pkt;
+	if (uwsr_debug)
+		cout << NOW << " MMacUWSR(" << addr
+			 << ")::Packet transmitting: " << curr_data_pkt << endl;
+	seq_num = getPktSeqNum(curr_data_pkt);
+	if (uwsr_debug)
+		cout << NOW << " MMacUWSR(" << addr << ")::seq_num: " << seq_num
+			 << endl;
+	curr_mac_addr = getMacAddress(curr_data_pkt);
+
+	if (prepBeforeTx(curr_mac_addr, seq_num)) {
+		if (prev_state == UWSR_STATE_LISTEN) {
+			stateTxData();
+		} else {
+			stateCheckWaitTxExpired();
+		}
+	} else
+		stateIdle();
 }
 
 void
@@ -1521,19 +1657,8 @@ MMacUWSR::stateRxAck(Packet *p)
 	int curr_mac_addr = mach->macSA();
 	int seq_num = getPktSeqNum(p);
 
-	map<usrPair, AckTimer>::iterator it_a;
-	map<usrPair, txStartTime>::iterator it_ca;
-
-	it_a = mapAckTimer.find(make_pair(curr_mac_addr, seq_num));
-	((*it_a).second).stop();
-
-	it_ca = mapCalcAck.find(make_pair(curr_mac_addr, seq_num));
-	double start_tx_time = ((*it_ca).second);
-
-	eraseItemFromPktQueue(curr_mac_addr, seq_num);
-	eraseItemFromTxRounds(curr_mac_addr, seq_num);
-	eraseItemFrommapAckTimer(curr_mac_addr, seq_num);
-	eraseItemFrommapCalcAck(curr_mac_addr, seq_num);
+	TxSlot *slot = findSlot(curr_mac_addr, seq_num);
+	eraseSlot(curr_mac_addr, slot);
 	incrAckPktsRx();
 
 	incrAcksRcvIn1RTT();
@@ -1558,14 +1683,14 @@ MMacUWSR::stateRxAck(Packet *p)
 			break;
 
 		case UWSR_STATE_RX_WAIT_ACK:
-			if (mapAckTimer.size() > 0)
+			if (pending_acks > 0)
 				stateCheckAckExpired();
 			else
 				stateIdle();
 			break;
 
 		case UWSR_STATE_RX_IN_PRE_TX_DATA: {
-			if (mapPacket.size() == 0)
+			if (queued_pkts == 0)
 				stateIdle();
 			else
 				stateCheckWaitTxExpired();
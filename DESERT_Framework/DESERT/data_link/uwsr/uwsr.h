@@ -56,9 +56,11 @@
 #include <map>
 #include <set>
 #include <utility>
+#include <vector>
 #include <fstream>
 
 #include <mphy.h>
+#include "uwperfstats.h"
 
 #define UWSR_DROP_REASON_WRONG_STATE "WST"
 #define UWSR_DROP_REASON_WRONG_RECEIVER "WRCV"
@@ -66,6 +68,9 @@
 #define UWSR_DROP_REASON_BUFFER_FULL "DBF"
 #define UWSR_DROP_REASON_ERROR "ERR"
 
+#define UWSR_WINDOW_INIT_SIZE 8 /**< Initial capacity of a destination window
+								   when buffer_pkts_ is not set */
+
 extern packet_t PT_MMAC_ACK;
 
 typedef int pktSeqNum;
@@ -186,6 +191,8 @@ protected:
 	*/
 	enum CHECK_ACK_TIMER { CHECK_ACTIVE = 1, CHECK_EXPIRED, CHECK_IDLE };
 
+	struct TxSlot;
+
 	/**
 	* Base class of all the timer used in this protocol. This is a derived class
 	* of TimerHandler.
@@ -423,6 +430,7 @@ protected:
 		*/
 		AckTimer(MMacUWSR *m)
 			: UWSRTimer(m)
+			, slot(NULL)
 		{
 		}
 
@@ -433,6 +441,8 @@ protected:
 		{
 		}
 
+		TxSlot *slot; /**< Window slot the timer belongs to. */
+
 	protected:
 		/**
 		* What a node is going to do when a timer expire.
@@ -441,6 +451,126 @@ protected:
 		virtual void expire(Event *e);
 	};
 
+	/**
+	* Slot of a destination window. It keeps together the <i>Data</i> packet,
+	* its retransmission count, its AckTimer and its acknowledgement state.
+	*/
+	struct TxSlot {
+		/**
+		* Constructor of TxSlot.
+		*/
+		TxSlot(MMacUWSR *m)
+			: pkt(NULL)
+			, seq_num(-1)
+			, tx_rounds(0)
+			, ack_pending(false)
+			, ack_timer(m)
+		{
+			ack_timer.slot = this;
+		}
+
+		Packet *pkt; /**< Stored packet, NULL if the slot is free. */
+		int seq_num; /**< Sequence number of the stored packet. */
+		int tx_rounds; /**< How many times the packet was transmitted. */
+		bool ack_pending; /**< True while an <i>ACK</i> is awaited (the
+							 AckTimer may be running or already expired). */
+		AckTimer ack_timer; /**< AckTimer of the stored packet. */
+	};
+
+	/**
+	* Sliding window of the packets addressed to one destination. The slots
+	* form a ring in arrival order, freed slots are reclaimed as soon as they
+	* reach the head or the tail of the ring, and the ring grows by relinking
+	* the slot pointers, so running AckTimers never move in memory.
+	*/
+	class TxWindow
+	{
+
+	public:
+		/**
+		* Constructor of TxWindow.
+		* @param m pointer to the MMacUWSR module
+		* @param capacity initial number of slots
+		*/
+		TxWindow(MMacUWSR *m, int capacity);
+
+		/**
+		* Destructor of TxWindow. It frees the packets still stored.
+		*/
+		~TxWindow();
+
+		/**
+		* Store a packet at the tail of the window.
+		* @param p packet pointer
+		* @param seq_num sequence number of the packet
+		* @return the slot holding the packet
+		*/
+		TxSlot *push(Packet *p, int seq_num);
+
+		/**
+		* Free a slot. The packet is not deallocated.
+		* @param slot slot to be freed
+		*/
+		void release(TxSlot *slot);
+
+		/**
+		* Find the slot holding a packet.
+		* @param seq_num sequence number of the packet
+		* @return the slot, NULL if the packet is not in the window
+		*/
+		TxSlot *find(int seq_num);
+
+		/**
+		* @return the oldest packet of the window, NULL if empty
+		*/
+		TxSlot *front();
+
+		/**
+		* @param last if true return the newest slot instead of the oldest
+		* @return a slot whose packet is not waiting for an <i>ACK</i>
+		*/
+		TxSlot *waitingTx(bool last = false);
+
+		/**
+		* @return number of packets in the window
+		*/
+		inline int
+		size() const
+		{
+			return live;
+		}
+
+		int pending; /**< Number of packets waiting for an <i>ACK</i>. */
+
+	private:
+		/**
+		* Logical position in the window to slot.
+		*/
+		inline TxSlot *
+		at(int i)
+		{
+			return slots[(head + i) % slots.size()];
+		}
+
+		/**
+		* Move the free slots at the head and at the tail out of the window.
+		*/
+		void trim();
+
+		/**
+		* Pack the stored packets at the beginning of the ring, doubling its
+		* capacity if it is full.
+		*/
+		void compact();
+
+		MMacUWSR *module; /**< Pointer of MMacUWSR module. */
+		std::vector<TxSlot *> slots; /**< Ring of slots. */
+		int head; /**< Position of the oldest slot in the ring. */
+		int span; /**< Slots between head and tail, free ones included. */
+		int live; /**< Slots holding a packet. */
+		bool sorted; /**< Sequence numbers are increasing in the ring. */
+	};
+
 	/**
 	* Base class of ListenTimer, which is a derived class of UWSRTimer.
 	*/
@@ -721,6 +851,7 @@ protected:
 	virtual void
 	refreshState(UWSR_STATUS state)
 	{
+		UWPERF_COUNT(perf_stats, UWSR_PERF_TRANSITION);
 		prev_prev_state = prev_state;
 		prev_state = curr_state;
 		curr_state = state;
@@ -771,7 +902,7 @@ protected:
 	virtual int
 	getRemainingPkts()
 	{
-		return (up_data_pkts_rx - mapPacket.size());
+		return (up_data_pkts_rx - queued_pkts);
 	}
 
 	/**
@@ -808,147 +939,74 @@ protected:
 		return mach->macDA();
 	}
 
-	/// handling transmission round
-	/**
-	* It checks whether the same packet is transmitted before.
-	* @param mac address of the node
-	* @param sequence number of the packet.
-	* @return boolean data type. Returns <i>TRUE</i> when this packet was not
-	* transmitted before and <i>FALSE</i> when it was transmitted.
-	*/
-	inline bool chkItemInmapTxRounds(int mac_addr, int seq_num);
-
-	/**
-	* It sets the current tranmission round of a packet.
-	* @param mac address of the node
-	* @param sequence number of the packet.
-	*/
-	inline void
-	setCurrTxRounds(int mac_addr, int seq_num)
-	{
-		curr_tx_rounds = 1;
-		mapTxRounds.insert(
-				make_pair(make_pair(mac_addr, seq_num), curr_tx_rounds));
-	}
-
+	/// handling window slots
 	/**
-	* Increment the number of times a packet is transmitted.
-	* @param mac address of the node
-	* @param sequence number of the packet.
+	* Find the window of a destination.
+	* @param mac address of the destination
+	* @return the window, NULL if no packet was ever queued for it
 	*/
-	inline void
-	incrCurrTxRounds(int mac_addr, int seq_num)
+	inline TxWindow *
+	getTxWindow(int mac_addr)
 	{
-		map<usrPair, txRounds>::iterator it_t;
-		it_t = mapTxRounds.find(make_pair(mac_addr, seq_num));
-		(*it_t).second += 1;
+		map<macAddress, TxWindow *>::iterator it_w;
+		it_w = mapTxWindow.find(mac_addr);
+		return (it_w == mapTxWindow.end() ? NULL : it_w->second);
 	}
 
 	/**
-	* Returns the current transmission round of a <i>Data</i> packet.
-	* @param mac address of the node
+	* Find the slot of a packet.
+	* @param mac address of the destination
 	* @param sequence number of the packet.
-	* @return an integer data type.
+	* @return the slot, NULL if the packet is not queued
 	*/
-	inline int
-	getCurrTxRounds(int mac_addr, int seq_num)
+	inline TxSlot *
+	findSlot(int mac_addr, int seq_num)
 	{
-		map<usrPair, txRounds>::iterator it_t;
-		it_t = mapTxRounds.find(make_pair(mac_addr, seq_num));
-		return ((*it_t).second);
+		TxWindow *w = getTxWindow(mac_addr);
+		return (w == NULL ? NULL : w->find(seq_num));
 	}
 
 	/**
-	* Erase an Item form the container where transmission round of various
-	* transmit packet are stored.
-	* @param mac address of the node
-	* @param sequence number of the packet.
+	* Oldest packet of the destination with the lowest address.
+	* @return the slot, NULL if no packet is queued
 	*/
-	inline void
-	eraseItemFromTxRounds(int mac_addr, int seq_num)
-	{
-		map<usrPair, txRounds>::iterator it_t;
-		it_t = mapTxRounds.find(make_pair(mac_addr, seq_num));
-		mapTxRounds.erase((*it_t).first);
-	}
+	virtual TxSlot *getFirstSlot();
 
-	/// handling packets
 	/**
-	* Store the packet in a container.
+	* Store the packet in the window of its destination.
 	* @param packet pointer
 	*/
-	inline void
-	putPktInQueue(Packet *p)
-	{
-		mapPacket.insert(
-				make_pair(make_pair(getMacAddress(p), getPktSeqNum(p)), p));
-	}
+	virtual void putPktInQueue(Packet *p);
 
 	/**
 	* Erase the packet which is delivered to the destination correctly or other
-	* reasons
+	* reasons, together with its transmission rounds and acknowledgement state.
+	* @param mac address of the destination
+	* @param slot of the packet
 	*/
-	inline void
-	eraseItemFromPktQueue(int mac_addr, int seq_num)
-	{
-		map<usrPair, Packet *>::iterator it_p;
-		it_p = mapPacket.find(make_pair(mac_addr, seq_num));
-		Packet::free((*it_p).second);
-		mapPacket.erase((*it_p).first);
-	}
+	virtual void eraseSlot(int mac_addr, TxSlot *slot);
 
 	/// managing ack
 	/**
-	* Put AckTimer Object in the container. For every transmitted packet an
-	* AckTimer object is created.
-	* @param mac address of the node
-	* @param sequence number of the packet.
-	*/
-	inline void
-	putAckTimerInMap(int mac_addr, int seq_num)
-	{
-		mapAckTimer.insert(make_pair(make_pair(mac_addr, seq_num), ack_timer));
-	}
-
-	/**
-	* If a node receives an <i>ACK</i> for its transmitted packet, it erases the
-	* related AckTimer object of that packet.
-	* @param mac address of the node
-	* @param sequence number of the packet.
+	* Start waiting for the <i>ACK</i> of a transmitted packet.
+	* @param mac address of the destination
+	* @param slot of the packet
+	* @param timeout acknowledgement timeout
 	*/
-	inline void
-	eraseItemFrommapAckTimer(int mac_addr, int seq_num)
-	{
-		map<usrPair, AckTimer>::iterator it_a;
-		it_a = mapAckTimer.find(make_pair(mac_addr, seq_num));
-		mapAckTimer.erase((*it_a).first);
-	}
+	virtual void startAckTimer(int mac_addr, TxSlot *slot, double timeout);
 
 	/**
-	* It stores the initial transmission start time in a container.
-	* @param mac address of the node
-	* @param sequence number of the packet.
+	* Stop waiting for the <i>ACK</i> of a packet.
+	* @param mac address of the destination
+	* @param slot of the packet
 	*/
-	inline void
-	putStartTxTimeInMap(int mac_addr, int seq_num, double start_tx_time)
-	{
-		mapCalcAck.insert(
-				make_pair(make_pair(mac_addr, seq_num), start_tx_time));
-	}
+	virtual void clearAckTimer(int mac_addr, TxSlot *slot);
 
 	/**
-	* Erases the transmission start time of a packet when an <i>ACK</i> is
-	* received correctly.
-	* @param mac address of the node
-	* @param sequence number of the packet.
+	* Called by an AckTimer when it expires.
+	* @param slot of the packet whose <i>ACK</i> timed out
 	*/
-	inline void
-	eraseItemFrommapCalcAck(int mac_addr, int seq_num)
-	{
-		map<usrPair, txStartTime>::iterator it_ca;
-		it_ca = mapCalcAck.find(make_pair(mac_addr, seq_num));
-		mapCalcAck.erase((*it_ca).first);
-	}
+	virtual void ackTimerExpired(TxSlot *slot);
 
 	/**
 	* It checks whether any acknowledgement timer expire. Since, in UWSR, we are
@@ -960,8 +1018,8 @@ protected:
 	virtual int checkAckTimer(CHECK_ACK_TIMER type);
 
 	/**
-	* Erases those items whose acknowledgement timer expire from AckTimer
-	* containter and also from start trasmit time contaioner.
+	* Clears the acknowledgement state of the packets whose AckTimer expired,
+	* so that they can be retransmitted.
 	*/
 	virtual void eraseExpiredItemsFrommapAckandCalc();
 
@@ -1222,7 +1280,6 @@ protected:
 						  average number of packets transmit in a sigle RTT */
 	int total_pkts_tx; /**< Total number of packets transmit. */
 
-	AckTimer ack_timer; /**< An object of the AckTimer class */
 	BackOffTimer backoff_timer; /**< An object of the BackOffTimer class */
 	ListenTimer listen_timer; /**< An object of the ListenTimer class */
 	WaitTxTimer wait_tx_timer; /**< An object of the WaitTxTimer class */
@@ -1248,16 +1305,14 @@ protected:
 			pkt_type_info; /**< Container which stores all the packet type
 							  information of MMacUWSR*/
 
-	map<usrPair, Packet *>
-			mapPacket; /**< Container where <i>Data</i> packets are stored */
-	map<usrPair, txRounds> mapTxRounds; /**< Container where retransmission
-										   information of various packets are
-										   stored */
-	map<usrPair, AckTimer> mapAckTimer; /**< Container where AckTimer objects
-										   for variuous packets are stored */
-	map<usrPair, txStartTime> mapCalcAck; /**< Container where starting
-											 transmission time of various
-											 packets are stored */
+	map<macAddress, TxWindow *> mapTxWindow; /**< Container where the windows
+												of <i>Data</i> packets of
+												each destination are stored */
+	int queued_pkts; /**< Number of <i>Data</i> packets in all the windows */
+	int pending_acks; /**< Number of packets waiting for an <i>ACK</i> */
+	int expired_acks; /**< Number of packets whose AckTimer expired and that
+						 were not yet moved back to transmission */
+	std::vector<TxSlot *> expired_slots; /**< Slots whose AckTimer expired */
 	map<macAddress, rttPair> mapRTT; /**< Container where RTT between various
 										sender-receiver pairs are stored */
 	map<macAddress, txStatusPair> mapTxStatus; /**< Container which stores the
@@ -1266,6 +1321,22 @@ protected:
 						   * of acknowledgement receive among them. */
 
 	ofstream fout; /**< An object of ofstream class */
+
+	/**
+	 * Probes of the hot-path instrumentation (see uwperfstats.h).
+	 */
+	enum UWSR_PERF_PROBE {
+		UWSR_PERF_RECV_UPPER = 0,
+		UWSR_PERF_START_RX,
+		UWSR_PERF_END_RX,
+		UWSR_PERF_END_TX,
+		UWSR_PERF_CHECK_ACK_TIMER,
+		UWSR_PERF_TRANSITION,
+		UWSR_PERF_NPROBES
+	};
+	static const char *const perf_probe_names[UWSR_PERF_NPROBES]; /**< Names
+									of the probes. */
+	UWPERF_MEMBER(perf_stats) /**< Hot-path counters and timers. */
 };
 
 #endif /* UWSR_H */
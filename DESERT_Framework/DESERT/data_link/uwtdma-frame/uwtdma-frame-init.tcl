@@ -32,6 +32,7 @@
 
 Module/UW/TDMA_FRAME set debug_ 											0
 Module/UW/TDMA_FRAME set max_packet_per_slot                                1
+Module/UW/TDMA_FRAME set tx_range_                                          0
 Module/UW/TDMA_FRAME instproc init {args} {
     $self next $args
     $self settag "UW/TDMA_FR"
@@ -43,6 +43,8 @@
 #include <stdlib.h>
 #include <mac.h>
 #include <string>
+#include <algorithm>
+#include <cmath>
 
 extern packet_t PT_UWHEALTHCBR;
 extern packet_t PT_UWCONTROLCBR;
@@ -79,17 +81,41 @@ public:
 
 UwTDMA_frame::UwTDMA_frame()
 	: UwTDMA()
-	, tot_nodes(0)
 	, my_slots_counter(0)
+	, tot_nodes(0)
+	, topology_index(0)
+	, tx_range_(0)
+	, s_()
+	, my_slot_numbers_()
 	, topology_S_file_name_("")
+	, adjacency_file_name_("")
+	, position_file_name_("")
 	, topology_S_token_separator_(',')
-	, topology_index(0)
 {
 	fair_mode = 1;
 	{
 		bind("guard_time", (double *) &guard_time);
 		tot_slots = 0;
 	}
+	bind("tx_range_", (double *) &tx_range_);
+}
+
+/**
+ * Split a line of a topology file into numeric tokens.
+ * @param line line to be parsed
+ * @param separator character used as token separator
+ * @param values vector filled with the parsed values
+ */
+static void
+parseTopologyLine(const string &line, char separator,
+		std::vector<double> &values)
+{
+	::std::stringstream line_stream(line);
+	string result_;
+	values.clear();
+	while (std::getline(line_stream, result_, separator)) {
+		values.push_back(atof(result_.c_str()));
+	}
 }
 
 UwTDMA_frame::~UwTDMA_frame()
@@ -108,8 +134,7 @@ UwTDMA_frame::changeStatus()
 	}
 	if (slot_status == UW_TDMA_STATUS_MY_SLOT) {
 		slot_status = UW_TDMA_STATUS_NOT_MY_SLOT;
-		int num_jumping_slots =
-				getNextMySlot()->first - getCurrentSlot()->first;
+		int num_jumping_slots = getNextMySlot() - getCurrentSlot();
 		num_jumping_slots = num_jumping_slots > 0
 				? num_jumping_slots
 				: num_jumping_slots + tot_slots;
@@ -123,7 +148,7 @@ UwTDMA_frame::changeStatus()
 		if (sea_trial_)
 			out_file_stats << left << "[" << getEpoch() << "]::" << NOW
 						   << "::TDMA_node(" << addr << ")::Off timeslot "
-						   << getCurrentSlot()->first << std::endl;
+						   << getCurrentSlot() << std::endl;
 	} else
 		UwTDMA::changeStatus();
 }
@@ -144,6 +169,10 @@ UwTDMA_frame::command(int argc, const char *const *argv)
 							 "initialize the topology"
 						  << std::endl;
 				return TCL_ERROR;
+			} else if (my_slot_numbers_.empty()) {
+				std::cout << "Error: node " << topology_index
+						  << " has no slot in the topology" << std::endl;
+				return TCL_ERROR;
 			} else {
 				slot_duration = frame_duration / tot_slots;
 				if (slot_duration - guard_time < 0) {
@@ -151,15 +180,17 @@ UwTDMA_frame::command(int argc, const char *const *argv)
 							  << std::endl;
 					return TCL_ERROR;
 				} else {
-					Slot::iterator iter = my_slot_numbers_.begin();
-          start_time = iter->first * slot_duration;
-					start(iter->first * slot_duration);
+					start_time = my_slot_numbers_[0] * slot_duration;
+					start(start_time);
 					return TCL_OK;
 				}
 			}
 		} else if (strcasecmp(argv[1], "stop") == 0) {
 			stop();
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "get_tot_slots") == 0) {
+			tcl.resultf("%d", tot_slots);
+			return TCL_OK;
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "setSlotNumber") == 0) {
@@ -185,37 +216,63 @@ UwTDMA_frame::command(int argc, const char *const *argv)
 			}
 			topology_S_token_separator_ = tmp_.at(0);
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "setAdjacencyFileName") == 0) {
+			string tmp_ = ((char *) argv[2]);
+			if (tmp_.size() == 0) {
+				fprintf(stderr, "Empty string for the file name");
+				return TCL_ERROR;
+			}
+			adjacency_file_name_ = tmp_;
+			return (initializeTopologyFromAdjacency() ? TCL_OK : TCL_ERROR);
+		} else if (strcasecmp(argv[1], "setPositionFileName") == 0) {
+			string tmp_ = ((char *) argv[2]);
+			if (tmp_.size() == 0) {
+				fprintf(stderr, "Empty string for the file name");
+				return TCL_ERROR;
+			}
+			if (tx_range_ <= 0) {
+				fprintf(stderr, "tx_range_ must be positive to generate "
+								"the schedule from positions");
+				return TCL_ERROR;
+			}
+			position_file_name_ = tmp_;
+			return (initializeTopologyFromPositions() ? TCL_OK : TCL_ERROR);
 		}
 	}
 	return UwTDMA::command(argc, argv);
 }
 
-Slot::iterator
+int
 UwTDMA_frame::getCurrentSlot()
 {
-	Slot::iterator iter = my_slot_numbers_.begin();
 	int pos = ((my_slots_counter - 1) % my_slot_numbers_.size());
-	// std::cout<< NOW << " ID:" << addr << " Slots SIZE:" <<
-	// my_slot_numbers_.size() << std::endl;
 	if (debug_ < -5)
 		std::cout << NOW << " ID:" << addr << " Slot Pos:" << pos << std::endl;
-	for (int i = 0; i < pos; i++) {
-		iter++;
-	}
-	return iter;
+	return my_slot_numbers_[pos];
 }
 
-Slot::iterator
+int
 UwTDMA_frame::getNextMySlot(int skip)
 {
-	Slot::iterator iter = my_slot_numbers_.begin();
 	int pos = ((my_slots_counter + skip) % my_slot_numbers_.size());
 	if (debug_ < -5)
 		std::cout << NOW << " ID:" << addr << " Pos:" << pos << std::endl;
-	for (int i = 0; i < pos; i++) {
-		iter++;
+	return my_slot_numbers_[pos];
+}
+
+void
+UwTDMA_frame::compileMySlots()
+{
+	my_slot_numbers_.clear();
+	if (topology_index < 1 || topology_index > tot_nodes) {
+		cerr << NOW << " ID " << addr << ": topology index " << topology_index
+			 << " out of the topology (" << tot_nodes << " nodes)" << endl;
+		return;
+	}
+	for (int slot = 1; slot <= tot_slots; slot++) {
+		if (getSlotStatus(topology_index, slot) > 0)
+			my_slot_numbers_.push_back(slot);
 	}
-	return iter;
 }
 
 void
@@ -224,39 +281,30 @@ UwTDMA_frame::initializeTopologyS()
 	topology_index = topology_index ? topology_index : addr;
 	ifstream input_file_;
 	string line_;
-	char *tmp_ = new char[topology_S_file_name_.length() + 1];
-	strcpy(tmp_, topology_S_file_name_.c_str());
-	input_file_.open(tmp_);
-	int slot_number = 0;
-	if(tot_slots || tot_nodes) { //initialize the frame again due to frame change
-		tot_slots = 0;
-		tot_nodes = 0;
-		s_.clear();
-		my_slot_numbers_.clear();
-	}	
+	std::vector<std::vector<double> > rows;
+	std::vector<double> values;
+	tot_slots = 0;
+	tot_nodes = 0;
+	s_.clear();
+	my_slot_numbers_.clear();
+	input_file_.open(topology_S_file_name_.c_str());
 	if (input_file_.is_open()) {
 		while (std::getline(input_file_, line_)) {
-			::std::stringstream line_stream(line_);
-			string result_;
-			slot_number = 0;
-			while (std::getline(
-					line_stream, result_, topology_S_token_separator_)) {
-				slot_number++;
-				int tx_status = atoi(result_.c_str());
-				s_[tot_nodes + 1][slot_number] = tx_status;
-				if (tot_nodes + 1 == topology_index && tx_status > 0) {
-					// cout << "Node " <<addr << "S[" << slot_number << "] = "
-					// << tx_status <<endl;
-					my_slot_numbers_[slot_number] = tx_status;
-				}
-				if (!tot_nodes) {
-					tot_slots++;
-				}
-			}
+			parseTopologyLine(line_, topology_S_token_separator_, values);
+			if (values.empty())
+				continue;
+			if (!tot_nodes)
+				tot_slots = values.size();
+			rows.push_back(values);
 			tot_nodes++;
 		}
-		// std::cout << NOW << " ID " << addr << " num slots: "
-		// <<my_slot_numbers_.size() << std::endl;
+		s_.assign(tot_nodes * tot_slots, 0);
+		for (int node = 0; node < tot_nodes; node++) {
+			int n_slots = std::min((int) rows[node].size(), tot_slots);
+			for (int slot = 0; slot < n_slots; slot++)
+				s_[node * tot_slots + slot] = (int) rows[node][slot];
+		}
+		compileMySlots();
 	} else {
 		cerr << "Impossible to open file " << topology_S_file_name_.c_str() <<
 				endl;
@@ -267,3 +315,142 @@ UwTDMA_frame::initializeTopologyS()
 				  << ", Slots in a frame = " << tot_slots << std::endl;
 	}
 }
+
+bool
+UwTDMA_frame::initializeTopologyFromAdjacency()
+{
+	ifstream input_file_;
+	string line_;
+	std::vector<std::vector<double> > rows;
+	std::vector<double> values;
+	input_file_.open(adjacency_file_name_.c_str());
+	if (!input_file_.is_open()) {
+		cerr << "Impossible to open file " << adjacency_file_name_ << endl;
+		return false;
+	}
+	while (std::getline(input_file_, line_)) {
+		parseTopologyLine(line_, topology_S_token_separator_, values);
+		if (!values.empty())
+			rows.push_back(values);
+	}
+	int n = rows.size();
+	AdjacencyMatrix adj(n, std::vector<bool>(n, false));
+	for (int i = 0; i < n; i++) {
+		int n_cols = std::min((int) rows[i].size(), n);
+		for (int j = 0; j < n_cols; j++) {
+			if (i != j && rows[i][j] != 0) {
+				adj[i][j] = true;
+				adj[j][i] = true;
+			}
+		}
+	}
+	generateTopologyS(adj);
+	return true;
+}
+
+bool
+UwTDMA_frame::initializeTopologyFromPositions()
+{
+	ifstream input_file_;
+	string line_;
+	std::vector<std::vector<double> > pos;
+	std::vector<double> values;
+	input_file_.open(position_file_name_.c_str());
+	if (!input_file_.is_open()) {
+		cerr << "Impossible to open file " << position_file_name_ << endl;
+		return false;
+	}
+	while (std::getline(input_file_, line_)) {
+		parseTopologyLine(line_, topology_S_token_separator_, values);
+		if (values.empty())
+			continue;
+		values.resize(3, 0);
+		pos.push_back(values);
+	}
+	int n = pos.size();
+	double range2 = tx_range_ * tx_range_;
+	AdjacencyMatrix adj(n, std::vector<bool>(n, false));
+	for (int i = 0; i < n; i++) {
+		for (int j = i + 1; j < n; j++) {
+			double dx = pos[i][0] - pos[j][0];
+			double dy = pos[i][1] - pos[j][1];
+			double dz = pos[i][2] - pos[j][2];
+			if (dx * dx + dy * dy + dz * dz <= range2) {
+				adj[i][j] = true;
+				adj[j][i] = true;
+			}
+		}
+	}
+	generateTopologyS(adj);
+	return true;
+}
+
+void
+UwTDMA_frame::generateTopologyS(const AdjacencyMatrix &adj)
+{
+	int n = adj.size();
+	std::vector<std::vector<int> > neighbours(n);
+	for (int i = 0; i < n; i++) {
+		for (int j = 0; j < n; j++) {
+			if (i != j && adj[i][j])
+				neighbours[i].push_back(j);
+		}
+	}
+
+	// conflicts: one and two hop neighbours
+	std::vector<std::vector<int> > conflicts(n);
+	std::vector<int> mark(n, -1);
+	for (int i = 0; i < n; i++) {
+		mark[i] = i;
+		for (size_t a = 0; a < neighbours[i].size(); a++) {
+			int j = neighbours[i][a];
+			if (mark[j] != i) {
+				mark[j] = i;
+				conflicts[i].push_back(j);
+			}
+			for (size_t b = 0; b < neighbours[j].size(); b++) {
+				int k = neighbours[j][b];
+				if (mark[k] != i) {
+					mark[k] = i;
+					conflicts[i].push_back(k);
+				}
+			}
+		}
+	}
+
+	// greedy colouring, most constrained nodes first
+	std::vector<std::pair<int, int> > order(n);
+	for (int i = 0; i < n; i++)
+		order[i] = std::make_pair(-(int) conflicts[i].size(), i);
+	std::sort(order.begin(), order.end());
+	std::vector<int> colour(n, -1);
+	std::vector<int> used(n + 1, -1);
+	int n_colours = 0;
+	for (int o = 0; o < n; o++) {
+		int i = order[o].second;
+		for (size_t c = 0; c < conflicts[i].size(); c++) {
+			int col = colour[conflicts[i][c]];
+			if (col >= 0)
+				used[col] = i;
+		}
+		int col = 0;
+		while (used[col] == i)
+			col++;
+		colour[i] = col;
+		n_colours = std::max(n_colours, col + 1);
+	}
+
+	topology_index = topology_index ? topology_index : addr;
+	tot_nodes = n;
+	tot_slots = n_colours;
+	s_.assign(tot_nodes * tot_slots, 0);
+	for (int i = 0; i < n; i++)
+		s_[i * tot_slots + colour[i]] = 1;
+	compileMySlots();
+
+	if (debug_) {
+		std::cout << NOW << " ID " << addr
+				  << ": Topology S generated, tot_nodes = " << tot_nodes
+				  << ", Slots in a frame = " << tot_slots << std::endl;
+	}
+}
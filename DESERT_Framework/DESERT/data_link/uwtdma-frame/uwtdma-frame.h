@@ -47,12 +47,16 @@
 #include <fstream>
 #include <sys/time.h>
 #include <vector>
-#include <map>
 
-
-
-typedef std::map<int, int> Slot;
-typedef std::map<int, Slot> SlotTopology;
+/**
+ * Flat, row-major slot table: entry (node - 1) * tot_slots + (slot - 1)
+ * holds the transmission status of node <i>node</i> in slot <i>slot</i>.
+ */
+typedef std::vector<int> SlotTopology;
+/**
+ * Adjacency matrix of the network used by the schedule generator.
+ */
+typedef std::vector<std::vector<bool> > AdjacencyMatrix;
 
 class UwTDMA_frame;
 
@@ -98,8 +102,56 @@ protected:
 	 */
 	virtual void initializeTopologyS();
 
-	Slot::iterator getCurrentSlot();
-	Slot::iterator getNextMySlot(int skip = 0);
+	/**
+	 * Build a conflict-free schedule from the adjacency matrix of the
+	 * network. Two nodes cannot share a slot if they are neighbours or if
+	 * they have a common neighbour, so the schedule is a distance-2
+	 * colouring of the network graph. Nodes are coloured greedily in
+	 * decreasing order of conflict degree to keep the frame short.
+	 * @param adj adjacency matrix of the network, one row per node
+	 */
+	virtual void generateTopologyS(const AdjacencyMatrix &adj);
+
+	/**
+	 * Read the adjacency matrix from file and generate the schedule.
+	 * @return true if the file was read correctly, false otherwise
+	 */
+	bool initializeTopologyFromAdjacency();
+
+	/**
+	 * Read the node positions from file, link the nodes closer than
+	 * <i>tx_range_</i> and generate the schedule.
+	 * @return true if the file was read correctly, false otherwise
+	 */
+	bool initializeTopologyFromPositions();
+
+	/**
+	 * Extract the slots of this node from the slot table, so that the
+	 * current and next slots can be found with a single indexed access.
+	 */
+	void compileMySlots();
+
+	/**
+	 * Transmission status of a node in a slot.
+	 * @param node index of the node (starting from 1)
+	 * @param slot index of the slot (starting from 1)
+	 * @return the value of the S matrix, 0 if the node is silent
+	 */
+	inline int
+	getSlotStatus(int node, int slot) const
+	{
+		return s_[(node - 1) * tot_slots + (slot - 1)];
+	}
+
+	/**
+	 * @return the index (starting from 1) of the current slot of the node
+	 */
+	int getCurrentSlot();
+	/**
+	 * @param skip number of own slots to skip
+	 * @return the index (starting from 1) of the next slot of the node
+	 */
+	int getNextMySlot(int skip = 0);
 
 	int my_slots_counter; /**<count the passed number of slots in which it was
 							 active*/
@@ -108,15 +160,18 @@ protected:
 	int max_packet_per_slot; /**<max numer of packet it can transmit per slot */
 	int packet_sent_curr_slot_; /**<counter of packet has been sent in the
 								   current slot */
+	double tx_range_; /**<transmission range used to link nodes when the
+						 schedule is generated from a position file */
 	SlotTopology
 			s_; /**<matrix cointaining the transmission schedule of all the
 				   network */
-	Slot my_slot_numbers_; /**<set the position of the node in the frame
-							  (fair_mode)
-										  (starting from 0 to tot_slots-1)*/
+	std::vector<int> my_slot_numbers_; /**<sorted slots of the node in the
+										  frame (starting from 1)*/
 
 private:
 	string topology_S_file_name_; /**<Topology S file name */
+	string adjacency_file_name_; /**<Adjacency matrix file name */
+	string position_file_name_; /**<Node position file name */
 	char topology_S_token_separator_; /**<character used as token separator when
 										 importing
 										  the S topology from file*/
@@ -70,6 +70,9 @@ public:
 
 } class_uwtdma;
 
+const char *const UwTDMA::perf_probe_names[] = {"recvFromUpperLayers",
+		"txData", "Phy2MacEndTx", "Phy2MacEndRx", "changeStatus"};
+
 void
 UwTDMATimer::expire(Event *e)
 {
@@ -135,6 +138,7 @@ UwTDMA::UwTDMA()
 			 << std::endl; 
 		mac2phy_delay_ = 1e-9;
 	}
+	UWPERF_INIT(perf_stats, UWTDMA_PERF_NPROBES, perf_probe_names);
 }
 
 UwTDMA::~UwTDMA()
@@ -144,6 +148,7 @@ UwTDMA::~UwTDMA()
 void
 UwTDMA::recvFromUpperLayers(Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, UWTDMA_PERF_RECV_UPPER);
 	incrUpperDataRx();
 	if (buffer.size() < max_queue_size) {
 		initPkt(p);
@@ -202,6 +207,7 @@ UwTDMA::stateTxData()
 void
 UwTDMA::txData()
 {
+	UWPERF_SCOPE(perf_stats, UWTDMA_PERF_TX_DATA);
 	if (packet_sent_curr_slot_ < max_packet_per_slot) {
 		if (slot_status == UW_TDMA_STATUS_MY_SLOT && transceiver_status == IDLE) {
 			if (buffer.size() > 0) {
@@ -257,6 +263,7 @@ UwTDMA::Mac2PhyStartTx(Packet *p)
 void
 UwTDMA::Phy2MacEndTx(const Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, UWTDMA_PERF_END_TX);
 	transceiver_status = IDLE;
 	packet_sent_curr_slot_++;
 	if (sea_trial_)
@@ -280,6 +287,7 @@ UwTDMA::Phy2MacStartRx(const Packet *p)
 void
 UwTDMA::Phy2MacEndRx(Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, UWTDMA_PERF_END_RX);
 	if (transceiver_status != TRANSMITTING) {
 		hdr_cmn *ch = HDR_CMN(p);
 		hdr_mac *mach = HDR_MAC(p);
@@ -358,6 +366,7 @@ UwTDMA::rxPacketNotForMe(Packet *p)
 void
 UwTDMA::changeStatus()
 {
+	UWPERF_SCOPE(perf_stats, UWTDMA_PERF_CHANGE_STATUS);
 	packet_sent_curr_slot_ = 0;
 	if (slot_status == UW_TDMA_STATUS_MY_SLOT) {
 		slot_status = UW_TDMA_STATUS_NOT_MY_SLOT;
@@ -460,6 +469,12 @@ UwTDMA::command(int argc, const char *const *argv)
 		} else if (strcasecmp(argv[1], "get_recv_pkts") == 0) {
 			tcl.resultf("%d", data_pkts_rx);
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstats") == 0) {
+			tcl.result(UWPERF_DUMP(perf_stats));
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstatsReset") == 0) {
+			UWPERF_RESET(perf_stats);
+			return TCL_OK;
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "setStartTime") == 0) {
@@ -48,6 +48,7 @@
 #include <sstream>
 #include <fstream>
 #include <sys/time.h>
+#include "uwperfstats.h"
 
 #define UW_TDMA_STATUS_MY_SLOT 1 /**< Status slot active>*/
 #define UW_TDMA_STATUS_NOT_MY_SLOT 2 /**< Status slot not active >*/
@@ -237,6 +238,21 @@ protected:
 	std::string name_label_; /**<label added in the log file, empty string by default*/
 	int checkPriority; /**<flag to set to 1 if UWCBR module uses packets with priority,
 						set to 0 otherwise. Priority can be used only with UWCBR module */
+
+	/**
+	 * Probes of the hot-path instrumentation (see uwperfstats.h).
+	 */
+	enum UWTDMA_PERF_PROBE {
+		UWTDMA_PERF_RECV_UPPER = 0,
+		UWTDMA_PERF_TX_DATA,
+		UWTDMA_PERF_END_TX,
+		UWTDMA_PERF_END_RX,
+		UWTDMA_PERF_CHANGE_STATUS,
+		UWTDMA_PERF_NPROBES
+	};
+	static const char *const perf_probe_names[UWTDMA_PERF_NPROBES]; /**< Names
+									of the probes. */
+	UWPERF_MEMBER(perf_stats) /**< Hot-path counters and timers. */
 };
 
 #endif
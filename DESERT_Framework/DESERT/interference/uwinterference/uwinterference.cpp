@@ -60,6 +60,10 @@ public:
 	}
 } class_interf_overlap;
 
+const char *const uwinterference::perf_probe_names[] = {"addToInterference",
+		"removeFromInterference", "getInterferencePower", "getTimeOverlap",
+		"getCounters"};
+
 void
 EndInterfTimer::handle(Event *e)
 {
@@ -78,12 +82,30 @@ uwinterference::uwinterference()
 	, end_rx_time(0)
 {
 	bind("use_maxinterval_", &use_maxinterval_);
+	UWPERF_INIT(perf_stats, UWINTERF_PERF_NPROBES, perf_probe_names);
 }
 
 uwinterference::~uwinterference()
 {
 }
 
+int
+uwinterference::command(int argc, const char *const *argv)
+{
+	Tcl &tcl = Tcl::instance();
+
+	if (argc == 2) {
+		if (strcasecmp(argv[1], "perfstats") == 0) {
+			tcl.result(UWPERF_DUMP(perf_stats));
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstatsReset") == 0) {
+			UWPERF_RESET(perf_stats);
+			return TCL_OK;
+		}
+	}
+	return MInterferenceMIV::command(argc, argv);
+}
+
 void
 uwinterference::addToInterference(Packet *p)
 {
@@ -107,6 +129,7 @@ uwinterference::addToInterference(Packet *p)
 void
 uwinterference::addToInterference(double pw, PKT_TYPE tp)
 {
+	UWPERF_SCOPE(perf_stats, UWINTERF_PERF_ADD);
 	if (use_maxinterval_) {
 		std::list<ListNode>::iterator it;
 		for (it = power_list.begin(); it != power_list.end();) {
@@ -150,6 +173,7 @@ uwinterference::addToInterference(double pw, PKT_TYPE tp)
 void
 uwinterference::removeFromInterference(double pw, PKT_TYPE tp)
 {
+	UWPERF_SCOPE(perf_stats, UWINTERF_PERF_REMOVE);
 	if (use_maxinterval_) {
 		std::list<ListNode>::iterator it;
 
@@ -224,6 +248,7 @@ double
 uwinterference::getInterferencePower(
 		double power, double starttime, double duration)
 {
+	UWPERF_SCOPE(perf_stats, UWINTERF_PERF_POWER);
 	std::list<ListNode>::reverse_iterator rit;
 
 	double integral = 0;
@@ -291,6 +316,7 @@ uwinterference::getTimeOverlap(Packet *p)
 double
 uwinterference::getTimeOverlap(double starttime, double duration)
 {
+	UWPERF_SCOPE(perf_stats, UWINTERF_PERF_OVERLAP);
 	std::list<ListNode>::reverse_iterator rit;
 
 	double overlap = 0;
@@ -334,6 +360,7 @@ uwinterference::getCounters(Packet *p)
 counter
 uwinterference::getCounters(double starttime, double duration, PKT_TYPE tp)
 {
+	UWPERF_SCOPE(perf_stats, UWINTERF_PERF_COUNTERS);
 	std::list<ListNode>::reverse_iterator rit;
 
 	int ctrl_pkts = 0;
@@ -40,6 +40,7 @@
 #define UW_INTERFERENCE
 
 #include <interference_miv.h>
+#include "uwperfstats.h"
 #include <list>
 #include <scheduler.h>
 #include <assert.h>
@@ -143,6 +144,16 @@ public:
 	 * Destructor of the class uwinterference
 	 */
 	virtual ~uwinterference();
+	/**
+	 * TCL command interpreter. It implements the following OTcl methods:
+	 * perfstats and perfstatsReset.
+	 *
+	 * @param argc Number of arguments in <i>argv</i>.
+	 * @param argv Array of strings which are the command parameters
+	 * @return TCL_OK or TCL_ERROR whether the command has been dispatched
+	 * successfully or not.
+	 */
+	virtual int command(int, const char *const *);
 	/**
 	 * Add a packet to the interference calculation
 	 * @param p Pointer to the interferer packet
@@ -245,6 +256,21 @@ protected:
 										 of the first interferer packet */
 	double start_rx_time; /**< timestamp of the start of reception phase */
 	double end_rx_time; /**< timetamp of the end of reception phase */
+
+	/**
+	 * Probes of the hot-path instrumentation (see uwperfstats.h).
+	 */
+	enum UWINTERF_PERF_PROBE {
+		UWINTERF_PERF_ADD = 0,
+		UWINTERF_PERF_REMOVE,
+		UWINTERF_PERF_POWER,
+		UWINTERF_PERF_OVERLAP,
+		UWINTERF_PERF_COUNTERS,
+		UWINTERF_PERF_NPROBES
+	};
+	static const char *const perf_probe_names[UWINTERF_PERF_NPROBES]; /**<
+									Names of the probes. */
+	UWPERF_MEMBER(perf_stats) /**< Hot-path counters and timers. */
 };
 
 #endif /*UW_INTERFERENCE*/
\ No newline at end of file
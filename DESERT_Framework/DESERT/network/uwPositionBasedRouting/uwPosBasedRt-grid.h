@@ -0,0 +1,280 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwPosBasedRt-grid.h
+ * @author DESERT contributors
+ * @version 1.0.0
+ *
+ * \brief Uniform grid of node positions for the nearest neighbour and within
+ * radius queries of the position based routing.
+ *
+ */
+
+#ifndef UW_POS_BASED_RT_GRID_H
+#define UW_POS_BASED_RT_GRID_H
+
+#include "uwip-module.h"
+#include <cmath>
+#include <map>
+#include <vector>
+
+/**
+ * Squared euclidean distance between two points.
+ */
+inline double
+uwposSqDistance(double x1, double y1, double z1,
+		double x2, double y2, double z2)
+{
+	double dx = x2 - x1;
+	double dy = y2 - y1;
+	double dz = z2 - z1;
+	return dx * dx + dy * dy + dz * dz;
+}
+
+/**
+ * Set of node positions, indexed by IP address, bucketed in cubic cells.
+ * A query visits only the cells that intersect the search radius, so its cost
+ * depends on the node density rather than on the total number of nodes.
+ */
+class UwPosGrid
+{
+public:
+	/**
+	 * Constructor of UwPosGrid class
+	 *
+	 * @param cell side of the cells [m], the search radius is a good choice
+	 */
+	UwPosGrid(double cell)
+		: cell_(cell > 0 ? cell : 1)
+		, seq_(0)
+	{
+	}
+
+	/**
+	 * Set the side of the cells, rebuilding the grid
+	 *
+	 * @param cell side of the cells [m]
+	 */
+	void
+	setCellSize(double cell)
+	{
+		if (cell <= 0 || cell == cell_)
+			return;
+		cell_ = cell;
+		cells_.clear();
+		for (node_map::const_iterator it = nodes_.begin(); it != nodes_.end();
+				++it)
+			cells_[keyOf(it->second)].push_back(it->second);
+	}
+
+	/**
+	 * Add a node, or move it if its IP is already in the grid
+	 */
+	void
+	update(uwip_addr_t ip, double x, double y, double z)
+	{
+		remove(ip);
+		grid_node n;
+		n.ip = ip;
+		n.x = x;
+		n.y = y;
+		n.z = z;
+		n.seq = seq_++;
+		nodes_[ip] = n;
+		cells_[keyOf(n)].push_back(n);
+	}
+
+	/**
+	 * Remove a node, if present
+	 */
+	void
+	remove(uwip_addr_t ip)
+	{
+		node_map::iterator it = nodes_.find(ip);
+		if (it == nodes_.end())
+			return;
+		cell_map::iterator c = cells_.find(keyOf(it->second));
+		std::vector<grid_node> &v = c->second;
+		for (size_t i = 0; i < v.size(); i++) {
+			if (v[i].ip == ip) {
+				v.erase(v.begin() + i);
+				break;
+			}
+		}
+		if (v.empty())
+			cells_.erase(c);
+		nodes_.erase(it);
+	}
+
+	inline bool
+	empty() const
+	{
+		return nodes_.empty();
+	}
+
+	inline size_t
+	size() const
+	{
+		return nodes_.size();
+	}
+
+	/**
+	 * Closest node to a point, strictly within a radius. Ties are broken in
+	 * favour of the node added first.
+	 *
+	 * @return IP of the node, 0 if no node is within the radius
+	 */
+	uwip_addr_t
+	nearest(double x, double y, double z, double radius) const
+	{
+		std::vector<const grid_node *> found;
+		collect(x, y, z, radius, found);
+		const grid_node *best = 0;
+		double best_d2 = radius * radius;
+		for (size_t i = 0; i < found.size(); i++) {
+			double d2 = uwposSqDistance(
+					x, y, z, found[i]->x, found[i]->y, found[i]->z);
+			if (d2 < best_d2 ||
+					(best && d2 == best_d2 && found[i]->seq < best->seq)) {
+				best = found[i];
+				best_d2 = d2;
+			}
+		}
+		return best ? best->ip : 0;
+	}
+
+	/**
+	 * Nodes strictly within a radius from a point, in no particular order
+	 *
+	 * @param[out] ips IP of the nodes found
+	 */
+	void
+	withinRadius(double x, double y, double z, double radius,
+			std::vector<uwip_addr_t> &ips) const
+	{
+		std::vector<const grid_node *> found;
+		collect(x, y, z, radius, found);
+		ips.clear();
+		double r2 = radius * radius;
+		for (size_t i = 0; i < found.size(); i++) {
+			if (uwposSqDistance(x, y, z, found[i]->x, found[i]->y,
+						found[i]->z) < r2)
+				ips.push_back(found[i]->ip);
+		}
+	}
+
+private:
+	struct grid_node {
+		uwip_addr_t ip;
+		double x;
+		double y;
+		double z;
+		unsigned long seq; /**< Insertion order. */
+	};
+
+	struct cell_key {
+		long i;
+		long j;
+		long k;
+
+		bool
+		operator<(const cell_key &o) const
+		{
+			if (i != o.i)
+				return i < o.i;
+			if (j != o.j)
+				return j < o.j;
+			return k < o.k;
+		}
+	};
+
+	typedef std::map<uwip_addr_t, grid_node> node_map;
+	typedef std::map<cell_key, std::vector<grid_node> > cell_map;
+
+	inline long
+	cellOf(double v) const
+	{
+		return (long) floor(v / cell_);
+	}
+
+	inline cell_key
+	keyOf(const grid_node &n) const
+	{
+		cell_key k;
+		k.i = cellOf(n.x);
+		k.j = cellOf(n.y);
+		k.k = cellOf(n.z);
+		return k;
+	}
+
+	/**
+	 * Candidates for a query: the nodes of the cells intersecting the cube
+	 * around the point. If the cube spans more cells than the grid holds,
+	 * all the nodes are returned.
+	 */
+	void
+	collect(double x, double y, double z, double radius,
+			std::vector<const grid_node *> &found) const
+	{
+		cell_key lo, hi;
+		lo.i = cellOf(x - radius);
+		lo.j = cellOf(y - radius);
+		lo.k = cellOf(z - radius);
+		hi.i = cellOf(x + radius);
+		hi.j = cellOf(y + radius);
+		hi.k = cellOf(z + radius);
+		double span = (double) (hi.i - lo.i + 1) * (hi.j - lo.j + 1) *
+				(hi.k - lo.k + 1);
+		if (span >= cells_.size()) {
+			for (cell_map::const_iterator c = cells_.begin();
+					c != cells_.end(); ++c)
+				for (size_t n = 0; n < c->second.size(); n++)
+					found.push_back(&c->second[n]);
+			return;
+		}
+		cell_key k;
+		for (k.i = lo.i; k.i <= hi.i; k.i++)
+			for (k.j = lo.j; k.j <= hi.j; k.j++)
+				for (k.k = lo.k; k.k <= hi.k; k.k++) {
+					cell_map::const_iterator c = cells_.find(k);
+					if (c == cells_.end())
+						continue;
+					for (size_t n = 0; n < c->second.size(); n++)
+						found.push_back(&c->second[n]);
+				}
+	}
+
+	double cell_; /**< Side of the cells [m]. */
+	unsigned long seq_; /**< Insertion counter. */
+	node_map nodes_; /**< Nodes by IP. */
+	cell_map cells_; /**< Nodes by cell. */
+};
+
+#endif // UW_POS_BASED_RT_GRID_H
@@ -41,6 +41,7 @@
 #define HDR_UWPOS_BASED_RT_H
 
 #include <packet.h>
+#include <uwip-module.h>
 
 #define HDR_UWPOS_BASED_RT(p) (hdr_uwpos_based_rt::access(p))
 
@@ -59,7 +60,7 @@ typedef struct hdr_uwpos_based_rt {
 	double y_wp_; /**<y coordinate of the last received waypoint */
 	double z_wp_; /**<z coordinate of the last received waypoint */
 	double ROV_speed_;
-	uint8_t ipROV_; /***<IP of the ROV related to the informations inserted in
+	uwip_addr_t ipROV_; /***<IP of the ROV related to the informations inserted in
 						the header. */
 	
 	static int offset_; /**< Required by the PacketHeaderManager. */
@@ -105,7 +106,7 @@ typedef struct hdr_uwpos_based_rt {
 		return ROV_speed_;
 	}
 
-	inline uint8_t& IP_ROV()
+	inline uwip_addr_t& IP_ROV()
 	{
 		return ipROV_;
 	}
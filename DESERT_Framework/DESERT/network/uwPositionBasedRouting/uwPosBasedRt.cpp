@@ -104,7 +104,7 @@ int UwPosBasedRt::command(int argc, const char *const *argv)
 			return TCL_OK;
 		}
 		if (strcasecmp(argv[1], "addr") == 0) {
-			ipAddr = static_cast<uint8_t>(atoi(argv[2]));
+			ipAddr = static_cast<uwip_addr_t>(atoi(argv[2]));
 			if (ipAddr == 0) {
 				std::cerr << "UwPosBasedRt::0 is not a valid IP address"
 					<< std::endl;
@@ -123,12 +123,12 @@ int UwPosBasedRt::command(int argc, const char *const *argv)
 	} else if (argc == 5) {
 		if (strcasecmp(argv[1], "addRoute") == 0) {
 			if (strcasecmp(argv[4], "toMovingNode") == 0) {
-				addRoute(static_cast<uint8_t>(atoi(argv[2])),
-						static_cast<uint8_t>(atoi(argv[3])),0);
+				addRoute(static_cast<uwip_addr_t>(atoi(argv[2])),
+						static_cast<uwip_addr_t>(atoi(argv[3])),0);
 				return TCL_OK;				
 			} else if (strcasecmp(argv[4], "toFixedNode") == 0) {
-				addRoute(static_cast<uint8_t>(atoi(argv[2])),
-						static_cast<uint8_t>(atoi(argv[3])),1);
+				addRoute(static_cast<uwip_addr_t>(atoi(argv[2])),
+						static_cast<uwip_addr_t>(atoi(argv[3])),1);
 				return TCL_OK;	
 			} else {
 				std::cerr << "UwPosBasedRt::invalid command, set "
@@ -210,7 +210,7 @@ void UwPosBasedRt::initPkt(Packet* p)
 	//If iph->daddr() is an address in the ROV_routing table, i.e., 
 	//destination is a vehicles, initialize packet with information about ROV
 
-	std::map<uint8_t, UwPosEstimation>::iterator itROV = 
+	std::map<uwip_addr_t, UwPosEstimation>::iterator itROV = 
 												ROV_routing.find(iph->daddr());
 	if (itROV != ROV_routing.end()) {
 
@@ -256,7 +256,7 @@ void UwPosBasedRt::updatePosInfo(Packet* p)
 
 	hdr_uwpos_based_rt *pbrh = HDR_UWPOS_BASED_RT(p);
 	
-	std::map<uint8_t, UwPosEstimation>::iterator itROV = 
+	std::map<uwip_addr_t, UwPosEstimation>::iterator itROV = 
 											ROV_routing.find(pbrh->IP_ROV());
 	if (itROV != ROV_routing.end()) { //there is an entry with this IP ROV
 
@@ -323,11 +323,11 @@ void UwPosBasedRt::updatePosInfo(Packet* p)
 
 }
 
-uint8_t UwPosBasedRt::findNextHop(const Packet* p)
+uwip_addr_t UwPosBasedRt::findNextHop(const Packet* p)
 {
 	hdr_uwip *iph = HDR_UWIP(p);
 
-	std::map<uint8_t, UwPosEstimation>::iterator itROV = 
+	std::map<uwip_addr_t, UwPosEstimation>::iterator itROV = 
 												ROV_routing.find(iph->daddr());
 	if (itROV != ROV_routing.end()) {
 		Position tempEstim = (itROV->second).getEstimatePos(NOW);
@@ -338,12 +338,15 @@ uint8_t UwPosBasedRt::findNextHop(const Packet* p)
 				<< " ,y ROV: " << tempEstim.getY() 
 				<< " ,z ROV: " << tempEstim.getZ() << std::endl;
 
-		double dist = nodesDistance(tempEstim,node_pos);
+		double dist2 = uwposSqDistance(tempEstim.getX(), tempEstim.getY(),
+				tempEstim.getZ(), node_pos.getX(), node_pos.getY(),
+				node_pos.getZ());
 		if (debug_) 
 			std::cout << NOW << " UwPosBasedRt(IP=" <<(int)ipAddr << ")::" << 
-				"estimated distance between node and ROV " << dist << std::endl;
+				"estimated distance between node and ROV " << sqrt(dist2)
+				<< std::endl;
 		
-		if (dist < maxTxRange) {
+		if (dist2 < maxTxRange * maxTxRange) {
 			if (debug_) 
 				std::cout << NOW << " UwPosBasedRt(IP=" <<(int)ipAddr 
 					<< ")::forward directly to ROV" <<std::endl;
@@ -356,7 +359,7 @@ uint8_t UwPosBasedRt::findNextHop(const Packet* p)
 	}
 
 	//ROV is not in the tx range or packet is intendet for a static node
-	std::map<uint8_t, uint8_t>::const_iterator it = 
+	std::map<uwip_addr_t, uwip_addr_t>::const_iterator it = 
 											static_routing.find(iph->daddr());
 	if (it != static_routing.end()) {
 		if (debug_) 
@@ -381,11 +384,12 @@ double UwPosBasedRt::nodesDistance(Position& p1, Position& p2)
 	double y2 = p2.getY();
 	double z2 = p2.getZ();
 
-	return sqrt(pow(x2-x1,2) + pow(y2-y1,2) + pow(z2-z1,2));
+	return sqrt(uwposSqDistance(x1, y1, z1, x2, y2, z2));
 }
 
 void UwPosBasedRt::addRoute(
-		const uint8_t &dst, const uint8_t &next, const int toFixedNode)
+		const uwip_addr_t &dst, const uwip_addr_t &next,
+		const int toFixedNode)
 {
 	if (dst == 0) {
 		std::cout << NOW << " UwPosBasedRt(IP=" <<(int)ipAddr 
@@ -394,7 +398,7 @@ void UwPosBasedRt::addRoute(
 	}
 	if (toFixedNode == 0) {
 		
-		std::map<uint8_t, UwPosEstimation>::iterator itROV = 
+		std::map<uwip_addr_t, UwPosEstimation>::iterator itROV = 
 														ROV_routing.find(dst);
 		if (itROV != ROV_routing.end()) {
 			if (debug_) 
@@ -406,17 +410,18 @@ void UwPosBasedRt::addRoute(
 				std::cout << NOW << " UwPosBasedRt(IP=" <<(int)ipAddr 
 					<< ")::inserted entry for ROV routing" << std::endl;
 			UwPosEstimation tempEstimateROVPos;
-			ROV_routing.insert(std::pair<uint8_t,
+			ROV_routing.insert(std::pair<uwip_addr_t,
 								UwPosEstimation>(dst,tempEstimateROVPos));
 		}
 
 	} 
-	std::map<uint8_t, uint8_t>::iterator it = static_routing.find(dst);
+	std::map<uwip_addr_t, uwip_addr_t>::iterator it =
+			static_routing.find(dst);
 	if (it != static_routing.end()) { //entry alredy exist
 		it->second = next;
 		return;
 	} else {
-		static_routing.insert(std::pair<uint8_t,uint8_t>(dst,next));
+		static_routing.insert(std::pair<uwip_addr_t,uwip_addr_t>(dst,next));
 	}
 	std::cout << NOW << " UwPosBasedRt(IP=" <<(int)ipAddr 
 		<< ")::addRoute, inserted entry (dest=" << (int)dst 
@@ -110,17 +110,18 @@ protected:
 	*
 	* @param Packet* Pointer to the packet will be received.
 	*/
-	virtual uint8_t findNextHop(const Packet* p);
+	virtual uwip_addr_t findNextHop(const Packet* p);
 
 	/**
 	* Add new entry to the routing table
 	*
-	* @param uint8_t Address of the destination.
-	* @param uint8_t Address of the next hop.
+	* @param uwip_addr_t Address of the destination.
+	* @param uwip_addr_t Address of the next hop.
 	* @param int Parameter to find if the dest address is a static node or a vehicle
 	*/
 	virtual void addRoute(
-			const uint8_t &dst, const uint8_t &next, const int toFixedNode);
+			const uwip_addr_t &dst, const uwip_addr_t &next,
+			const int toFixedNode);
 
 	/**
 	* Set maximum transmission range 
@@ -139,7 +140,7 @@ private:
 	virtual double nodesDistance(Position& p1, Position& p2); 
 
 
-	uint8_t ipAddr;
+	uwip_addr_t ipAddr;
 
 	double timestamp; /**<Timestamp for the validity of 
 						last received ROV position. */
@@ -149,10 +150,11 @@ private:
 
 	Position node_pos;  /**<Position of this node */
 
-	std::map<uint8_t, uint8_t> static_routing; /**< Routing table:
+	std::map<uwip_addr_t, uwip_addr_t> static_routing; /**< Routing table:
 													 destination - next hop. */
 
-	std::map<uint8_t,UwPosEstimation> ROV_routing; /**<Rouitng table for ROV. */
+	std::map<uwip_addr_t,UwPosEstimation> ROV_routing; /**<Rouitng table for
+														ROV. */
 
 	int debug_; /**< Flag to enable or disable dirrefent levels of debug. */
 
@@ -63,7 +63,7 @@ UwPosBasedRtROV::UwPosBasedRtROV()
 	: ipAddr(0)
 	, maxTxRange(3000)
 	, ROV_pos()
-	, list_posIP()
+	, grid_posIP(3000)
 {
 	bind("debug_", &debug_);
 	bind("maxTxRange_",(double *) &maxTxRange);
@@ -72,6 +72,7 @@ UwPosBasedRtROV::UwPosBasedRtROV()
 			<< " by default to 3000 m" << std::endl;
 		maxTxRange = 3000;
 	}
+	grid_posIP.setCellSize(maxTxRange);
 }
 
 UwPosBasedRtROV::~UwPosBasedRtROV()
@@ -96,7 +97,7 @@ int UwPosBasedRtROV::command(int argc, const char *const *argv)
 			return TCL_OK;
 		}
 		if (strcasecmp(argv[1], "addr") == 0) {
-			ipAddr = static_cast<uint8_t>(atoi(argv[2]));
+			ipAddr = static_cast<uwip_addr_t>(atoi(argv[2]));
 			if (ipAddr == 0) {
 				std::cerr << "UwPosBasedRtROV::0 is not a valid IP address"
 					<< std::endl;
@@ -116,7 +117,7 @@ int UwPosBasedRtROV::command(int argc, const char *const *argv)
 		if (strcasecmp(argv[1], "addPosition_IPotherNodes") == 0) { 
 			//add node position with its IP address
 			Position *p = dynamic_cast<Position*> (tcl.lookup(argv[2]));
-			uint8_t ip = static_cast<uint8_t>(atoi(argv[3]));
+			uwip_addr_t ip = static_cast<uwip_addr_t>(atoi(argv[3]));
 			if (ip == 0) {
 				std::cerr << "UwPosBasedRtROV::0 is not a valid IP address"
 					<< std::endl;
@@ -125,8 +126,8 @@ int UwPosBasedRtROV::command(int argc, const char *const *argv)
 			std::cout << NOW << " UwPosBasedRtROV(IP=" <<(int)ipAddr
 				<< ")::add node position, x:" << p->getX() << " y: "<< p->getY()
 				<< " z: " << p->getZ() << " with IP " << (int)ip << std::endl;
-			pair_posIP provv = std::pair<Position,uint8_t>(*p,ip);
-			list_posIP.push_back(provv);
+			// a node added again is moved to its new position
+			grid_posIP.update(ip, p->getX(), p->getY(), p->getZ());
 
 			return TCL_OK;
 		}
@@ -225,50 +226,24 @@ void UwPosBasedRtROV::initPkt(Packet* p)
 }
 
 
-uint8_t UwPosBasedRtROV::findNextHop(const Packet* p)
+uwip_addr_t UwPosBasedRtROV::findNextHop(const Packet* p)
 {
-	if (list_posIP.empty()) {
+	if (grid_posIP.empty()) {
 		std::cout << NOW << " UwPosBasedRtROV(IP=" <<(int)ipAddr 
 			<< ")::List of position not setted" << std::endl;
 		return 0;
 	} else {
-		double minDist = 10000000;
-		double tempDist;
-		uint8_t ipCloserNode;
-		for (std::list<pair_posIP>::iterator it=list_posIP.begin(); 
-										it != list_posIP.end(); ++it) {
-			tempDist = nodesDistance(it->first, *ROV_pos);
-			if (tempDist < minDist) {
-				minDist = tempDist;
-				ipCloserNode = it->second;
-			}
-		}
-		if (minDist < maxTxRange) {
-			if (debug_) 
-				std::cout << NOW << " UwPosBasedRtROV(IP=" <<(int)ipAddr 
-					<< ")::findNextHop,the closest node in the tx range " 
-					<< "has IP equal to " << (int)ipCloserNode << std::endl;
-			return ipCloserNode;
-		} else {
-			return (uint8_t)0;
-		}
+		uwip_addr_t ipCloserNode = grid_posIP.nearest(ROV_pos->getX(),
+				ROV_pos->getY(), ROV_pos->getZ(), maxTxRange);
+		if (ipCloserNode != 0 && debug_) 
+			std::cout << NOW << " UwPosBasedRtROV(IP=" <<(int)ipAddr 
+				<< ")::findNextHop,the closest node in the tx range " 
+				<< "has IP equal to " << (int)ipCloserNode << std::endl;
+		return ipCloserNode;
 	}
 }
 
 
-double UwPosBasedRtROV::nodesDistance(Position& p1, Position& p2)
-{
-	double x1 = p1.getX();
-	double y1 = p1.getY();
-	double z1 = p1.getZ();
-	double x2 = p2.getX();
-	double y2 = p2.getY();
-	double z2 = p2.getZ();
-
-	return sqrt(pow(x2-x1,2) + pow(y2-y1,2) + pow(z2-z1,2));
-}
-
-
 void UwPosBasedRtROV::setMaxTxRange(double newRange)
 {
 	if (newRange == 0) {
@@ -277,6 +252,7 @@ void UwPosBasedRtROV::setMaxTxRange(double newRange)
 		return;
 	}
 	maxTxRange = newRange;
+	grid_posIP.setCellSize(maxTxRange);
 	if (debug_) 		
 		std::cout << NOW << " UwPosBasedRtROV(IP=" <<(int)ipAddr 
 			<< ")::max transmission range set to "  << maxTxRange << std::endl;
@@ -52,6 +52,7 @@
 #include "uwPosBasedRt-hdr.h"
 #include "node-core.h"
 #include "uwsmposition.h"
+#include "uwPosBasedRt-grid.h"
 #include <map>
 #include <list>
 #include <tclcl.h>
@@ -102,7 +103,7 @@ protected:
 	*
 	* @param Packet* Pointer to the packet will be received.
 	*/
-	virtual uint8_t findNextHop(const Packet* p);
+	virtual uwip_addr_t findNextHop(const Packet* p);
 
 	/**
 	* Set maximum transmission range 
@@ -113,15 +114,7 @@ protected:
 
 private:
 
-	/**
-	* Compute absoulute distance between 2 nodes
-	*
-	* @param Position position first node.
-	* @param Position position second node.
-	*/
-	virtual double nodesDistance(Position& p1, Position& p2); 
-
-	uint8_t ipAddr;
+	uwip_addr_t ipAddr;
 
 	double maxTxRange; /**<Maximum transmission range, 
 						in meters, for this node. */
@@ -129,9 +122,9 @@ private:
 	UWSMPosition* ROV_pos; /**<Pointer to ROV position. 
 							Give ROV position via TCL command. */
 
-	typedef std::pair<Position,uint8_t> pair_posIP;
-	std::list<pair_posIP> list_posIP; /**<List with position of all 
-										the other nodes with its IP. */
+	UwPosGrid grid_posIP; /**<Position of all the other nodes with 
+							their IP, bucketed in cells as large as the 
+							transmission range. */
 
 	int debug_; /**< Flag to enable or disable dirrefent levels of debug. */
 
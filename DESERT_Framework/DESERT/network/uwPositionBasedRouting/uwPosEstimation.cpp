@@ -99,7 +99,7 @@ Position UwPosEstimation::getEstimatePos(double time)
 	double x = std::abs(x_ROV - x_wp);
 	double y = std::abs(y_ROV - y_wp);
 	double z = std::abs(z_ROV - z_wp);
-	double rho = sqrt(pow(x,2) + pow(y,2) + pow(z,2));
+	double rho = sqrt(x * x + y * y + z * z);
 	double theta = 0; //theta [-pi, pi]
 	double psi = 0;	//psi [0, pi]
 	double deltaT = time - timestamp;
@@ -151,5 +151,5 @@ double UwPosEstimation::nodesDistance(Position& p1, Position& p2)
 	double y2 = p2.getY();
 	double z2 = p2.getZ();
 
-	return sqrt(pow(x2-x1,2) + pow(y2-y1,2) + pow(z2-z1,2));
+	return sqrt(uwposSqDistance(x1, y1, z1, x2, y2, z2));
 }
@@ -40,6 +40,7 @@
 #define UW_POS_EST_H
 
 #include "node-core.h"
+#include "uwPosBasedRt-grid.h"
 #include <iostream>
 #include <cmath>
 
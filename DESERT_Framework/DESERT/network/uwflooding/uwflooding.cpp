@@ -121,7 +121,7 @@ UwFlooding::command(int argc, const char *const *argv)
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "addr") == 0) {
-			ipAddr_ = static_cast<uint8_t>(atoi(argv[2]));
+			ipAddr_ = static_cast<uwip_addr_t>(atoi(argv[2]));
 			if (ipAddr_ == 0) {
 				fprintf(stderr, "0 is not a valid IP address");
 				return TCL_ERROR;
@@ -242,7 +242,7 @@ UwFlooding::recv(Packet *p)
 							tmp_map.insert(std::pair<uint16_t, double>(
 									ch->uid(), Scheduler::instance().clock()));
 							my_forwarded_packets_.insert(
-									std::pair<uint8_t, map_packets>(
+									std::pair<uwip_addr_t, map_packets>(
 											iph->saddr(), tmp_map));
 							packets_forwarded_++;
 							if (trace_path_)
@@ -313,7 +313,7 @@ UwFlooding::recv(Packet *p)
 							tmp_map.insert(std::pair<uint16_t, double>(
 									ch->uid(), Scheduler::instance().clock()));
 							my_forwarded_packets_.insert(
-									std::pair<uint8_t, map_packets>(
+									std::pair<uwip_addr_t, map_packets>(
 											iph->saddr(), tmp_map));
 							packets_forwarded_++;
 							if (trace_path_)
@@ -403,9 +403,9 @@ UwFlooding::writePathInTrace(const Packet *p, const string &_info)
 	osstream_ << '\t';
 	osstream_ << static_cast<uint32_t>(flh->ttl());
 	osstream_ << '\t';
-	osstream_ << static_cast<uint32_t>(ch->prev_hop_ & 0x000000ff);
+	osstream_ << static_cast<uint32_t>(ch->prev_hop_);
 	osstream_ << '\t';
-	osstream_ << static_cast<uint32_t>(ch->next_hop() & 0x000000ff);
+	osstream_ << static_cast<uint32_t>(ch->next_hop());
 	osstream_ << '\t';
 	osstream_ << static_cast<uint32_t>(iph->saddr());
 	osstream_ << '\t';
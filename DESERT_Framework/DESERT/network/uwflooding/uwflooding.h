@@ -155,7 +155,7 @@ protected:
 private:
 	// Variables
 
-	uint8_t ipAddr_;
+	uwip_addr_t ipAddr_;
 	int ttl_; /**< Time to leave of the <i>UWFLOODING</i> packets. */
 	double maximum_cache_time_; /**< Validity time of a packet entry. */
 	int optimize_; /**< Flag used to enable the mechanism to drop packets
@@ -174,7 +174,7 @@ private:
 	typedef std::map<uint16_t, double> map_packets; /**< Typedef for a packet
 													   id: (serial_number,
 													   timestamp). */
-	typedef std::map<uint8_t, map_packets>
+	typedef std::map<uwip_addr_t, map_packets>
 			map_forwarded_packets; /**< Typedef for a map of the packet
 									  forwarded (saddr, map_packets). */
 	map_forwarded_packets
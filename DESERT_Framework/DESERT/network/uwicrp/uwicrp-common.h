@@ -47,6 +47,10 @@ static const int MAX_HOP_NUMBER =
 			  Establishment</i> packet. */
 static const int HOP_TABLE_LENGTH =
 		10; /**< Maximum length of the routing table of a node FOR UWICRP. */
+static const int ROUTE_HASH_BUCKETS =
+		16; /**< Number of hash buckets of the route cache, power of 2. */
+static const int ROUTE_WHEEL_SLOTS =
+		16; /**< Number of slots of the timer wheel of the route cache. */
 
 /**
  * routing_table_entry describes an entry in the routing table used by UWICRP.
@@ -58,6 +62,13 @@ struct routing_table_entry {
 	int hopcount; /**< Hop count. */
 	double creationtime; /**< Creation Time of the packet. */
 	bool isValid; /**< Flag to check the validity of the packet. */
+	double last_update; /**< Last time the route was learnt or used. */
+	double last_success; /**< Last time a packet sent through the route was
+							acknowledged, 0 if never. */
+	double expire_time; /**< Time at which the route expires. */
+	int hash_next; /**< Next entry in the same hash bucket, -1 if none. */
+	int wheel_prev; /**< Previous entry in the same wheel slot, -1 if none. */
+	int wheel_next; /**< Next entry in the same wheel slot, -1 if none. */
 };
 
 #endif // UWICRP_COMMON_H
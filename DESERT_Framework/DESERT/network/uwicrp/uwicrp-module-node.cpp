@@ -73,6 +73,8 @@ AckWaiting::expire(Event *e)
 
 UwIcrpNode::UwIcrpNode()
 	: ipAddr_(0)
+	, route_table()
+	, ack_waiting_dst_(0)
 	, printDebug_(0)
 	, timer_ack_waiting_(10)
 	, ackwaitingTmr_(this)
@@ -80,16 +82,8 @@ UwIcrpNode::UwIcrpNode()
 	bind("printDebug_", &printDebug_);
 	bind("maxvaliditytime_", &max_validity_time_);
 	bind("timer_ack_waiting_", &timer_ack_waiting_);
-	clearAllRouteTable();
 	cout.precision(2);
 	cout.setf(ios::floatfield, ios::fixed);
-	for (int i = 0; i < HOP_TABLE_LENGTH; i++) {
-		route_table[i].destination = 0;
-		route_table[i].hopcount = INT_MAX;
-		route_table[i].creationtime = 0;
-		route_table[i].next_hop = -1;
-		route_table[i].isValid = false;
-	}
 }
 
 UwIcrpNode::~UwIcrpNode()
@@ -122,27 +116,15 @@ UwIcrpNode::initialize()
 }
 
 void
-UwIcrpNode::clearRouteTable(const int &i)
+UwIcrpNode::clearRouteTable(nsaddr_t dst)
 {
-	if (i < HOP_TABLE_LENGTH) {
-		route_table[i].destination = 0;
-		route_table[i].hopcount = INT_MAX;
-		route_table[i].creationtime = 0;
-		route_table[i].next_hop = -1;
-		route_table[i].isValid = false;
-	}
+	route_table.remove(dst);
 }
 
 void
 UwIcrpNode::clearAllRouteTable()
 {
-	for (int i = 0; i < HOP_TABLE_LENGTH; i++) {
-		route_table[i].destination = 0;
-		route_table[i].hopcount = INT_MAX;
-		route_table[i].creationtime = 0;
-		route_table[i].next_hop = -1;
-		route_table[i].isValid = false;
-	}
+	route_table.clear();
 }
 
 int
@@ -181,7 +163,7 @@ UwIcrpNode::command(int argc, const char *const *argv)
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "ipsink") == 0) {
-			ipSink_ = static_cast<uint8_t>(atoi(argv[2]));
+			ipSink_ = static_cast<uwip_addr_t>(atoi(argv[2]));
 			if (ipSink_ == 0) {
 				fprintf(stderr, "0 is not a valid IP address");
 				return TCL_ERROR;
@@ -191,7 +173,7 @@ UwIcrpNode::command(int argc, const char *const *argv)
 					 << endl;
 			return TCL_OK;
 		} else if (strcasecmp(argv[1], "addr") == 0) {
-			ipAddr_ = static_cast<uint8_t>(atoi(argv[2]));
+			ipAddr_ = static_cast<uwip_addr_t>(atoi(argv[2]));
 			return TCL_OK;
 			if (ipAddr_ == 0) {
 				fprintf(stderr, "0 is not a valid IP address");
@@ -259,6 +241,12 @@ UwIcrpNode::recv(Packet *p)
 			} else if (ch->ptype_ == PT_UWICRP_ACK) {
 				if (iph->daddr() == ipAddr_) {
 					ackwaitingTmr_.force_cancel();
+					routing_table_entry *route_ =
+							this->findInRouteTable(ack_waiting_dst_);
+					if (route_ != NULL &&
+							route_->next_hop == ch->prev_hop_)
+						route_->last_success =
+								Scheduler::instance().clock();
 				}
 			} else { // Data packet to forward
 				if (iph->daddr() != ipAddr_) { // The destination (sink) must be
@@ -275,11 +263,13 @@ UwIcrpNode::recv(Packet *p)
 						if (this->addIpInList(p, ipAddr_)) { // The IP of the
 															 // current node is
 															 // now in the list
-							int pointer_ = this->findInRouteTable(ipSink_);
-							if (pointer_ != -1 &&
-									route_table[pointer_].next_hop !=
+							routing_table_entry *route_ =
+									this->findInRouteTable(ipSink_);
+							if (route_ != NULL &&
+									route_->next_hop !=
 											0) { // I have a valid next hop
-								ch->next_hop() = route_table[pointer_].next_hop;
+								ch->next_hop() = route_->next_hop;
+								ack_waiting_dst_ = ipSink_;
 								ackwaitingTmr_.resched(timer_ack_waiting_);
 							} else { // Otherwise send the packet in broadcast
 								ch->next_hop() = UWIP_BROADCAST;
@@ -350,10 +340,11 @@ UwIcrpNode::recv(Packet *p)
 			this->initPkt(p_new);
 			hdr_cmn *ch_new = HDR_CMN(p_new);
 			// Do I have a path to the sink?
-			int pointer_ = this->findInRouteTable(ipSink_);
-			if (pointer_ != -1 && route_table[pointer_].next_hop != 0) {
+			routing_table_entry *route_ = this->findInRouteTable(ipSink_);
+			if (route_ != NULL && route_->next_hop != 0) {
 				if (ch->next_hop() != 0) {
-					ch_new->next_hop() = route_table[pointer_].next_hop;
+					ch_new->next_hop() = route_->next_hop;
+					ack_waiting_dst_ = ipSink_;
 					ackwaitingTmr_.resched(timer_ack_waiting_);
 				}
 			}
@@ -413,54 +404,38 @@ UwIcrpNode::initPkt(Packet *p)
 void
 UwIcrpNode::addRouteEntry(Packet *p)
 {
-	// FIX this: it works only with one sink!
-	// This version doesn't take count of new best routes, it always override
-	// the olds
+	// The route toward the source of the Status packet is overridden if the
+	// new one is not longer, or if the old one was never acknowledged since
+	// it was learnt
 	hdr_cmn *ch = HDR_CMN(p);
 	hdr_uwip *iph = HDR_UWIP(p);
 	hdr_uwicrp_status *icrp_statush = HDR_UWICRP_STATUS(p);
-	if (route_table[0].destination !=
-			0) { // I have already a route to the destination
-		int new_nop_count_ = icrp_statush->list_of_hops_length() -
-				icrp_statush->pointer_to_list_of_hops();
-		if (route_table[0].isValid == false ||
-				new_nop_count_ <=
-						route_table[0]
-								.hopcount) { // I have to update the old route
-			route_table[0].destination = iph->saddr();
-			route_table[0].hopcount = icrp_statush->list_of_hops_length() -
-					icrp_statush->pointer_to_list_of_hops();
-			route_table[0].isValid = true;
-			route_table[0].creationtime = Scheduler::instance().clock();
-			route_table[0].next_hop = ch->prev_hop_;
+	double now = Scheduler::instance().clock();
+	int new_hop_count_ = icrp_statush->list_of_hops_length() -
+			icrp_statush->pointer_to_list_of_hops();
+	routing_table_entry *route_ = route_table.insert(iph->saddr(), now);
+	if (route_->isValid == false || new_hop_count_ <= route_->hopcount ||
+			route_->last_success < route_->creationtime) {
+		if (route_->next_hop != ch->prev_hop_) {
+			route_->creationtime = now;
+			route_->last_success = 0;
 		}
-	} else { // I don't have any route to the destination, save it
-		route_table[0].destination = iph->saddr();
-		route_table[0].hopcount = icrp_statush->list_of_hops_length() -
-				icrp_statush->pointer_to_list_of_hops();
-		route_table[0].isValid = true;
-		route_table[0].creationtime = Scheduler::instance().clock();
-		route_table[0].next_hop = ch->prev_hop_;
+		route_->hopcount = new_hop_count_;
+		route_->isValid = true;
+		route_->next_hop = ch->prev_hop_;
+		route_table.refresh(route_, now, max_validity_time_);
 	}
 	return;
 }
 
-int
+routing_table_entry *
 UwIcrpNode::findInRouteTable(nsaddr_t ip_)
 {
-	for (int i = 0; i < HOP_TABLE_LENGTH; i++) {
-		if (route_table[i].creationtime != 0) {
-			if ((Scheduler::instance().clock() - route_table[i].creationtime) >
-					max_validity_time_) {
-				this->clearRouteTable(i);
-			}
-		}
-		if (route_table[i].destination == ip_ && route_table[i].isValid) {
-			route_table[i].creationtime = Scheduler::instance().clock();
-			return i;
-		}
-	}
-	return -1;
+	double now = Scheduler::instance().clock();
+	routing_table_entry *route_ = route_table.find(ip_, now);
+	if (route_ != NULL)
+		route_table.refresh(route_, now, max_validity_time_);
+	return route_;
 }
 
 bool
@@ -495,22 +470,25 @@ UwIcrpNode::addIpInList(Packet *p, nsaddr_t ip_)
 void
 UwIcrpNode::printHopTable()
 {
+	double now = Scheduler::instance().clock();
 	for (int i = 0; i < HOP_TABLE_LENGTH; i++) {
-		if (route_table[i].isValid) {
+		const routing_table_entry &route_ = route_table[i];
+		if (route_.isValid) {
 			cout << "Routing table node: " << this->printIP(ipAddr_) << endl;
-			cout << i << " : " << '\t'
-				 << this->printIP(route_table[i].destination) << '\t'
-				 << "next hop: " << this->printIP(route_table[i].next_hop)
-				 << '\t' << "hop count: " << route_table[i].hopcount << endl;
+			cout << i << " : " << '\t' << this->printIP(route_.destination)
+				 << '\t' << "next hop: " << this->printIP(route_.next_hop)
+				 << '\t' << "hop count: " << route_.hopcount << '\t'
+				 << "age: " << now - route_.creationtime << '\t'
+				 << "last success: " << route_.last_success << endl;
 		}
 	}
 }
 
 string
-UwIcrpNode::printIP(const uint8_t _ip)
+UwIcrpNode::printIP(const uwip_addr_t _ip)
 {
 	std::stringstream out;
-	out << "0.0.0." << ((_ip & 0x000000ff));
+	out << "0.0." << ((_ip & 0x0000ff00) >> 8) << "." << ((_ip & 0x000000ff));
 	return out.str();
 }
 
@@ -579,5 +557,5 @@ UwIcrpNode::initPktAck(Packet *p)
 void
 UwIcrpNode::ackLost()
 {
-	this->clearAllRouteTable();
+	this->clearRouteTable(ack_waiting_dst_);
 }
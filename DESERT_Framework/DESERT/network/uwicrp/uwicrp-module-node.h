@@ -44,6 +44,7 @@
 #include "uwicrp-hdr-data.h"
 #include "uwicrp-hdr-status.h"
 #include "uwicrp-common.h"
+#include "uwicrp-route-cache.h"
 #include <uwip-module.h>
 #include <uwip-clmsg.h>
 
@@ -149,11 +150,12 @@ protected:
 	virtual void initialize();
 
 	/**
-	 * Removes a specific entry in the routing table of the node.
+	 * Removes the entry of a specific destination in the routing table of the
+	 * node.
 	 *
-	 * @param int& Index number of the entry to remove.
+	 * @param nsaddr_t Address of the destination whose entry is removed.
 	 */
-	virtual void clearRouteTable(const int &);
+	virtual void clearRouteTable(nsaddr_t);
 
 	/**
 	 * Clears completely the routing table of the node.
@@ -176,13 +178,14 @@ protected:
 
 	/**
 	 * Seeks for an entry in the routing table that contains information to a
-	 * specific address passed as argument.
+	 * specific address passed as argument, and refreshes its validity.
 	 *
 	 * @param nsaddr_t Address of the destination to which search information.
-	 * @return Index value of the entry in the routing table that contains
-	 * routing information to the destination.
+	 * @return Pointer to the valid entry of the routing table that contains
+	 * routing information to the destination, NULL if none.
 	 */
-	virtual int findInRouteTable(nsaddr_t);
+	virtual routing_table_entry *findInRouteTable(nsaddr_t);
+
 
 	/**
 	 * Checks if a specific IP is in the header of the packet passed as
@@ -220,7 +223,7 @@ protected:
 	 * @param nsaddr_t& ns2 address
 	 * @return String that contains a printable IP in the classic form "x.x.x.x"
 	 */
-	virtual string printIP(const uint8_t);
+	virtual string printIP(const uwip_addr_t);
 
 	/**
 	 * Returns a nsaddr_t address from an IP written as a string in the form
@@ -247,7 +250,7 @@ protected:
 	virtual void initPktAck(Packet *p);
 
 	/**
-	 * Resets all the routing information because the lost of an ack.
+	 * Removes the route whose next hop did not send back the ack.
 	 */
 	virtual void ackLost();
 
@@ -284,10 +287,11 @@ protected:
 		return sizeof(hdr_uwicrp_status);
 	}
 
-	uint8_t ipAddr_; /**< IP of the current node. */
-	uint8_t ipSink_; /**< IP of the sink associated. */
-	routing_table_entry
-			route_table[HOP_TABLE_LENGTH]; /**< Node routing table. */
+	uwip_addr_t ipAddr_; /**< IP of the current node. */
+	uwip_addr_t ipSink_; /**< IP of the sink associated. */
+	UwIcrpRouteCache route_table; /**< Node routing table. */
+	nsaddr_t ack_waiting_dst_; /**< Destination of the route whose next hop
+								  ack is being waited for. */
 	double max_validity_time_; /**< Maximum validity time of a route. */
 	int printDebug_; /**< Flag to enable or disable dirrefent levels of debug.
 						*/
@@ -128,7 +128,7 @@ UwIcrpSink::command(int argc, const char *const *argv)
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "addr") == 0) {
-			ipAddr_ = static_cast<uint8_t>(atoi(argv[2]));
+			ipAddr_ = static_cast<uwip_addr_t>(atoi(argv[2]));
 			return TCL_OK;
 			if (ipAddr_ == 0) {
 				fprintf(stderr, "0 is not a valid IP address");
@@ -258,10 +258,10 @@ UwIcrpSink::initStatusPkt(Packet *p_old, Packet *p_new)
 }
 
 string
-UwIcrpSink::printIP(const uint8_t _ip)
+UwIcrpSink::printIP(const uwip_addr_t _ip)
 {
 	std::stringstream out;
-	out << "0.0.0." << ((_ip & 0x000000ff));
+	out << "0.0." << ((_ip & 0x0000ff00) >> 8) << "." << ((_ip & 0x000000ff));
 	return out.str();
 }
 
@@ -152,7 +152,7 @@ protected:
 	 * @param nsaddr_t& ns2 address
 	 * @return String that contains a printable IP in the classic form "x.x.x.x"
 	 */
-	virtual string printIP(const uint8_t);
+	virtual string printIP(const uwip_addr_t);
 
 	/**
 	 * Returns the size in byte of a <i>hdr_uwicrp_ack</i> packet header.
@@ -187,7 +187,7 @@ protected:
 		return sizeof(hdr_uwicrp_status);
 	}
 
-	uint8_t ipAddr_; /**< IP of the current node. */
+	uwip_addr_t ipAddr_; /**< IP of the current node. */
 	int printDebug_; /**< Flag to enable or disable dirrefent levels of debug.
 						*/
 
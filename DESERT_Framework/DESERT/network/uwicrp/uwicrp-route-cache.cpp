@@ -0,0 +1,231 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwicrp-route-cache.cpp
+ * @author DESERT contributors
+ * @version 1.0.0
+ *
+ * \brief Implements UwIcrpRouteCache.
+ *
+ * Implements UwIcrpRouteCache.
+ */
+
+#include "uwicrp-route-cache.h"
+#include <climits>
+
+UwIcrpRouteCache::UwIcrpRouteCache()
+	: free_(-1)
+	, count_(0)
+	, tick_(1)
+	, wheel_pos_(0)
+{
+	clear();
+}
+
+void
+UwIcrpRouteCache::clear()
+{
+	for (int i = 0; i < ROUTE_HASH_BUCKETS; i++)
+		buckets_[i] = -1;
+	for (int i = 0; i < ROUTE_WHEEL_SLOTS; i++)
+		wheel_[i] = -1;
+	for (int i = 0; i < HOP_TABLE_LENGTH; i++) {
+		routing_table_entry &e = entries_[i];
+		e.destination = 0;
+		e.next_hop = -1;
+		e.hopcount = INT_MAX;
+		e.creationtime = 0;
+		e.isValid = false;
+		e.last_update = 0;
+		e.last_success = 0;
+		e.expire_time = 0;
+		e.hash_next = (i + 1 < HOP_TABLE_LENGTH) ? i + 1 : -1;
+		e.wheel_prev = -1;
+		e.wheel_next = -1;
+	}
+	free_ = 0;
+	count_ = 0;
+}
+
+int
+UwIcrpRouteCache::lookup(nsaddr_t dst) const
+{
+	for (int i = buckets_[bucketOf(dst)]; i != -1; i = entries_[i].hash_next) {
+		if (entries_[i].destination == dst)
+			return i;
+	}
+	return -1;
+}
+
+routing_table_entry *
+UwIcrpRouteCache::find(nsaddr_t dst, double now)
+{
+	expire(now);
+	int i = lookup(dst);
+	if (i != -1 && entries_[i].isValid)
+		return &entries_[i];
+	return NULL;
+}
+
+routing_table_entry *
+UwIcrpRouteCache::insert(nsaddr_t dst, double now)
+{
+	expire(now);
+	int i = lookup(dst);
+	if (i != -1)
+		return &entries_[i];
+
+	if (free_ == -1) {
+		// The cache is small: look for the victim among all the entries
+		int victim = 0;
+		for (int j = 1; j < HOP_TABLE_LENGTH; j++) {
+			if (entries_[j].expire_time < entries_[victim].expire_time)
+				victim = j;
+		}
+		release(victim);
+	}
+
+	i = free_;
+	routing_table_entry &e = entries_[i];
+	free_ = e.hash_next;
+	e.destination = dst;
+	e.next_hop = -1;
+	e.hopcount = INT_MAX;
+	e.creationtime = now;
+	e.isValid = false;
+	e.last_update = now;
+	e.last_success = 0;
+	e.expire_time = now;
+	e.hash_next = buckets_[bucketOf(dst)];
+	buckets_[bucketOf(dst)] = i;
+	count_++;
+	if (count_ == 1)
+		wheel_pos_ = tickOf(now) - 1;
+	wheelLink(i);
+	return &e;
+}
+
+void
+UwIcrpRouteCache::refresh(routing_table_entry *e, double now, double validity)
+{
+	int i = static_cast<int>(e - entries_);
+	wheelUnlink(i);
+	if (count_ == 1) {
+		// No other entry is linked in the wheel: its slots can be resized
+		tick_ = validity > 0 ? validity / ROUTE_WHEEL_SLOTS : 1;
+		wheel_pos_ = tickOf(now) - 1;
+	}
+	e->last_update = now;
+	e->expire_time = now + validity;
+	wheelLink(i);
+}
+
+void
+UwIcrpRouteCache::remove(nsaddr_t dst)
+{
+	int i = lookup(dst);
+	if (i != -1)
+		release(i);
+}
+
+void
+UwIcrpRouteCache::expire(double now)
+{
+	if (count_ == 0)
+		return;
+	long cur = tickOf(now);
+	long n = cur - wheel_pos_;
+	if (n > ROUTE_WHEEL_SLOTS)
+		n = ROUTE_WHEEL_SLOTS;
+	// The slot of the current tick is visited again by the next call, as it
+	// may still hold routes expiring later in this tick
+	for (long t = cur - n + 1; t <= cur; t++) {
+		int i = wheel_[t % ROUTE_WHEEL_SLOTS];
+		while (i != -1) {
+			int next = entries_[i].wheel_next;
+			if (entries_[i].expire_time < now)
+				release(i);
+			i = next;
+		}
+	}
+	wheel_pos_ = cur - 1;
+}
+
+void
+UwIcrpRouteCache::release(int i)
+{
+	routing_table_entry &e = entries_[i];
+	int *pi = &buckets_[bucketOf(e.destination)];
+	while (*pi != i)
+		pi = &entries_[*pi].hash_next;
+	*pi = e.hash_next;
+	wheelUnlink(i);
+
+	e.destination = 0;
+	e.next_hop = -1;
+	e.hopcount = INT_MAX;
+	e.creationtime = 0;
+	e.isValid = false;
+	e.last_update = 0;
+	e.last_success = 0;
+	e.expire_time = 0;
+	e.hash_next = free_;
+	free_ = i;
+	count_--;
+}
+
+void
+UwIcrpRouteCache::wheelLink(int i)
+{
+	routing_table_entry &e = entries_[i];
+	int slot = tickOf(e.expire_time) % ROUTE_WHEEL_SLOTS;
+	e.wheel_prev = -1;
+	e.wheel_next = wheel_[slot];
+	if (e.wheel_next != -1)
+		entries_[e.wheel_next].wheel_prev = i;
+	wheel_[slot] = i;
+}
+
+void
+UwIcrpRouteCache::wheelUnlink(int i)
+{
+	routing_table_entry &e = entries_[i];
+	if (e.wheel_prev != -1) {
+		entries_[e.wheel_prev].wheel_next = e.wheel_next;
+	} else {
+		int slot = tickOf(e.expire_time) % ROUTE_WHEEL_SLOTS;
+		if (wheel_[slot] == i)
+			wheel_[slot] = e.wheel_next;
+	}
+	if (e.wheel_next != -1)
+		entries_[e.wheel_next].wheel_prev = e.wheel_prev;
+	e.wheel_prev = -1;
+	e.wheel_next = -1;
+}
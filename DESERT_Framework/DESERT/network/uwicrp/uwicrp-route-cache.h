@@ -0,0 +1,200 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+
+/**
+ * @file   uwicrp-route-cache.h
+ * @author DESERT contributors
+ * @version 1.0.0
+ *
+ * \brief Route cache used by UWICRP nodes.
+ *
+ * Route cache used by UWICRP nodes. The entries are hashed by destination
+ * and their expiry is handled by a timer wheel, so that neither the lookups
+ * nor the expiration scan the whole table.
+ */
+
+#ifndef UWICRP_ROUTE_CACHE_H
+#define UWICRP_ROUTE_CACHE_H
+
+#include "uwicrp-common.h"
+
+/**
+ * UwIcrpRouteCache is a bounded route cache with at most HOP_TABLE_LENGTH
+ * entries. The entries live in a fixed pool, chained by destination in
+ * ROUTE_HASH_BUCKETS buckets and by expiry time in the ROUTE_WHEEL_SLOTS
+ * slots of a timer wheel. The wheel is advanced lazily by find(), removing
+ * only the entries of the slots elapsed since the previous call.
+ */
+class UwIcrpRouteCache
+{
+public:
+	/**
+	 * Constructor of UwIcrpRouteCache class.
+	 */
+	UwIcrpRouteCache();
+
+	/**
+	 * Returns the valid route to a destination, after removing the expired
+	 * routes.
+	 *
+	 * @param dst Address of the destination.
+	 * @param now Current time.
+	 * @return Pointer to the entry, NULL if there is no valid route.
+	 */
+	routing_table_entry *find(nsaddr_t dst, double now);
+
+	/**
+	 * Returns the entry of a destination, allocating it if needed. A new entry
+	 * is invalid and has <i>hopcount</i> INT_MAX; if the cache is full the
+	 * route that expires first is evicted. The caller fills the entry and
+	 * calls refresh().
+	 *
+	 * @param dst Address of the destination.
+	 * @param now Current time.
+	 * @return Pointer to the entry.
+	 */
+	routing_table_entry *insert(nsaddr_t dst, double now);
+
+	/**
+	 * Marks a route as used: its expiry is moved to <i>now + validity</i>.
+	 *
+	 * @param e Entry to refresh.
+	 * @param now Current time.
+	 * @param validity Validity time of the route.
+	 */
+	void refresh(routing_table_entry *e, double now, double validity);
+
+	/**
+	 * Removes the route to a destination, if any.
+	 *
+	 * @param dst Address of the destination.
+	 */
+	void remove(nsaddr_t dst);
+
+	/**
+	 * Removes all the routes.
+	 */
+	void clear();
+
+	/**
+	 * Returns the number of entries in the cache.
+	 *
+	 * @return Number of entries.
+	 */
+	inline int
+	size() const
+	{
+		return count_;
+	}
+
+	/**
+	 * Returns the i-th slot of the pool, used or not.
+	 *
+	 * @param i Index of the slot, lower than HOP_TABLE_LENGTH.
+	 * @return Reference to the entry.
+	 */
+	inline const routing_table_entry &
+	operator[](int i) const
+	{
+		return entries_[i];
+	}
+
+protected:
+	/**
+	 * Removes the routes expired before <i>now</i>, visiting the wheel slots
+	 * elapsed since the previous call.
+	 *
+	 * @param now Current time.
+	 */
+	void expire(double now);
+
+	/**
+	 * Returns the pool index of the entry of a destination.
+	 *
+	 * @param dst Address of the destination.
+	 * @return Index of the entry, -1 if not found.
+	 */
+	int lookup(nsaddr_t dst) const;
+
+	/**
+	 * Unlinks an entry from its bucket and wheel slot and frees it.
+	 *
+	 * @param i Index of the entry.
+	 */
+	void release(int i);
+
+	/**
+	 * Links an entry in the wheel slot of its expiry time.
+	 *
+	 * @param i Index of the entry.
+	 */
+	void wheelLink(int i);
+
+	/**
+	 * Unlinks an entry from its wheel slot.
+	 *
+	 * @param i Index of the entry.
+	 */
+	void wheelUnlink(int i);
+
+	/**
+	 * Returns the wheel tick of a time.
+	 *
+	 * @param t Time.
+	 * @return Tick of <i>t</i>.
+	 */
+	inline long
+	tickOf(double t) const
+	{
+		return static_cast<long>(t / tick_);
+	}
+
+	/**
+	 * Returns the hash bucket of a destination.
+	 *
+	 * @param dst Address of the destination.
+	 * @return Index of the bucket.
+	 */
+	static inline int
+	bucketOf(nsaddr_t dst)
+	{
+		return (dst & (ROUTE_HASH_BUCKETS - 1));
+	}
+
+	routing_table_entry entries_[HOP_TABLE_LENGTH]; /**< Pool of entries. */
+	int buckets_[ROUTE_HASH_BUCKETS]; /**< Heads of the hash chains. */
+	int wheel_[ROUTE_WHEEL_SLOTS]; /**< Heads of the wheel slots. */
+	int free_; /**< Head of the free entries, chained by hash_next. */
+	int count_; /**< Number of used entries. */
+	double tick_; /**< Duration of a wheel slot, set when the cache is
+					 empty. */
+	long wheel_pos_; /**< Last wheel tick entirely elapsed. */
+};
+
+#endif // UWICRP_ROUTE_CACHE_H
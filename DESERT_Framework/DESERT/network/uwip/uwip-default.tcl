@@ -33,3 +33,4 @@
 PacketHeaderManager set tab_(PacketHeader/UWIP) 1
 
 Module/UW/IP        set debug_ 0
+Module/UW/IP        set addr_bits_ 8
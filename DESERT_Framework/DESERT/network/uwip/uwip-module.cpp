@@ -43,7 +43,9 @@ extern packet_t PT_UWIP;
 
 int hdr_uwip::offset_;
 
-uint8_t UWIPModule::lastIP = 0;
+uwip_addr_t UWIPModule::lastIP = 0;
+const char *const UWIPModule::perf_probe_names[] = {
+		"recv", "sendUp", "sendDown", "drop"};
 
 /**
  * Adds the header for <i>hdr_uwip</i> packets in ns2.
@@ -79,11 +81,14 @@ public:
 
 UWIPModule::UWIPModule()
 	: ipAddr_(0)
+	, addr_bits_(8)
 	, debug_(0)
 	, addr_type_inet(true)
 {
 	bind("debug_", &debug_);
+	bind("addr_bits_", &addr_bits_);
 	ipAddr_ = ++lastIP;
+	UWPERF_INIT(perf_stats, UWIP_PERF_NPROBES, perf_probe_names);
 }
 
 UWIPModule::~UWIPModule()
@@ -117,14 +122,24 @@ UWIPModule::command(int argc, const char *const *argv)
 		} else if (strcasecmp(argv[1], "printidspkts") == 0) {
 			this->printIdsPkts();
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstats") == 0) {
+			tcl.result(UWPERF_DUMP(perf_stats));
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstatsReset") == 0) {
+			UWPERF_RESET(perf_stats);
+			return TCL_OK;
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "addr") == 0) {
-			ipAddr_ = static_cast<uint8_t>(atoi(argv[2]));
-			if (ipAddr_ == 0) {
-				fprintf(stderr, "0 is not a valid IP address");
+			int addr = atoi(argv[2]);
+			if (addr <= 0 || (uint32_t) addr >= addrMask()) {
+				fprintf(stderr,
+						"%d is not a valid IP address with %d address bits",
+						addr,
+						addr_bits_);
 				return TCL_ERROR;
 			}
+			ipAddr_ = static_cast<uwip_addr_t>(addr);
 			return TCL_OK;
 		}
 	}
@@ -134,23 +149,28 @@ UWIPModule::command(int argc, const char *const *argv)
 void
 UWIPModule::recv(Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, UWIP_PERF_RECV);
 	hdr_cmn *ch = HDR_CMN(p);
 	hdr_uwip *iph = HDR_UWIP(p);
 
 	if (ch->direction() == hdr_cmn::UP) {
 		if (iph->saddr() == ipAddr_) {
+			UWPERF_COUNT(perf_stats, UWIP_PERF_DROP);
 			drop(p, 1, ORIGINATED_BY_ME);
 			return;
-		} else if ((ch->next_hop() & 0x000000ff) == (ipAddr_ & 0x000000ff) ||
-				(ch->next_hop() & 0x000000ff) ==
-						(UWIP_BROADCAST & 0x000000ff) ||
-				(iph->daddr() & 0x000000ff) == (ipAddr_ & 0x000000ff) ||
-				(iph->daddr() & 0x000000ff) ==
-						(UWIP_BROADCAST & 0x000000ff)) { // Right destination.
-			ch->size() -= sizeof(hdr_uwip);
+		}
+		uint32_t mask = addrMask();
+		if ((ch->next_hop() & mask) == (ipAddr_ & mask) ||
+				(ch->next_hop() & mask) == (UWIP_BROADCAST & mask) ||
+				(iph->daddr() & mask) == (ipAddr_ & mask) ||
+				(iph->daddr() & mask) ==
+						(UWIP_BROADCAST & mask)) { // Right destination.
+			ch->size() -= getIpHeaderSize();
+			UWPERF_COUNT(perf_stats, UWIP_PERF_UP);
 			sendUp(p);
 			return;
 		} else {
+			UWPERF_COUNT(perf_stats, UWIP_PERF_DROP);
 			drop(p, 1, NOT_FOR_ME_REASON);
 			return;
 		}
@@ -158,6 +178,7 @@ UWIPModule::recv(Packet *p)
 		if (iph->daddr() == ipAddr_ ||
 				ch->next_hop() == ipAddr_) { // The node is sending a packet to
 											 // itself, drop it.
+			UWPERF_COUNT(perf_stats, UWIP_PERF_DROP);
 			drop(p, 1, INVALID_DESTINATION_ADDR);
 			return;
 		}
@@ -167,7 +188,7 @@ UWIPModule::recv(Packet *p)
 			ch->addr_type() = NS_AF_ILINK;
 		}
 
-		ch->size() += sizeof(hdr_uwip);
+		ch->size() += getIpHeaderSize();
 
 		if (iph->saddr() == 0) {
 			iph->saddr() = ipAddr_;
@@ -178,6 +199,7 @@ UWIPModule::recv(Packet *p)
 		}
 
 		if (iph->daddr() == 0) {
+			UWPERF_COUNT(perf_stats, UWIP_PERF_DROP);
 			drop(p, 1, DESTINATION_ADDR_UNSET);
 			return;
 		}
@@ -190,6 +212,7 @@ UWIPModule::recv(Packet *p)
 			ch->next_hop() = iph->daddr();
 		}
 
+		UWPERF_COUNT(perf_stats, UWIP_PERF_DOWN);
 		sendDown(p);
 	} else {
 		Packet::free(p);
@@ -226,7 +249,7 @@ UWIPModule::printIP(const nsaddr_t &ip_)
 }
 
 const string
-UWIPModule::printIP(const uint8_t &ip_)
+UWIPModule::printIP(const uwip_addr_t &ip_)
 {
 	std::stringstream out;
 	out << ((ip_ & 0xff000000) >> 24);
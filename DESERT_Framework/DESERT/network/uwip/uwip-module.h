@@ -41,6 +41,7 @@
 #define _UWIPMODULE_
 
 #include <module.h>
+#include "uwperfstats.h"
 
 #include <iostream>
 #include <string>
@@ -59,8 +60,16 @@
 
 
 
-static const uint8_t UWIP_BROADCAST = static_cast<uint8_t>(
-		0x000000ff); /**< Variable used to represent a broadcast UWIP. */
+/**
+ * Type of the UWIP addresses. Addresses are 16 bits wide in the simulator;
+ * UWIPModule::addr_bits_ selects whether they are 8 or 16 bits on air.
+ */
+typedef uint16_t uwip_addr_t;
+
+static const uwip_addr_t UWIP_BROADCAST = static_cast<uwip_addr_t>(
+		0x0000ffff); /**< Variable used to represent a broadcast UWIP. */
+static const int UWIP_ADDR_BITS =
+		8 * sizeof(uwip_addr_t); /**< Bits of an uncompressed address. */
 
 extern packet_t PT_UWIP;
 
@@ -68,8 +77,8 @@ extern packet_t PT_UWIP;
  * <i>hdr_uwip</i> describes <i>UWIP</i> packets.
  */
 typedef struct hdr_uwip {
-	uint8_t saddr_; /**< IP of the source. */
-	uint8_t daddr_; /**< IP of the destination. */
+	uwip_addr_t saddr_; /**< IP of the source. */
+	uwip_addr_t daddr_; /**< IP of the destination. */
 
 	static int offset_; /**< Required by the PacketHeaderManager. */
 
@@ -91,7 +100,7 @@ typedef struct hdr_uwip {
 	/**
 	 * Reference to the saddr_ variable.
 	 */
-	uint8_t &
+	uwip_addr_t &
 	saddr()
 	{
 		return saddr_;
@@ -100,7 +109,7 @@ typedef struct hdr_uwip {
 	/**
 	 * Reference to the daddr_ variable.
 	 */
-	uint8_t &
+	uwip_addr_t &
 	daddr()
 	{
 		return daddr_;
@@ -165,12 +174,26 @@ public:
 
 	/**
 	 * Returns a string with an IP in the classic form "x.x.x.x" converting an
-	 * uint8_t address.
+	 * uwip_addr_t address.
 	 *
-	 * @param uint8_t& address
+	 * @param uwip_addr_t& address
 	 * @return String that contains a printable IP in the classic form "x.x.x.x"
 	 */
-	static const string printIP(const uint8_t &);
+	static const string printIP(const uwip_addr_t &);
+
+	/**
+	 * Returns the mask of the address bits sent on air: addresses and next
+	 * hops are compared on these bits only, as the packers may truncate
+	 * them.
+	 *
+	 * @return Mask of the on-air address bits.
+	 */
+	inline uint32_t
+	addrMask() const
+	{
+		return (addr_bits_ >= UWIP_ADDR_BITS) ? UWIP_BROADCAST
+											  : (1u << addr_bits_) - 1;
+	}
 
 	/**
 	 * Prints the IDs of the packet's headers defined by UWIP.
@@ -183,8 +206,10 @@ public:
 	}
 
 protected:
-	static uint8_t lastIP; /**< Used to set a default IP address. */
-	uint8_t ipAddr_; /**< IP address of the node. */
+	static uwip_addr_t lastIP; /**< Used to set a default IP address. */
+	uwip_addr_t ipAddr_; /**< IP address of the node. */
+	int addr_bits_; /**< Bits of the addresses on air, 8 or 16. With 8 bits
+					   the addresses range from 1 to 254. */
 	int debug_; /**< Flag to enable or disable dirrefent levels of debug. */
 	bool
 			addr_type_inet; /**< <i>true</i> if the addressing type is
@@ -192,15 +217,30 @@ protected:
 							   */
 
 	/**
-	 * Returns the size in byte of a <i>hdr_sun_data</i> packet header.
+	 * Returns the size in byte of a <i>hdr_uwip</i> packet header on air.
 	 *
-	 * @return The size of a <i>hdr_sun_data</i> packet header.
+	 * @return The size of a <i>hdr_uwip</i> packet header.
 	 */
-	static inline int
-	getIpHeaderSize()
+	inline int
+	getIpHeaderSize() const
 	{
-		return sizeof(hdr_uwip);
+		return (addr_bits_ >= UWIP_ADDR_BITS) ? sizeof(hdr_uwip)
+											  : 2 * ((addr_bits_ + 7) / 8);
 	}
+
+	/**
+	 * Probes of the hot-path instrumentation (see uwperfstats.h).
+	 */
+	enum UWIP_PERF_PROBE {
+		UWIP_PERF_RECV = 0,
+		UWIP_PERF_UP,
+		UWIP_PERF_DOWN,
+		UWIP_PERF_DROP,
+		UWIP_PERF_NPROBES
+	};
+	static const char *const perf_probe_names[UWIP_PERF_NPROBES]; /**< Names
+									of the probes. */
+	UWPERF_MEMBER(perf_stats) /**< Hot-path counters and timers. */
 };
 
 #endif // _UWIPMODULE_
@@ -60,7 +60,8 @@ public:
 } class_uwstaticrouting_module;
 
 UwStaticRoutingModule::UwStaticRoutingModule()
-	: default_gateway(0)
+	: num_routes(0)
+	, default_gateway(0)
 {
 	clearRoutes();
 }
@@ -79,10 +80,12 @@ void
 UwStaticRoutingModule::clearRoutes()
 {
 	routing_table.clear();
+	num_routes = 0;
 }
 
 void
-UwStaticRoutingModule::addRoute(const uint8_t &dst, const uint8_t &next)
+UwStaticRoutingModule::addRoute(
+		const uwip_addr_t &dst, const uwip_addr_t &next)
 {
 	if (dst == 0 || next == 0) {
 		std::cerr << "You are trying to insert an invalid entry in the routing "
@@ -92,13 +95,15 @@ UwStaticRoutingModule::addRoute(const uint8_t &dst, const uint8_t &next)
 				  << std::endl;
 		exit(EXIT_FAILURE);
 	}
-	std::map<uint8_t, uint8_t>::iterator it = routing_table.find(dst);
-	if (it != routing_table.end()) {
-		it->second = next;
+	if (dst < routing_table.size() && routing_table[dst] != 0) {
+		routing_table[dst] = next;
 		return;
 	} else {
-		if (routing_table.size() < IP_ROUTING_MAX_ROUTES) {
-			routing_table.insert(std::pair<uint8_t, uint8_t>(dst, next));
+		if (num_routes < IP_ROUTING_MAX_ROUTES) {
+			if (dst >= routing_table.size())
+				routing_table.resize(dst + 1, 0);
+			routing_table[dst] = next;
+			num_routes++;
 			return;
 		} else {
 			std::cerr << "The routing table is full!" << std::endl;
@@ -113,7 +118,7 @@ UwStaticRoutingModule::command(int argc, const char *const *argv)
 	Tcl &tcl = Tcl::instance();
 	if (argc == 2) {
 		if (strcasecmp(argv[1], "numroutes") == 0) {
-			tcl.resultf("%d", routing_table.size());
+			tcl.resultf("%d", num_routes);
 			return TCL_OK;
 		}
 		if (strcasecmp(argv[1], "clearroutes") == 0) {
@@ -122,8 +127,8 @@ UwStaticRoutingModule::command(int argc, const char *const *argv)
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "defaultGateway") == 0) {
-			if (static_cast<uint8_t>(atoi(argv[2])) != 0) {
-				default_gateway = static_cast<uint8_t>(atoi(argv[2]));
+			if (static_cast<uwip_addr_t>(atoi(argv[2])) != 0) {
+				default_gateway = static_cast<uwip_addr_t>(atoi(argv[2]));
 			} else {
 				std::cerr << "You are trying to set an invalid address as "
 							 "default gateway. Exiting ..."
@@ -135,8 +140,8 @@ UwStaticRoutingModule::command(int argc, const char *const *argv)
 
 	} else if (argc == 4) {
 		if (strcasecmp(argv[1], "addroute") == 0) {
-			addRoute(static_cast<uint8_t>(atoi(argv[2])),
-					static_cast<uint8_t>(atoi(argv[3])));
+			addRoute(static_cast<uwip_addr_t>(atoi(argv[2])),
+					static_cast<uwip_addr_t>(atoi(argv[3])));
 			return TCL_OK;
 		}
 	}
@@ -183,19 +188,18 @@ UwStaticRoutingModule::recv(Packet *p)
 	}
 }
 
-uint8_t
+uwip_addr_t
 UwStaticRoutingModule::getNextHop(const Packet *p) const
 {
 	hdr_uwip *uwiph = HDR_UWIP(p);
 	return getNextHop(uwiph->daddr());
 }
 
-uint8_t
-UwStaticRoutingModule::getNextHop(const uint8_t &dst) const
+uwip_addr_t
+UwStaticRoutingModule::getNextHop(const uwip_addr_t &dst) const
 {
-	std::map<uint8_t, uint8_t>::const_iterator it = routing_table.find(dst);
-	if (it != routing_table.end()) {
-		return it->second;
+	if (dst < routing_table.size() && routing_table[dst] != 0) {
+		return routing_table[dst];
 	} else {
 		if (default_gateway != 0) {
 			return default_gateway;
@@ -44,12 +44,12 @@
 	"DNR" /**< Reason for a drop in a <i>UWVBR</i> module. */
 
 #include <uwip-module.h>
-#include <map>
+#include <vector>
 
 namespace
 {
-static const uint16_t IP_ROUTING_MAX_ROUTES =
-		254; /**< Maximum number of entries in the routing table of a node. */
+static const uint16_t IP_ROUTING_MAX_ROUTES = UWIP_BROADCAST -
+		1; /**< Maximum number of entries in the routing table of a node. */
 }
 
 /**
@@ -102,15 +102,15 @@ public:
 	 * @param Packet* Packet to process.
 	 * @return IP of the next hop.
 	 */
-	virtual uint8_t getNextHop(const Packet *) const;
+	virtual uwip_addr_t getNextHop(const Packet *) const;
 
 	/**
 	 * Returns the next hop address of an address passed as input.
 	 *
-	 * @param nsaddr_t Address to process.
+	 * @param uwip_addr_t Address to process.
 	 * @return IP of the next hop.
 	 */
-	virtual uint8_t getNextHop(const uint8_t &) const;
+	virtual uwip_addr_t getNextHop(const uwip_addr_t &) const;
 
 	/**
 	 * Removes all the routing information.
@@ -120,15 +120,18 @@ public:
 	/**
 	 * Adds a new entry in the routing table.
 	 *
-	 * @param nsaddr_t Address of the destination.
-	 * @param nsaddr_t Address of the next hop.
+	 * @param uwip_addr_t Address of the destination.
+	 * @param uwip_addr_t Address of the next hop.
 	 */
-	virtual void addRoute(const uint8_t &, const uint8_t &);
+	virtual void addRoute(const uwip_addr_t &, const uwip_addr_t &);
 
 private:
-	std::map<uint8_t, uint8_t>
-			routing_table; /**< Routing table: destination - next hop. */
-	uint8_t default_gateway; /**< Default gateway. */
+	std::vector<uwip_addr_t>
+			routing_table; /**< Routing table: next hop indexed by destination,
+							  0 if there is no route. It grows up to the
+							  highest destination added. */
+	int num_routes; /**< Number of entries in the routing table. */
+	uwip_addr_t default_gateway; /**< Default gateway. */
 };
 
 #endif // _STATIC_ROUTING_H_
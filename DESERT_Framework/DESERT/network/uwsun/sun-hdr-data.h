@@ -42,6 +42,8 @@
 
 #include "sun-ipr-common-structures.h"
 
+#include <uwip-module.h>
+
 #include <packet.h>
 
 #define HDR_SUN_DATA(p) (hdr_sun_data::access(p))
@@ -53,7 +55,7 @@ extern packet_t PT_SUN_DATA;
  */
 typedef struct hdr_sun_data {
 
-	uint8_t list_of_hops_
+	uwip_addr_t list_of_hops_
 			[MAX_HOP_NUMBER]; /**< List of IPs saved in the header */
 	int8_t
 			pointer_to_list_of_hops_; /**< Pointer used to keep track of the
@@ -74,7 +76,7 @@ typedef struct hdr_sun_data {
 	/**
 	 * Pointer to the list_of_hops_ variable
 	 */
-	inline uint8_t *
+	inline uwip_addr_t *
 	list_of_hops()
 	{
 		return list_of_hops_;
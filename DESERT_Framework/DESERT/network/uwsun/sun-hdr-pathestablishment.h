@@ -41,6 +41,8 @@
 
 #include "sun-ipr-common-structures.h"
 
+#include <uwip-module.h>
+
 #include <packet.h>
 
 #define HDR_SUN_PATH_EST(p) (hdr_sun_path_est::access(p))
@@ -59,10 +61,11 @@ typedef u_int8_t packet_path_est;
  */
 typedef struct hdr_sun_path_est {
 
-	uint8_t sink_associated_; /**< IP of the sink associated with the packet */
+	uwip_addr_t sink_associated_; /**< IP of the sink associated with the
+									 packet */
 	packet_path_est ptype_; /**< Idientifier of the packet type: PATH_SEARCH,
 							   PATH_ANSWER or PATH_ERROR */
-	uint8_t list_of_hops_
+	uwip_addr_t list_of_hops_
 			[MAX_HOP_NUMBER]; /**< List of IPs saved in the header */
 	int8_t
 			pointer_to_list_of_hops_; /**< Pointer used to keep track of the
@@ -85,7 +88,7 @@ typedef struct hdr_sun_path_est {
 	/**
 	 * Reference to the sink_associated_ variable
 	 */
-	inline uint8_t &
+	inline uwip_addr_t &
 	sinkAssociated()
 	{
 		return (sink_associated_);
@@ -103,7 +106,7 @@ typedef struct hdr_sun_path_est {
 	/**
 	 * Pointer to the list_of_hops_ variable
 	 */
-	inline uint8_t *
+	inline uwip_addr_t *
 	list_of_hops()
 	{
 		return list_of_hops_;
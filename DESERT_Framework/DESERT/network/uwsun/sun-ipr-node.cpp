@@ -961,13 +961,13 @@ SunIPRoutingNode::createTraceString(const string &info_string,
 	osstream_.clear();
 	osstream_.str("");
 	osstream_ << info_string << this->trace_separator_ << simulation_time_
-			  << this->trace_separator_ << (node_id_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_id_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_sn_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_from_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_next_hop & 0x000000ff)
-			  << this->trace_separator_ << (pkt_source_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_destination_ & 0x000000ff)
+			  << this->trace_separator_ << node_id_
+			  << this->trace_separator_ << pkt_id_
+			  << this->trace_separator_ << pkt_sn_
+			  << this->trace_separator_ << pkt_from_
+			  << this->trace_separator_ << pkt_next_hop
+			  << this->trace_separator_ << pkt_source_
+			  << this->trace_separator_ << pkt_destination_
 			  << this->trace_separator_ << snr_ << this->trace_separator_
 			  << direction_ << this->trace_separator_ << pkt_type;
 	return osstream_.str();
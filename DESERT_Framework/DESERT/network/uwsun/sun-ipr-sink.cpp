@@ -251,11 +251,10 @@ SunIPRoutingSink::recv(Packet *p)
 					this->sendBackAck(p);
 
 					if (numberofnodes_ != 0) {
-						if (numberofnodes_ >= hdata->list_of_hops_length()) {
-							//                            cout <<
-							//                            printIP(iph->saddr())
-							//                            << endl;
-							int ip_ = (iph->saddr() & 0x000000ff);
+						int ip_ = iph->saddr();
+						if (ip_ >= 1 && ip_ <= numberofnodes_ &&
+								hdata->list_of_hops_length() <
+										MAX_HOP_NUMBER) {
 							arrayofstats_[ip_ - 1]
 										 [hdata->list_of_hops_length()]++;
 						}
@@ -540,13 +539,13 @@ SunIPRoutingSink::createTraceString(const string &info_string,
 	osstream_.clear();
 	osstream_.str("");
 	osstream_ << info_string << this->trace_separator_ << simulation_time_
-			  << this->trace_separator_ << (node_id_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_id_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_sn_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_from_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_next_hop & 0x000000ff)
-			  << this->trace_separator_ << (pkt_source_ & 0x000000ff)
-			  << this->trace_separator_ << (pkt_destination_ & 0x000000ff)
+			  << this->trace_separator_ << node_id_
+			  << this->trace_separator_ << pkt_id_
+			  << this->trace_separator_ << pkt_sn_
+			  << this->trace_separator_ << pkt_from_
+			  << this->trace_separator_ << pkt_next_hop
+			  << this->trace_separator_ << pkt_source_
+			  << this->trace_separator_ << pkt_destination_
 			  << this->trace_separator_ << snr_ << this->trace_separator_
 			  << direction_ << this->trace_separator_ << pkt_type;
 	return osstream_.str();
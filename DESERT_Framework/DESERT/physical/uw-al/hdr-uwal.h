@@ -39,6 +39,7 @@
 #define HDR_UWAL_H
 
 #include <packet.h>
+#include <uwpacketpool.h>
 
 #define HDR_UWAL(p) (hdr_uwal::access(p))
 #define MAX_BIN_PKT_ARRAY_LENGTH 2240
@@ -72,21 +73,18 @@ typedef struct hdr_uwal {
 	uint8_t Mbit_; /**< M bit: if set to 0 the current frame is the last or the
 					  only one; if set to 1 the current frame is not the last.
 					  */
-	char dummyStr_[MAX_DUMMY_STRING_LENGTH]; /**< array containing a dummy
-												string. */
+	const char *dummyStr_; /**< Dummy string, shared by all the packets of
+							  the same Uwal and never modified. Serialised
+							  only by the packer. */
+	uint32_t dummyStrLength_; /**< Number of chars of dummyStr_. */
 
 	// Fields to handle only locally (actually, this is the information to be
-	// sent over and retrieved from the channel ad modem payload...)
-	char binPkt_[MAX_BIN_PKT_ARRAY_LENGTH]; /**< array to store binary data
-											   as encoded from or to be
-											   decoded to this NS-Miracle
-											   packet header (NOTE: this
-											   CANNOT be fragmented) and the
-											   active packers linked to
-											   packer. @see classes packer
-											   and uwmphy_modem */
-	uint32_t binPktLength_; /**< number of chars in binPkt_ to consider. */
-	uint32_t binHdrLength_; /**< number of chars in binPkt_ to consider as
+	// sent over and retrieved from the channel ad modem payload...). The
+	// binary data encoded from or to be decoded to this NS-Miracle packet
+	// header and the active packers linked to packer is kept in a pooled
+	// buffer of the packet, see binPkt().
+	uint32_t binPktLength_; /**< number of chars of binPkt() to consider. */
+	uint32_t binHdrLength_; /**< number of chars of binPkt() to consider as
 							   header. */
 
 	/**
@@ -126,21 +124,46 @@ typedef struct hdr_uwal {
 	}
 
 	/**
-	 * Return the pointer to the dummyStr_ array.
+	 * Reference to the pointer to the dummy string.
 	 */
-	inline char *
+	inline const char *&
 	dummyStr()
 	{
 		return dummyStr_;
 	}
 
 	/**
-	 * Return to the binPkt_ array pointer.
+	 * Reference to the dummyStrLength_ variable.
 	 */
-	inline char *
-	binPkt()
+	inline uint32_t &
+	dummyStrLength()
+	{
+		return dummyStrLength_;
+	}
+
+	/**
+	 * Returns the binary data of a packet (NOTE: this CANNOT be fragmented),
+	 * at most MAX_BIN_PKT_ARRAY_LENGTH chars. @see classes packer and
+	 * uwmphy_modem
+	 *
+	 * @param p pointer to the packet
+	 * @param len number of chars to be read or written; the ones not
+	 *        written yet are zero
+	 */
+	inline static char *
+	binPkt(Packet *p, size_t len)
+	{
+		return UwPacketData::buffer(p, UWPOOL_SLOT_UWAL, len);
+	}
+
+	/**
+	 * Discards the binary data of a packet from the char <i>from</i> on:
+	 * the chars are zeroed again when requested through binPkt().
+	 */
+	inline static void
+	clearBinPkt(Packet *p, size_t from = 0)
 	{
-		return binPkt_;
+		UwPacketData::truncate(p, UWPOOL_SLOT_UWAL, from);
 	}
 
 	/**
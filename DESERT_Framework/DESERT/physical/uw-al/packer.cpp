@@ -37,6 +37,8 @@
 
 #include "packer.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <iomanip>
 #include <iostream>
 #include <limits.h>
@@ -120,6 +122,8 @@ public:
 
 packer::packer(bool init_)
 	: n_bits(0)
+	, layout(0)
+	, layout_bits(0)
 	, activePackers(0)
 	, payload_length(0)
 {
@@ -239,12 +243,13 @@ packer::packHdr(Packet *p)
 	size_t offset = 0;
 	packMyHdr(p, buf, offset);
 	hdr_uwal *hal = HDR_UWAL(p);
-	memset(hal->binPkt(), '\0', hdr_length);
+	char *bin = hdr_uwal::binPkt(p, hdr_length);
+	memset(bin, '\0', hdr_length);
 	hal->binHdrLength() = 0;
 
 	if (!(hdr_length > MAX_BIN_PKT_ARRAY_LENGTH)) {
 
-		memcpy(hal->binPkt(), buf, hdr_length);
+		memcpy(bin, buf, hdr_length);
 		hal->binHdrLength() = hdr_length;
 		hal->binPktLength() += hdr_length;
 
@@ -281,7 +286,7 @@ packer::packHdr(Packet *p)
 				  << " TX"
 				  << "\033[0m" << std::endl;
 		cout << "--> Bin data header generated by packer:"
-			 << hexdump(hal->binPkt(), hdr_length) << endl;
+			 << hexdump(bin, hdr_length) << endl;
 		cout << "--> Header length (unsigned char):" << hdr_length << endl;
 	}
 
@@ -293,10 +298,8 @@ packer::packPayload(Packet *p)
 {
 	std::string res;
 	hdr_uwal *hal = HDR_UWAL(p);
-	memset(hal->binPkt() + hdr_length,
-			'\0',
-			MAX_BIN_PKT_ARRAY_LENGTH - hdr_length);
-	size_t offset;
+	hdr_uwal::clearBinPkt(p, hdr_length);
+	size_t offset = 0;
 	if (!activePackers.empty()) {
 		// unsigned char *buf = new unsigned char[payload_length];
 		// memset(buf, '\0', payload_length);
@@ -312,7 +315,10 @@ packer::packPayload(Packet *p)
 		}
 
 		if (!(BARR_ARRAYSIZE(offset) > MAX_BIN_PKT_ARRAY_LENGTH - hdr_length)) {
-			memcpy(hal->binPkt() + hdr_length, buf, std::ceil(offset/8.0));
+			memcpy(hdr_uwal::binPkt(p, hdr_length + BARR_ARRAYSIZE(offset)) +
+							hdr_length,
+					buf,
+					std::ceil(offset / 8.0));
 			hal->binPktLength() += BARR_ARRAYSIZE(offset);
 			if (hal->binPktLength() != hdr_length + payload_length) {
 				if (debug_ > 1) {
@@ -390,7 +396,10 @@ packer::packPayload(Packet *p)
 				  << " TX"
 				  << "\033[0m" << std::endl;
 		std::cout << "--> Bin data payload generated by packer:"
-				  << hexdump(hal->binPkt() + hdr_length, BARR_ARRAYSIZE(offset))
+				  << hexdump(hdr_uwal::binPkt(p,
+									 hdr_length + BARR_ARRAYSIZE(offset)) +
+									 hdr_length,
+							 BARR_ARRAYSIZE(offset))
 				  << std::endl;
 		std::cout << "--> Payload length (unsigned char):"
 				  << BARR_ARRAYSIZE(offset) << std::endl;
@@ -413,18 +422,19 @@ packer::unpackHdr(Packet *p)
 {
 	hdr_uwal *hal = HDR_UWAL(p);
 	hal->binHdrLength() = hdr_length;
+	char *bin = hdr_uwal::binPkt(p, hdr_length);
 
 	if (debug_) {
 		std::cout << "\033[0;47;30m"
 				  << " RX"
 				  << "\033[0m" << std::endl;
 		std::cout << "<-- Bin data header received by packer:"
-				  << hexdump(hal->binPkt(), hdr_length) << std::endl;
+				  << hexdump(bin, hdr_length) << std::endl;
 	}
 
 	size_t offset = 0;
 
-	unpackMyHdr((unsigned char *) hal->binPkt(), offset, p);
+	unpackMyHdr((unsigned char *) bin, offset, p);
 
 	return p;
 }
@@ -443,10 +453,19 @@ packer::unpackPayload(Packet *p)
 		// std::endl;
 		hdr_cmn *ch = HDR_CMN(p);
 		std::cout << "<-- Bin data payload received by packer:"
-				  << hexdump(hal->binPkt() + hal->binHdrLength(), ch->size())
+				  << hexdump(hdr_uwal::binPkt(p,
+									 hal->binHdrLength() + ch->size()) +
+									 hal->binHdrLength(),
+							 ch->size())
 				  << std::endl;
 	}
 
+	// the packers may read up to the DEFAULT payload length also from a
+	// REDUCED packet, where the missing chars are zero
+	char *bin = hdr_uwal::binPkt(p,
+			std::max((size_t) hal->binPktLength(),
+					hal->binHdrLength() + payload_length));
+
 	if (activePackers.empty()) {
 		if (hal->binPktLength() - hal->binHdrLength() != 0) {
 			std::cout << "\033[0;0;31m"
@@ -454,7 +473,7 @@ packer::unpackPayload(Packet *p)
 					  << "\033[0m" << std::endl;
 			std::cout << "in packer::unpackPayload -> payload activePackers "
 						 "empty but binary payload: "
-					  << hexdump(hal->binPkt() + hal->binHdrLength(),
+					  << hexdump(bin + hal->binHdrLength(),
 								 hal->binPktLength() - hal->binHdrLength())
 					  << ". Packet in ERROR is returned" << std::endl;
 			hdr_cmn *ch = HDR_CMN(p);
@@ -486,7 +505,7 @@ packer::unpackPayload(Packet *p)
 			it != activePackers.end();
 			++it) {
 		offset = (*it)->unpackMyHdr(
-				(unsigned char *) (hal->binPkt() + hal->binHdrLength()),
+				(unsigned char *) (bin + hal->binHdrLength()),
 				offset,
 				p);
 	}
@@ -532,7 +551,15 @@ packer::packMyHdr(Packet *p, unsigned char *buf, size_t offset)
 	offset +=
 			put(buf, offset, &(alh->framePayloadOffset_), n_bits[field_idx++]);
 	offset += put(buf, offset, &(alh->Mbit_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(alh->dummyStr_), n_bits[field_idx++]);
+	// The dummy string is shared among the packets: copy only its chars, the
+	// buffer is already zeroed
+	size_t dummy_bits = n_bits[field_idx++];
+	if (alh->dummyStr_ != NULL)
+		put(buf,
+				offset,
+				const_cast<char *>(alh->dummyStr_),
+				std::min(dummy_bits, (size_t) alh->dummyStrLength_ * 8));
+	offset += dummy_bits;
 
 	if (debug_) {
 		std::cout << "\033[0;47;30m"
@@ -565,8 +592,10 @@ packer::unpackMyHdr(unsigned char *buf, size_t offset, Packet *p)
 	memset(&(alh->Mbit_), 0, sizeof(alh->Mbit_));
 	offset += get(buf, offset, &(alh->Mbit_), n_bits[field_idx++]);
 
-	memset(&(alh->dummyStr_), '\0', MAX_DUMMY_STRING_LENGTH);
-	offset += get(buf, offset, &(alh->dummyStr_), n_bits[field_idx++]);
+	// The received dummy content is meaningless: skip it
+	alh->dummyStr_ = NULL;
+	alh->dummyStrLength_ = 0;
+	offset += n_bits[field_idx++];
 
 	if (debug_) {
 		std::cout << "\033[0;47;30m"
@@ -646,7 +675,11 @@ packer::printMyHdrField(Packet *p, int field)
 			break;
 		case 4:
 			std::cout << "\033[0;47;30m dummy content:\033[0m "
-					  << hexdump(alh->dummyStr()) << std::endl;
+					  << (alh->dummyStr() != NULL
+									 ? hexdump(alh->dummyStr(),
+											   alh->dummyStrLength())
+									 : std::string())
+					  << std::endl;
 			break;
 		default:
 			std::cout << "\033[0;41;30m WARNING \033[0m, Field number "
@@ -672,7 +705,12 @@ packer::getMyHdrBinLength()
 size_t
 packer::get(unsigned char *buffer, size_t offset, void *val, size_t h)
 {
-	for (size_t j = 0; j < h; j++)
+	size_t j = 0;
+	if (BARR_BITNUM(offset) == 0) {
+		memcpy(val, buffer + BARR_ELNUM(offset), h / BARR_ELBITS);
+		j = (h / BARR_ELBITS) * BARR_ELBITS;
+	}
+	for (; j < h; j++)
 		if (BARR_TEST(buffer, (offset + j)))
 			BARR_SET(val, j);
 		else
@@ -684,7 +722,12 @@ packer::get(unsigned char *buffer, size_t offset, void *val, size_t h)
 size_t
 packer::put(unsigned char *buffer, size_t offset, void *val, size_t h)
 {
-	for (size_t j = 0; j < h; j++)
+	size_t j = 0;
+	if (BARR_BITNUM(offset) == 0) {
+		memcpy(buffer + BARR_ELNUM(offset), val, h / BARR_ELBITS);
+		j = (h / BARR_ELBITS) * BARR_ELBITS;
+	}
+	for (; j < h; j++)
 		if (BARR_TEST(val, j))
 			BARR_SET(buffer, (offset + j));
 		else
@@ -693,6 +736,117 @@ packer::put(unsigned char *buffer, size_t offset, void *val, size_t h)
 	return h;
 }
 
+void
+packer::clearLayout()
+{
+	n_bits.clear();
+	layout.clear();
+	layout_bits = 0;
+}
+
+void
+packer::addField(size_t width, field_kind kind)
+{
+	field_desc f;
+	f.offset = layout_bits;
+	f.width = width;
+	f.kind = (kind == FIELD_FIXED) ? FIELD_UNSIGNED : kind;
+	f.min = 0;
+	f.max = 0;
+	f.res = 0;
+
+	layout.push_back(f);
+	n_bits.push_back(width);
+	layout_bits += width;
+}
+
+void
+packer::addFixedField(size_t width, double min, double max, double res)
+{
+	addField(width);
+	if (res <= 0 || width == 0)
+		return;
+
+	field_desc &f = layout.back();
+	size_t w = std::min(width, (size_t) 64);
+	double top = min + (std::ldexp(1.0, (int) w) - 1) * res;
+
+	f.kind = FIELD_FIXED;
+	f.min = min;
+	f.res = res;
+	f.max = (max > min && max < top) ? max : top;
+	if (max > top) {
+		fprintf(stderr,
+				"packer: %lu bits with resolution %g cover [%g, %g], values "
+				"up to %g will be saturated\n",
+				(unsigned long) width,
+				res,
+				min,
+				top,
+				max);
+	}
+}
+
+void
+packer::putFieldBits(unsigned char *buf, size_t base, size_t idx,
+		const void *val, size_t size)
+{
+	const field_desc &f = layout[idx];
+	if (f.width)
+		put(buf,
+				base + f.offset,
+				const_cast<void *>(val),
+				std::min(f.width, size * BARR_ELBITS));
+}
+
+void
+packer::getFieldBits(unsigned char *buf, size_t base, size_t idx, void *val,
+		size_t size)
+{
+	const field_desc &f = layout[idx];
+	if (!f.width)
+		return;
+
+	size_t h = std::min(f.width, size * BARR_ELBITS);
+	memset(val, 0, size);
+	get(buf, base + f.offset, val, h);
+
+	if (f.kind == FIELD_SIGNED && h < size * BARR_ELBITS &&
+			BARR_TEST(val, h - 1)) {
+		for (size_t j = h; j < size * BARR_ELBITS; j++)
+			BARR_SET(val, j);
+	}
+}
+
+void
+packer::putField(unsigned char *buf, size_t base, size_t idx,
+		const double &val)
+{
+	const field_desc &f = layout[idx];
+	if (f.kind != FIELD_FIXED) {
+		putFieldBits(buf, base, idx, &val, sizeof(val));
+		return;
+	}
+
+	double v = val < f.min ? f.min : (val > f.max ? f.max : val);
+	uint64_t q = (uint64_t) std::floor((v - f.min) / f.res + 0.5);
+	putFieldBits(buf, base, idx, &q, sizeof(q));
+}
+
+void
+packer::getField(unsigned char *buf, size_t base, size_t idx, double &val)
+{
+	const field_desc &f = layout[idx];
+	if (f.kind != FIELD_FIXED) {
+		getFieldBits(buf, base, idx, &val, sizeof(val));
+		return;
+	}
+
+	uint64_t q = 0;
+	getFieldBits(buf, base, idx, &q, sizeof(q));
+	val = f.min + q * f.res;
+}
+
 std::string
 packer::hexdump_nice(std::string str)
 {
@@ -220,14 +220,120 @@ public:
 	static std::string bindump(const char *, size_t);
 
 protected:
+	/**
+	 * Encoding of a header field in the stream of bits.
+	 */
+	enum field_kind {
+		FIELD_UNSIGNED = 0, /**< Lowest bits copied verbatim. */
+		FIELD_SIGNED, /**< As FIELD_UNSIGNED, sign extended when unpacked. */
+		FIELD_FIXED /**< Double quantised on a fixed-point grid. */
+	};
+
+	/**
+	 * Entry of the compiled layout of a packer.
+	 */
+	struct field_desc {
+		size_t offset; /**< Offset of the field from the first bit of the
+						  header, in bits. */
+		size_t width; /**< Number of bits of the field. */
+		field_kind kind; /**< Encoding of the field. */
+		double min; /**< FIELD_FIXED: value coded by 0. */
+		double max; /**< FIELD_FIXED: largest value that can be coded. */
+		double res; /**< FIELD_FIXED: resolution of the grid. */
+	};
+
 	std::vector<size_t>
 			n_bits; /**< Vector of elements containing the indication of the
 					   number of bits to consider for each header field. */
 
+	std::vector<field_desc> layout; /**< Compiled layout, one entry per
+									   n_bits element, filled by addField()
+									   and addFixedField(). */
+
+	size_t layout_bits; /**< Total number of bits of the compiled layout. */
+
 	int debug_; /**< Flag to enable debug messages. */
 
 	virtual void init();
 
+	/**
+	 * Clears n_bits and the compiled layout. To be called by init() before
+	 * adding the fields again.
+	 */
+	void clearLayout();
+
+	/**
+	 * Appends a field to the layout, computing its offset.
+	 *
+	 * @param width number of bits of the field
+	 * @param kind FIELD_UNSIGNED or FIELD_SIGNED
+	 */
+	void addField(size_t width, field_kind kind = FIELD_UNSIGNED);
+
+	/**
+	 * Appends a double field quantised with step <em>res</em> starting from
+	 * <em>min</em>. Values are saturated to [min, max], and to the largest
+	 * value that fits in <em>width</em> bits. If <em>res</em> is not positive
+	 * the field falls back to the verbatim copy of the lowest bits.
+	 *
+	 * @param width number of bits of the field
+	 * @param min value coded by 0
+	 * @param max largest value to code, ignored if not greater than min
+	 * @param res resolution of the grid
+	 */
+	void addFixedField(size_t width, double min, double max, double res);
+
+	/**
+	 * Writes a field at its compiled offset.
+	 *
+	 * @param buf buffer of the header
+	 * @param base offset of the first bit of the header in <em>buf</em>
+	 * @param idx index of the field in the layout
+	 * @param val pointer to the value
+	 * @param size size of the value, in bytes
+	 */
+	void putFieldBits(unsigned char *buf, size_t base, size_t idx,
+			const void *val, size_t size);
+
+	/**
+	 * Reads a field from its compiled offset, sign extending it if needed.
+	 * Fields of width 0 leave <em>val</em> untouched.
+	 *
+	 * @param buf buffer of the header
+	 * @param base offset of the first bit of the header in <em>buf</em>
+	 * @param idx index of the field in the layout
+	 * @param val pointer to the value
+	 * @param size size of the value, in bytes
+	 */
+	void getFieldBits(unsigned char *buf, size_t base, size_t idx, void *val,
+			size_t size);
+
+	template <typename T>
+	inline void
+	putField(unsigned char *buf, size_t base, size_t idx, const T &val)
+	{
+		putFieldBits(buf, base, idx, &val, sizeof(T));
+	}
+
+	template <typename T>
+	inline void
+	getField(unsigned char *buf, size_t base, size_t idx, T &val)
+	{
+		getFieldBits(buf, base, idx, &val, sizeof(T));
+	}
+
+	/**
+	 * Writes a double field, quantising it if the field is FIELD_FIXED.
+	 */
+	void putField(unsigned char *buf, size_t base, size_t idx,
+			const double &val);
+
+	/**
+	 * Reads a double field, restoring it from the grid if the field is
+	 * FIELD_FIXED.
+	 */
+	void getField(unsigned char *buf, size_t base, size_t idx, double &val);
+
 	virtual size_t packMyHdr(Packet *, unsigned char *, size_t);
 
 	virtual size_t unpackMyHdr(unsigned char *, size_t, Packet *);
@@ -39,6 +39,12 @@ NS2/COMMON/Packer set NEXT_HOP_Bits 32
 NS2/COMMON/Packer set ADRR_TYPE_Bits 32
 NS2/COMMON/Packer set LAST_HOP_Bits 32
 NS2/COMMON/Packer set TXTIME_Bits 64
+NS2/COMMON/Packer set TIMESTAMP_Min 0
+NS2/COMMON/Packer set TIMESTAMP_Max 0
+NS2/COMMON/Packer set TIMESTAMP_Resolution 0
+NS2/COMMON/Packer set TXTIME_Min 0
+NS2/COMMON/Packer set TXTIME_Max 0
+NS2/COMMON/Packer set TXTIME_Resolution 0
      
 NS2/COMMON/Packer set errbitcnt_Bits 0
 NS2/COMMON/Packer set fecsize_Bits 0
@@ -72,6 +72,12 @@ packerCOMMON::packerCOMMON()
 	ADDR_TYPE_Bits = sizeof(int);
 	LAST_HOP_Bits = sizeof(nsaddr_t);
 	TXTIME_Bits = sizeof(double);
+	TIMESTAMP_Min = 0;
+	TIMESTAMP_Max = 0;
+	TIMESTAMP_Resolution = 0;
+	TXTIME_Min = 0;
+	TXTIME_Max = 0;
+	TXTIME_Resolution = 0;
 
 	errbitcnt_Bits = 0;
 	fecsize_Bits = 0;
@@ -96,6 +102,12 @@ packerCOMMON::packerCOMMON()
 	bind("ADDR_TYPE_Bits", (int *) &ADDR_TYPE_Bits);
 	bind("LAST_HOP_Bits", (int *) &LAST_HOP_Bits);
 	bind("TXTIME_Bits", (int *) &TXTIME_Bits);
+	bind("TIMESTAMP_Min", &TIMESTAMP_Min);
+	bind("TIMESTAMP_Max", &TIMESTAMP_Max);
+	bind("TIMESTAMP_Resolution", &TIMESTAMP_Resolution);
+	bind("TXTIME_Min", &TXTIME_Min);
+	bind("TXTIME_Max", &TXTIME_Max);
+	bind("TXTIME_Resolution", &TXTIME_Resolution);
 
 	bind("errbitcnt_Bits", (int *) &errbitcnt_Bits);
 	bind("fecsize_Bits", (int *) &fecsize_Bits);
@@ -114,32 +126,7 @@ packerCOMMON::packerCOMMON()
 				"packer "
 			 << endl;
 
-	n_bits.clear();
-	n_bits.assign(NUM_FIELDS, 0); // NUM_FIELDS zeroes as below
-
-	n_bits[PTYPE] = PTYPE_Bits;
-	n_bits[SIZE] = SIZE_Bits;
-	n_bits[UID] = UID_Bits;
-	n_bits[ERROR] = ERROR_Bits;
-	n_bits[TIMESTAMP] = TIMESTAMP_Bits;
-	n_bits[DIRECTION] = DIRECTION_Bits;
-	n_bits[PREV_HOP] = PREV_HOP_Bits;
-	n_bits[NEXT_HOP] = NEXT_HOP_Bits;
-	n_bits[ADDR_TYPE] = ADDR_TYPE_Bits;
-	n_bits[LAST_HOP] = LAST_HOP_Bits;
-	n_bits[TXTIME] = TXTIME_Bits;
-
-	n_bits[errbitcnt_] = errbitcnt_Bits;
-	n_bits[fecsize_] = fecsize_Bits;
-	n_bits[iface_] = iface_Bits;
-	n_bits[src_rt_valid] = src_rt_valid_Bits;
-	n_bits[ts_arr_] = ts_arr_Bits;
-	n_bits[aomdv_salvage_count_] = aomdv_salvage_count_Bits;
-	n_bits[xmit_failure_] = xmit_failure_Bits;
-	n_bits[xmit_failure_data_] = xmit_failure_data_Bits;
-	n_bits[xmit_reason_] = xmit_reason_Bits;
-	n_bits[num_forwards_] = num_forwards_Bits;
-	n_bits[opt_num_forwards_] = opt_num_forwards_Bits;
+	buildLayout();
 }
 
 packerCOMMON::~packerCOMMON()
@@ -153,32 +140,41 @@ packerCOMMON::init()
 	if (debug_)
 		cout << "Re-initialization of n_bits for the UWCOMMON packer " << endl;
 
-	n_bits.clear();
-	n_bits.assign(NUM_FIELDS, 0); // NUM_FIELDS zeroes as below
-
-	n_bits[PTYPE] = PTYPE_Bits;
-	n_bits[SIZE] = SIZE_Bits;
-	n_bits[UID] = UID_Bits;
-	n_bits[ERROR] = ERROR_Bits;
-	n_bits[TIMESTAMP] = TIMESTAMP_Bits;
-	n_bits[DIRECTION] = DIRECTION_Bits;
-	n_bits[PREV_HOP] = PREV_HOP_Bits;
-	n_bits[NEXT_HOP] = NEXT_HOP_Bits;
-	n_bits[ADDR_TYPE] = ADDR_TYPE_Bits;
-	n_bits[LAST_HOP] = LAST_HOP_Bits;
-	n_bits[TXTIME] = TXTIME_Bits;
-
-	n_bits[errbitcnt_] = errbitcnt_Bits;
-	n_bits[fecsize_] = fecsize_Bits;
-	n_bits[iface_] = iface_Bits;
-	n_bits[src_rt_valid] = src_rt_valid_Bits;
-	n_bits[ts_arr_] = ts_arr_Bits;
-	n_bits[aomdv_salvage_count_] = aomdv_salvage_count_Bits;
-	n_bits[xmit_failure_] = xmit_failure_Bits;
-	n_bits[xmit_failure_data_] = xmit_failure_data_Bits;
-	n_bits[xmit_reason_] = xmit_reason_Bits;
-	n_bits[num_forwards_] = num_forwards_Bits;
-	n_bits[opt_num_forwards_] = opt_num_forwards_Bits;
+	buildLayout();
+}
+
+void
+packerCOMMON::buildLayout()
+{
+	// Order must match the nbits_index enum
+	clearLayout();
+
+	addField(PTYPE_Bits);
+	addField(SIZE_Bits, FIELD_SIGNED);
+	addField(UID_Bits, FIELD_SIGNED);
+	addField(ERROR_Bits, FIELD_SIGNED);
+	addFixedField(TIMESTAMP_Bits,
+			TIMESTAMP_Min,
+			TIMESTAMP_Max,
+			TIMESTAMP_Resolution);
+	addField(DIRECTION_Bits, FIELD_SIGNED);
+	addField(PREV_HOP_Bits, FIELD_SIGNED);
+	addField(NEXT_HOP_Bits, FIELD_SIGNED);
+	addField(ADDR_TYPE_Bits, FIELD_SIGNED);
+	addField(LAST_HOP_Bits, FIELD_SIGNED);
+	addFixedField(TXTIME_Bits, TXTIME_Min, TXTIME_Max, TXTIME_Resolution);
+
+	addField(errbitcnt_Bits, FIELD_SIGNED);
+	addField(fecsize_Bits, FIELD_SIGNED);
+	addField(iface_Bits, FIELD_SIGNED);
+	addField(src_rt_valid_Bits);
+	addField(ts_arr_Bits);
+	addField(aomdv_salvage_count_Bits, FIELD_SIGNED);
+	addField(xmit_failure_Bits);
+	addField(xmit_failure_data_Bits);
+	addField(xmit_reason_Bits, FIELD_SIGNED);
+	addField(num_forwards_Bits);
+	addField(opt_num_forwards_Bits);
 }
 
 size_t
@@ -189,62 +185,37 @@ packerCOMMON::packMyHdr(Packet *p, unsigned char *buf, size_t offset)
 	hdr_cmn *ch = HDR_CMN(p);
 
 	// Common header fields useful for DESERT
-	offset += put(buf, offset, &(ch->ptype_), n_bits[PTYPE]);
-
-	offset += put(buf, offset, &(ch->size_), n_bits[SIZE]);
-
-	offset += put(buf, offset, &(ch->uid_), n_bits[UID]);
-
-	offset += put(buf, offset, &(ch->error_), n_bits[ERROR]);
-
-	offset += put(buf, offset, &(ch->ts_), n_bits[TIMESTAMP]);
-
-	offset += put(buf, offset, &(ch->direction_), n_bits[DIRECTION]);
-
-	offset += put(buf, offset, &(ch->prev_hop_), n_bits[PREV_HOP]);
-
-	offset += put(buf, offset, &(ch->next_hop_), n_bits[NEXT_HOP]);
-
-	offset += put(buf, offset, &(ch->addr_type_), n_bits[ADDR_TYPE]);
-
-	offset += put(buf, offset, &(ch->last_hop_), n_bits[LAST_HOP]);
-
-	offset += put(buf, offset, &(ch->txtime_), n_bits[TXTIME]);
+	putField(buf, offset, PTYPE, ch->ptype_);
+	putField(buf, offset, SIZE, ch->size_);
+	putField(buf, offset, UID, ch->uid_);
+	putField(buf, offset, ERROR, ch->error_);
+	putField(buf, offset, TIMESTAMP, ch->ts_);
+	putField(buf, offset, DIRECTION, ch->direction_);
+	putField(buf, offset, PREV_HOP, ch->prev_hop_);
+	putField(buf, offset, NEXT_HOP, ch->next_hop_);
+	putField(buf, offset, ADDR_TYPE, ch->addr_type_);
+	putField(buf, offset, LAST_HOP, ch->last_hop_);
+	putField(buf, offset, TXTIME, ch->txtime_);
 
 	// Other common header fields (maybe useful for future usage)
-	offset += put(buf, offset, &(ch->errbitcnt_), n_bits[errbitcnt_]);
-
-	offset += put(buf, offset, &(ch->fecsize_), n_bits[fecsize_]);
-
-	offset += put(buf, offset, &(ch->iface_), n_bits[iface_]);
-
-	offset += put(buf, offset, &(ch->src_rt_valid), n_bits[src_rt_valid]);
-
-	offset += put(buf, offset, &(ch->ts_arr_), n_bits[ts_arr_]);
-
-	offset += put(buf,
-			offset,
-			&(ch->aomdv_salvage_count_),
-			n_bits[aomdv_salvage_count_]);
-
-	offset += put(buf, offset, &(ch->xmit_failure_), n_bits[xmit_failure_]);
-
-	offset += put(
-			buf, offset, &(ch->xmit_failure_data_), n_bits[xmit_failure_data_]);
-
-	offset += put(buf, offset, &(ch->xmit_reason_), n_bits[xmit_reason_]);
-
-	offset += put(buf, offset, &(ch->num_forwards_), n_bits[num_forwards_]);
-
-	offset += put(
-			buf, offset, &(ch->opt_num_forwards_), n_bits[opt_num_forwards_]);
+	putField(buf, offset, errbitcnt_, ch->errbitcnt_);
+	putField(buf, offset, fecsize_, ch->fecsize_);
+	putField(buf, offset, iface_, ch->iface_);
+	putField(buf, offset, src_rt_valid, ch->src_rt_valid);
+	putField(buf, offset, ts_arr_, ch->ts_arr_);
+	putField(buf, offset, aomdv_salvage_count_, ch->aomdv_salvage_count_);
+	putField(buf, offset, xmit_failure_, ch->xmit_failure_);
+	putField(buf, offset, xmit_failure_data_, ch->xmit_failure_data_);
+	putField(buf, offset, xmit_reason_, ch->xmit_reason_);
+	putField(buf, offset, num_forwards_, ch->num_forwards_);
+	putField(buf, offset, opt_num_forwards_, ch->opt_num_forwards_);
 
 	if (debug_) {
 		printf("\033[0;43;30m TX COMMON packer hdr \033[0m \n");
 		printMyHdrFields(p);
 	}
 
-	return offset;
+	return offset + layout_bits;
 }
 
 size_t
@@ -254,121 +225,37 @@ packerCOMMON::unpackMyHdr(unsigned char *buf, size_t offset, Packet *p)
 	hdr_cmn *ch = HDR_CMN(p);
 
 	// Common header fields useful for DESERT
-	if (n_bits[PTYPE]) {
-		memset(&(ch->ptype_), 0, sizeof(ch->ptype_));
-		offset += get(buf, offset, &(ch->ptype_), n_bits[PTYPE]);
-	}
-
-	if (n_bits[SIZE]) {
-		memset(&(ch->size_), 0, sizeof(ch->size_));
-		offset += get(buf, offset, &(ch->size_), n_bits[SIZE]);
-		ch->size_ = restoreSignedValue(ch->size_, n_bits[SIZE]);
-	}
-
-	if (n_bits[UID]) {
-		memset(&(ch->uid_), 0, sizeof(ch->uid_));
-		offset += get(buf, offset, &(ch->uid_), n_bits[UID]);
-		ch->uid_ = restoreSignedValue(ch->uid_, n_bits[UID]);
-	}
-
-	if (n_bits[ERROR]) {
-		memset(&(ch->error_), 0, sizeof(ch->error_));
-		offset += get(buf, offset, &(ch->error_), n_bits[ERROR]);
-		ch->error_ = restoreSignedValue(ch->error_, n_bits[ERROR]);
-	}
-
-	if (n_bits[TIMESTAMP]) {
-		memset(&(ch->ts_), 0, sizeof(ch->ts_));
-		offset += get(buf, offset, &(ch->ts_), n_bits[TIMESTAMP]);
-	}
-
-	if (n_bits[DIRECTION]) {
-		memset(&(ch->direction_), 0, sizeof(ch->direction_));
-		offset += get(buf, offset, &(ch->direction_), n_bits[DIRECTION]);
-		ch->direction_ = restoreSignedValue(ch->direction_, n_bits[DIRECTION]);
-	}
-
-	if (n_bits[PREV_HOP]) {
-		memset(&(ch->prev_hop_), 0, sizeof(ch->prev_hop_));
-		offset += get(buf, offset, &(ch->prev_hop_), n_bits[PREV_HOP]);
-		ch->prev_hop_ = restoreSignedValue(ch->prev_hop_, n_bits[PREV_HOP]);
-	}
-
-	if (n_bits[NEXT_HOP]) {
-		memset(&(ch->next_hop_), 0, sizeof(ch->next_hop_));
-		offset += get(buf, offset, &(ch->next_hop_), n_bits[NEXT_HOP]);
-		ch->next_hop_ = restoreSignedValue(ch->next_hop_, n_bits[NEXT_HOP]);
-	}
-
-	if (n_bits[ADDR_TYPE]) {
-		memset(&(ch->addr_type_), 0, sizeof(ch->addr_type_));
-		offset += get(buf, offset, &(ch->addr_type_), n_bits[ADDR_TYPE]);
-		ch->addr_type_ = restoreSignedValue(ch->addr_type_, n_bits[ADDR_TYPE]);
-	}
-
-	if (n_bits[LAST_HOP]) {
-		memset(&(ch->last_hop_), 0, sizeof(ch->last_hop_));
-		offset += get(buf, offset, &(ch->last_hop_), n_bits[LAST_HOP]);
-		ch->last_hop_ = restoreSignedValue(ch->last_hop_, n_bits[LAST_HOP]);
-	}
-
-	if (n_bits[TXTIME]) {
-		memset(&(ch->txtime_), 0, sizeof(ch->txtime_));
-		offset += get(buf, offset, &(ch->txtime_), n_bits[TXTIME]);
-	}
+	getField(buf, offset, PTYPE, ch->ptype_);
+	getField(buf, offset, SIZE, ch->size_);
+	getField(buf, offset, UID, ch->uid_);
+	getField(buf, offset, ERROR, ch->error_);
+	getField(buf, offset, TIMESTAMP, ch->ts_);
+	getField(buf, offset, DIRECTION, ch->direction_);
+	getField(buf, offset, PREV_HOP, ch->prev_hop_);
+	getField(buf, offset, NEXT_HOP, ch->next_hop_);
+	getField(buf, offset, ADDR_TYPE, ch->addr_type_);
+	getField(buf, offset, LAST_HOP, ch->last_hop_);
+	getField(buf, offset, TXTIME, ch->txtime_);
 
 	// Other common header fields (maybe useful for future usage)
-	memset(&(ch->errbitcnt_), 0, sizeof(ch->errbitcnt_));
-	offset += get(buf, offset, &(ch->errbitcnt_), n_bits[errbitcnt_]);
-	ch->errbitcnt_ = restoreSignedValue(ch->errbitcnt_, n_bits[errbitcnt_]);
-
-	memset(&(ch->fecsize_), 0, sizeof(ch->fecsize_));
-	offset += get(buf, offset, &(ch->fecsize_), n_bits[fecsize_]);
-	ch->fecsize_ = restoreSignedValue(ch->fecsize_, n_bits[fecsize_]);
-
-	memset(&(ch->iface_), 0, sizeof(ch->iface_));
-	offset += get(buf, offset, &(ch->iface_), n_bits[iface_]);
-	ch->iface_ = restoreSignedValue(ch->iface_, n_bits[iface_]);
-
-	memset(&(ch->src_rt_valid), 0, sizeof(ch->src_rt_valid));
-	offset += get(buf, offset, &(ch->src_rt_valid), n_bits[src_rt_valid]);
-
-	memset(&(ch->ts_arr_), 0, sizeof(ch->ts_arr_));
-	offset += get(buf, offset, &(ch->ts_arr_), n_bits[ts_arr_]);
-
-	memset(&(ch->aomdv_salvage_count_), 0, sizeof(ch->aomdv_salvage_count_));
-	offset += get(buf,
-			offset,
-			&(ch->aomdv_salvage_count_),
-			n_bits[aomdv_salvage_count_]);
-	ch->aomdv_salvage_count_ = restoreSignedValue(
-			ch->aomdv_salvage_count_, n_bits[aomdv_salvage_count_]);
-
-	memset(&(ch->xmit_failure_), 0, sizeof(ch->xmit_failure_));
-	offset += get(buf, offset, &(ch->xmit_failure_), n_bits[xmit_failure_]);
-
-	memset(&(ch->xmit_failure_data_), 0, sizeof(ch->xmit_failure_data_));
-	offset += get(
-			buf, offset, &(ch->xmit_failure_data_), n_bits[xmit_failure_data_]);
-
-	memset(&(ch->xmit_reason_), 0, sizeof(ch->xmit_reason_));
-	offset += get(buf, offset, &(ch->xmit_reason_), n_bits[xmit_reason_]);
-	ch->xmit_reason_ =
-			restoreSignedValue(ch->xmit_reason_, n_bits[xmit_reason_]);
-
-	memset(&(ch->num_forwards_), 0, sizeof(ch->num_forwards_));
-	offset += get(buf, offset, &(ch->num_forwards_), n_bits[num_forwards_]);
-
-	memset(&(ch->opt_num_forwards_), 0, sizeof(ch->opt_num_forwards_));
-	offset += get(
-			buf, offset, &(ch->opt_num_forwards_), n_bits[opt_num_forwards_]);
+	getField(buf, offset, errbitcnt_, ch->errbitcnt_);
+	getField(buf, offset, fecsize_, ch->fecsize_);
+	getField(buf, offset, iface_, ch->iface_);
+	getField(buf, offset, src_rt_valid, ch->src_rt_valid);
+	getField(buf, offset, ts_arr_, ch->ts_arr_);
+	getField(buf, offset, aomdv_salvage_count_, ch->aomdv_salvage_count_);
+	getField(buf, offset, xmit_failure_, ch->xmit_failure_);
+	getField(buf, offset, xmit_failure_data_, ch->xmit_failure_data_);
+	getField(buf, offset, xmit_reason_, ch->xmit_reason_);
+	getField(buf, offset, num_forwards_, ch->num_forwards_);
+	getField(buf, offset, opt_num_forwards_, ch->opt_num_forwards_);
 
 	if (debug_) {
 		printf("\033[0;43;30m RX COMMON packer hdr \033[0m \n");
 		printMyHdrFields(p);
 	}
 
-	return offset;
+	return offset + layout_bits;
 }
 
 void
@@ -93,6 +93,10 @@ private:
 	 * Init the Packer
 	 */
 	void init();
+	/**
+	 * Compiles the layout of the header from the *_Bits values.
+	 */
+	void buildLayout();
 	/**
 	 * Method to transform the headers into a stream of bits
 	 * @param Pointer to the packet to serialize
@@ -148,6 +152,14 @@ private:
 							  the header stream of bits. */
 	size_t TXTIME_Bits; /** Bit length of the txtime_ field to be put in the
 						   header stream of bits. */
+	double TIMESTAMP_Min; /** Timestamp coded by 0 when quantised. */
+	double TIMESTAMP_Max; /** Largest timestamp coded when quantised. */
+	double TIMESTAMP_Resolution; /** Resolution of the quantised timestamp,
+									0 to copy the double verbatim. */
+	double TXTIME_Min; /** Tx time coded by 0 when quantised. */
+	double TXTIME_Max; /** Largest tx time coded when quantised. */
+	double TXTIME_Resolution; /** Resolution of the quantised tx time, 0 to
+								 copy the double verbatim. */
 
 	// Other common header fields (maybe useful for future usage)
 	size_t errbitcnt_Bits; /** Bit length of the errbitcnt_ field to be put in
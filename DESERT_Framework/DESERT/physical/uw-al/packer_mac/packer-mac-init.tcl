@@ -34,4 +34,10 @@ NS2/MAC/Packer set Htype_Bits 0
 NS2/MAC/Packer set TXtime_Bits 0
 NS2/MAC/Packer set SStime_Bits 0
 NS2/MAC/Packer set Padding_Bits 0
+NS2/MAC/Packer set TXtime_Min 0
+NS2/MAC/Packer set TXtime_Max 0
+NS2/MAC/Packer set TXtime_Resolution 0
+NS2/MAC/Packer set SStime_Min 0
+NS2/MAC/Packer set SStime_Max 0
+NS2/MAC/Packer set SStime_Resolution 0
 NS2/MAC/Packer set debug_ 0
@@ -66,6 +66,12 @@ packerMAC::packerMAC()
 	TXtime_Bits = 0;
 	SStime_Bits = 0;
 	Padding_Bits = 0;
+	TXtime_Min = 0;
+	TXtime_Max = 0;
+	TXtime_Resolution = 0;
+	SStime_Min = 0;
+	SStime_Max = 0;
+	SStime_Resolution = 0;
 
 	bind("Ftype_Bits", (int *) &Ftype_Bits);
 	bind("SRC_Bits", (int *) &SRC_Bits);
@@ -74,21 +80,19 @@ packerMAC::packerMAC()
 	bind("TXtime_Bits", (int *) &TXtime_Bits);
 	bind("SStime_Bits", (int *) &SStime_Bits);
 	bind("Padding_Bits", (int *) &Padding_Bits);
+	bind("TXtime_Min", &TXtime_Min);
+	bind("TXtime_Max", &TXtime_Max);
+	bind("TXtime_Resolution", &TXtime_Resolution);
+	bind("SStime_Min", &SStime_Min);
+	bind("SStime_Max", &SStime_Max);
+	bind("SStime_Resolution", &SStime_Resolution);
 
 	if (debug_)
 		cout << "Initialization (from constructor) of n_bits for the UWMAC "
 				"packer "
 			 << endl;
 
-	n_bits.clear();
-
-	n_bits.push_back(Ftype_Bits);
-	n_bits.push_back(SRC_Bits);
-	n_bits.push_back(DST_Bits);
-	n_bits.push_back(Htype_Bits);
-	n_bits.push_back(TXtime_Bits);
-	n_bits.push_back(SStime_Bits);
-	n_bits.push_back(Padding_Bits);
+	buildLayout();
 }
 
 packerMAC::~packerMAC()
@@ -102,15 +106,22 @@ packerMAC::init()
 	if (debug_)
 		cout << "Re-initialization of n_bits for the UWMAC packer " << endl;
 
-	n_bits.clear();
+	buildLayout();
+}
 
-	n_bits.push_back(Ftype_Bits);
-	n_bits.push_back(SRC_Bits);
-	n_bits.push_back(DST_Bits);
-	n_bits.push_back(Htype_Bits);
-	n_bits.push_back(TXtime_Bits);
-	n_bits.push_back(SStime_Bits);
-	n_bits.push_back(Padding_Bits);
+void
+packerMAC::buildLayout()
+{
+	// Order must match the nbits_index enum
+	clearLayout();
+
+	addField(Ftype_Bits);
+	addField(SRC_Bits, FIELD_SIGNED);
+	addField(DST_Bits, FIELD_SIGNED);
+	addField(Htype_Bits);
+	addFixedField(TXtime_Bits, TXtime_Min, TXtime_Max, TXtime_Resolution);
+	addFixedField(SStime_Bits, SStime_Min, SStime_Max, SStime_Resolution);
+	addField(Padding_Bits, FIELD_SIGNED);
 }
 
 size_t
@@ -120,21 +131,19 @@ packerMAC::packMyHdr(Packet *p, unsigned char *buf, size_t offset)
 	// Pointer to the MAC packet header
 	hdr_mac *hmac = HDR_MAC(p);
 
-	int field_idx = 0;
-
-	offset += put(buf, offset, &(hmac->ftype_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->macSA_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->macDA_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->hdr_type_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->txtime_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->sstime_), n_bits[field_idx++]);
-	offset += put(buf, offset, &(hmac->padding_), n_bits[field_idx++]);
+	putField(buf, offset, FTYPE, hmac->ftype_);
+	putField(buf, offset, SRC, hmac->macSA_);
+	putField(buf, offset, DST, hmac->macDA_);
+	putField(buf, offset, HTYPE, hmac->hdr_type_);
+	putField(buf, offset, TXTIME, hmac->txtime_);
+	putField(buf, offset, SSTIME, hmac->sstime_);
+	putField(buf, offset, PADDING, hmac->padding_);
 
 	if (debug_) {
 		printf("\033[0;45;30m TX MAC packer hdr \033[0m \n");
 		printMyHdrFields(p);
 	}
-	return offset;
+	return offset + layout_bits;
 }
 
 size_t
@@ -144,51 +153,20 @@ packerMAC::unpackMyHdr(unsigned char *buf, size_t offset, Packet *p)
 	// Pointer to the MAC packet header
 	hdr_mac *hmac = HDR_MAC(p);
 
-	int field_idx = 0;
-
-	memset(&(hmac->ftype_), 0, sizeof(hmac->ftype_));
-	offset += get(buf, offset, &(hmac->ftype_), n_bits[field_idx++]);
-
-	memset(&(hmac->macSA_), 0, sizeof(hmac->macSA_));
-	offset += get(buf, offset, &(hmac->macSA_), n_bits[field_idx++]);
-	hmac->macSA_ = restoreSignedValue(hmac->macSA_, n_bits[field_idx - 1]);
-
-	memset(&(hmac->macDA_), 0, sizeof(hmac->macDA_));
-	offset += get(buf, offset, &(hmac->macDA_), n_bits[field_idx++]);
-	hmac->macDA_ = restoreSignedValue(hmac->macDA_, n_bits[field_idx - 1]);
-
-	/* Old function to uncompresso signed value
-	if (n_bits[field_idx - 1] < sizeof(hmac->macDA()) * 8) { // Compression!
-		bitset<sizeof(hmac->macDA()) * 8 > my_bitset(hmac->macDA());
-		if (my_bitset[n_bits[field_idx - 1] - 1] == 1) {
-			for (int i = n_bits[field_idx - 1]; i < sizeof(hmac->macDA()) * 8;
-	++i) {
-				my_bitset.set(i,1);
-			}
-		}
-		hmac->macDA() = static_cast<int>(my_bitset.to_ulong());
-	}
-	 */
-
-	memset(&(hmac->hdr_type_), 0, sizeof(hmac->hdr_type_));
-	offset += get(buf, offset, &(hmac->hdr_type_), n_bits[field_idx++]);
-
-	memset(&(hmac->txtime_), 0, sizeof(hmac->txtime_));
-	offset += get(buf, offset, &(hmac->txtime_), n_bits[field_idx++]);
-
-	memset(&(hmac->sstime_), 0, sizeof(hmac->sstime_));
-	offset += get(buf, offset, &(hmac->sstime_), n_bits[field_idx++]);
-
-	memset(&(hmac->padding_), 0, sizeof(hmac->padding_));
-	offset += get(buf, offset, &(hmac->padding_), n_bits[field_idx++]);
-	hmac->padding_ = restoreSignedValue(hmac->padding_, n_bits[field_idx - 1]);
+	getField(buf, offset, FTYPE, hmac->ftype_);
+	getField(buf, offset, SRC, hmac->macSA_);
+	getField(buf, offset, DST, hmac->macDA_);
+	getField(buf, offset, HTYPE, hmac->hdr_type_);
+	getField(buf, offset, TXTIME, hmac->txtime_);
+	getField(buf, offset, SSTIME, hmac->sstime_);
+	getField(buf, offset, PADDING, hmac->padding_);
 
 	if (debug_) {
 		printf("\033[0;45;30m RX MAC packer hdr \033[0m \n");
 		printMyHdrFields(p);
 	}
 
-	return offset;
+	return offset + layout_bits;
 }
 
 void
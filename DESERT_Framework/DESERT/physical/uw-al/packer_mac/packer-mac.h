@@ -63,10 +63,23 @@ public:
 	~packerMAC();
 
 private:
+	enum nbits_index {
+		FTYPE = 0,
+		SRC,
+		DST,
+		HTYPE,
+		TXTIME,
+		SSTIME,
+		PADDING
+	};
 	/**
 	 * Init the Packer
 	 */
 	void init();
+	/**
+	 * Compiles the layout of the header from the *_Bits values.
+	 */
+	void buildLayout();
 	/**
 	 * Method to transform the headers of Uwpolling into a stream of bits
 	 * @param Pointer to the packet to serialize
@@ -110,6 +123,14 @@ private:
 						   header stream of bits. */
 	size_t Padding_Bits; /** Bit length of the padding_ field to be put in the
 							header stream of bits. */
+	double TXtime_Min; /** Tx time coded by 0 when quantised. */
+	double TXtime_Max; /** Largest tx time coded when quantised. */
+	double TXtime_Resolution; /** Resolution of the quantised tx time, 0 to
+								 copy the double verbatim. */
+	double SStime_Min; /** Start time coded by 0 when quantised. */
+	double SStime_Max; /** Largest start time coded when quantised. */
+	double SStime_Resolution; /** Resolution of the quantised start time, 0
+								 to copy the double verbatim. */
 };
 
 #endif
@@ -69,7 +69,7 @@ Uwal::Uwal()
 	, pkt_counter(0)
 	, pPacker(NULL)
 	, PSDU(DEFAULT_PSDU)
-	, dummyStr("")
+	, dummyStr(NULL)
 	, debug_(0)
 	, sendDownPkts()
 	, sendDownFrames()
@@ -80,10 +80,7 @@ Uwal::Uwal()
 	, frame_padding(0)
 	, force_endTx_(0)
 {
-	while (dummyStr.size() < PSDU) {
-		dummyStr += " DEFAULT DUMMY STRING ";
-	}
-	dummyStr.resize(PSDU);
+	setDummyStr(" DEFAULT DUMMY STRING ");
 
 	bind("nodeID", (int *) &nodeID);
 	bind("PSDU", (int *) &PSDU);
@@ -108,6 +105,14 @@ Uwal::command(int argc, const char *const *argv)
 			PERList.clear();
 			return TCL_OK;
 		}
+		if (strcmp(argv[1], "packetpool") == 0) {
+			Tcl::instance().result(UwPacketPool::instance().dump());
+			return TCL_OK;
+		}
+		if (strcmp(argv[1], "resetpacketpool") == 0) {
+			UwPacketPool::instance().reset();
+			return TCL_OK;
+		}
 	}
 	if (argc == 3) {
 		if (strcmp(argv[1], "linkPacker") == 0) { // tcl command to link to this
@@ -119,10 +124,7 @@ Uwal::command(int argc, const char *const *argv)
 
 		if (strcmp(argv[1], "setDummyStr") ==
 				0) { // tcl command to set a customized dummy string.
-			dummyStr = "";
-			while (dummyStr.size() < PSDU) {
-				dummyStr += argv[2];
-			}
+			setDummyStr(argv[2]);
 			return TCL_OK;
 		}
 	}
@@ -277,14 +279,29 @@ Uwal::initializeHdr(Packet *p, unsigned int pkt_counter_)
 	hal->pktID() = pkt_counter_;
 	hal->framePayloadOffset() = 0;
 	hal->Mbit() = 0;
-	memset(hal->dummyStr(), '\0', MAX_DUMMY_STRING_LENGTH);
-	memcpy(hal->dummyStr(), dummyStr.c_str(), dummyStr.size());
+	hal->dummyStr() = dummyStr->data();
+	hal->dummyStrLength() = dummyStr->size();
 
-	memset(hal->binPkt(), '\0', MAX_BIN_PKT_ARRAY_LENGTH);
+	hdr_uwal::clearBinPkt(p);
 	hal->binPktLength() = 0;
 	hal->binHdrLength() = 0;
 }
 
+void
+Uwal::setDummyStr(const string &pattern)
+{
+	static std::set<string> dummy_strings;
+
+	string str;
+	if (!pattern.empty()) {
+		while (str.size() < PSDU)
+			str += pattern;
+	}
+	str.resize(std::min(PSDU, (size_t) MAX_DUMMY_STRING_LENGTH), '\0');
+
+	dummyStr = &(*dummy_strings.insert(str).first);
+}
+
 void
 Uwal::fragmentPkt(Packet *p)
 {
@@ -330,6 +347,7 @@ Uwal::fragmentPkt(Packet *p)
 			Packet *f_tmp;
 			hdr_uwal *hal_tmp;
 			hdr_cmn *ch_tmp;
+			char *bin_tmp;
 
 			size_t framePayloadLength = PSDU - hdr_length;
 			size_t frameNumber = payload_length / framePayloadLength;
@@ -338,6 +356,12 @@ Uwal::fragmentPkt(Packet *p)
 
 			size_t lastFramePayloadLength = hal->binPktLength() -
 					hal->binHdrLength() - frameNumber * framePayloadLength;
+			// with frame padding the last frame may read past the end of the
+			// packet, where the chars are zero
+			const char *bin = hdr_uwal::binPkt(p,
+					std::max((size_t) hal->binPktLength(),
+							hal->binHdrLength() +
+									(frameNumber + 1) * framePayloadLength));
 
 			if (debug_) {
 				std::cout << "------ ch->size_: " << ch->size()
@@ -367,8 +391,10 @@ Uwal::fragmentPkt(Packet *p)
 				// memcpy(hal_tmp->binPkt() + hal_tmp->binHdrLength(),
 				// hal->binPkt() + hal->binHdrLength() +
 				// hal_tmp->framePayloadOffset(), framePayloadLength);
-				memcpy(hal_tmp->binPkt() + hal_tmp->binHdrLength(),
-						hal->binPkt() + hal->binHdrLength() +
+				bin_tmp = hdr_uwal::binPkt(f_tmp,
+						hal_tmp->binHdrLength() + framePayloadLength);
+				memcpy(bin_tmp + hal_tmp->binHdrLength(),
+						bin + hal->binHdrLength() +
 								hal_tmp->framePayloadOffset() *
 										framePayloadLength,
 						framePayloadLength);
@@ -380,11 +406,11 @@ Uwal::fragmentPkt(Packet *p)
 					else
 						std::cout << "TX frame num: " << i << endl;
 					std::cout << "Header: "
-							  << pPacker->hexdump(hal_tmp->binPkt(),
+							  << pPacker->hexdump(bin_tmp,
 										 hal_tmp->binHdrLength())
 							  << endl;
 					std::cout << "Payload: "
-							  << pPacker->hexdump(hal_tmp->binPkt() +
+							  << pPacker->hexdump(bin_tmp +
 												 hal_tmp->binHdrLength(),
 										 hal_tmp->binPktLength() -
 												 hal_tmp->binHdrLength())
@@ -409,16 +435,19 @@ Uwal::fragmentPkt(Packet *p)
 				pPacker->packHdr(f_tmp);
 
 				if (frame_padding) {
-					memcpy(hal_tmp->binPkt() + hal_tmp->binHdrLength(),
-							hal->binPkt() + hal->binHdrLength() +
+					bin_tmp = hdr_uwal::binPkt(f_tmp, PSDU);
+					memcpy(bin_tmp + hal_tmp->binHdrLength(),
+							bin + hal->binHdrLength() +
 									hal_tmp->framePayloadOffset() *
 											framePayloadLength,
 							PSDU - hal_tmp->binHdrLength());
 					hal_tmp->binPktLength() += (PSDU - hal_tmp->binHdrLength());
 					ch_tmp->size_ = PSDU;
 				} else {
-					memcpy(hal_tmp->binPkt() + hal_tmp->binHdrLength(),
-							hal->binPkt() + hal->binHdrLength() +
+					bin_tmp = hdr_uwal::binPkt(f_tmp,
+							hal_tmp->binHdrLength() + lastFramePayloadLength);
+					memcpy(bin_tmp + hal_tmp->binHdrLength(),
+							bin + hal->binHdrLength() +
 									hal_tmp->framePayloadOffset() *
 											framePayloadLength,
 							lastFramePayloadLength);
@@ -430,11 +459,11 @@ Uwal::fragmentPkt(Packet *p)
 				if (debug_) {
 					std::cout << "TX (last) frame num: " << frameNumber << endl;
 					std::cout << "Header: "
-							  << pPacker->hexdump(hal_tmp->binPkt(),
+							  << pPacker->hexdump(bin_tmp,
 										 hal_tmp->binHdrLength())
 							  << endl;
 					std::cout << "Payload: "
-							  << pPacker->hexdump(hal_tmp->binPkt() +
+							  << pPacker->hexdump(bin_tmp +
 												 hal_tmp->binHdrLength(),
 										 hal_tmp->binPktLength() -
 												 hal_tmp->binHdrLength())
@@ -472,6 +501,7 @@ Uwal::reassembleFrames(Packet *p)
 
 		size_t framePayloadOffset =
 				hal->framePayloadOffset() * (PSDU - hal->binHdrLength());
+		char *bin = hdr_uwal::binPkt(p, hal->binPktLength());
 		// size_t framePayloadOffset = hal->framePayloadOffset()*(ch->size() -
 		// hal->binHdrLength());
 
@@ -482,7 +512,7 @@ Uwal::reassembleFrames(Packet *p)
 				// hal->binPktLength() - hal->binHdrLength(), -1,
 				// Scheduler::instance().clock());
 				(it->second)
-						.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
+						.UpdateRxFrameSet(bin + hal->binHdrLength(),
 								framePayloadOffset,
 								hal->binPktLength() - hal->binHdrLength(),
 								-1,
@@ -494,7 +524,7 @@ Uwal::reassembleFrames(Packet *p)
 				//(hal->framePayloadOffset() + hal->binPktLength() -
 				// hal->binHdrLength()), Scheduler::instance().clock());
 				(it->second)
-						.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
+						.UpdateRxFrameSet(bin + hal->binHdrLength(),
 								framePayloadOffset,
 								hal->binPktLength() - hal->binHdrLength(),
 								(framePayloadOffset + hal->binPktLength() -
@@ -517,7 +547,7 @@ Uwal::reassembleFrames(Packet *p)
 				// newSet.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
 				// hal->framePayloadOffset(), hal->binPktLength() -
 				// hal->binHdrLength(), -1, Scheduler::instance().clock());
-				newSet.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
+				newSet.UpdateRxFrameSet(bin + hal->binHdrLength(),
 						framePayloadOffset,
 						hal->binPktLength() - hal->binHdrLength(),
 						-1,
@@ -528,7 +558,7 @@ Uwal::reassembleFrames(Packet *p)
 				// hal->binHdrLength(), (hal->framePayloadOffset() +
 				// hal->binPktLength() - hal->binHdrLength()),
 				// Scheduler::instance().clock());
-				newSet.UpdateRxFrameSet(hal->binPkt() + hal->binHdrLength(),
+				newSet.UpdateRxFrameSet(bin + hal->binHdrLength(),
 						framePayloadOffset,
 						hal->binPktLength() - hal->binHdrLength(),
 						(hal->framePayloadOffset() + hal->binPktLength() -
@@ -614,7 +644,10 @@ Uwal::checkRxFrameSet()
 			// the uwal header, since the new allocated packet must be forwarded
 			// to the upper layers)
 
-			memcpy(hal->binPkt() + hal->binHdrLength(),
+			memcpy(hdr_uwal::binPkt(p,
+						   hal->binHdrLength() +
+								   (it->second.binPayload()).size()) +
+							hal->binHdrLength(),
 					(it->second.binPayload()).c_str(),
 					(it->second.binPayload()).size());
 			hal->binPktLength() += (it->second.binPayload()).size();
@@ -45,6 +45,7 @@
 #include <mac.h>
 #include <mphy.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <errno.h>
@@ -53,6 +54,7 @@
 #include <iostream>
 #include <map>
 #include <queue>
+#include <set>
 #include <rng.h>
 #include <sstream>
 #include <stdio.h>
@@ -166,8 +168,10 @@ protected:
 	unsigned int pkt_counter; /**< Counter for the pktID to set in TX. */
 	packer *pPacker; /**< Pointer to the packer of the protocol headers */
 	size_t PSDU; /**< size of the PSDU */
-	string dummyStr; /** String containing dummy characters to be used as
-						padding chars if necessary. */
+	const string *dummyStr; /** String containing dummy characters to be
+							   used as padding chars if necessary. Interned by
+							   setDummyStr(), it is referenced by the headers
+							   of the packets. */
 	int debug_; /**< Flag to enable debug mode (i.e., printing of debug
 				   messages) if set to 1. */
 	std::queue<Packet *>
@@ -192,6 +196,13 @@ protected:
 	 * @param ID of the packet
 	 */
 	void initializeHdr(Packet *, unsigned int);
+	/**
+	 * Sets the dummy string to <em>pattern</em> repeated up to the PSDU.
+	 * Equal strings are stored only once and never released, since packets
+	 * in flight may still reference them.
+	 * @param pattern chars to repeat
+	 */
+	void setDummyStr(const string &pattern);
 	/**
 	 * Method responsible to fragment the packet
 	 * @param Pointer to the packet that are going to be fragmented
@@ -233,7 +233,8 @@ UwAhoiModem::fillAhoiPkt(Packet *p)
 
 	ahoi::packet_t packet = {0};
 
-	std::string payload(uwalh->binPkt(), uwalh->binPktLength());
+	std::string payload(hdr_uwal::binPkt(p, uwalh->binPktLength()),
+			uwalh->binPktLength());
 
 	ahoi::header_t header;
 	header.src = (unsigned int)modemID;
@@ -378,11 +379,9 @@ UwAhoiModem::transmittingData()
 
 		updateSN();
 
-		// schedule call to endTx in events queue
-		std::function<void(UwModem &, Packet * p)> callback =
-				&UwModem::realTxEnded;
-		ModemEvent e = {callback, pck};
-		event_q.push(e);
+		// schedule call to endTx in the simulator thread
+		if (pck)
+			pushTxEnded(pck);
 
 		printOnLog(LogLevel::DEBUG, "AHOIMODEM",
 		    "transmittingData::BLOCKING_ON_NEXT_PACKET");
@@ -446,26 +445,12 @@ UwAhoiModem::receivingData()
 	}
 }
 
-void
-UwAhoiModem::createRxPacket(Packet *p)
-{
-	hdr_uwal *uwalh = HDR_UWAL(p);
-	uwalh->binPktLength() = rx_payload.size();
-	std::memset(uwalh->binPkt(), 0, uwalh->binPktLength());
-	std::copy(rx_payload.begin(), rx_payload.end(), uwalh->binPkt());
-	HDR_CMN(p)->direction() = hdr_cmn::UP;
-	rx_payload = "";  // clean up the rx payload string
-}
-
 bool
-UwAhoiModem::storePacketInfo(std::shared_ptr<ahoi::packet_t> packet, Packet *p)
+UwAhoiModem::storePacketInfo(std::shared_ptr<ahoi::packet_t> packet)
 {
 	ahoi::header_t header = packet->header;
 	ahoi::footer_t footer = packet->footer;
 
-	hdr_uwal *uwalh = HDR_UWAL(p);
-	uwalh->srcID() = header.src;
-
 	if (header.type == 0x00) {
 
 		rx_payload = "";
@@ -536,17 +521,12 @@ UwAhoiModem::updateStatus(std::shared_ptr<ahoi::packet_t> packet)
 	switch (cmd->first) {
 		case ahoi::Command::send: {
 
-			Packet *p = Packet::alloc();
-
 			if (packet->header.dst == modemID || packet->header.dst == 0xFF) {
 
-			  storePacketInfo(packet, p);
-			  createRxPacket(p);
-
-			  std::function<void(UwModem &, Packet * p)> callback =
-				&UwModem::recv;
-			  ModemEvent e = {callback, p};
-			  event_q.push(e);
+			  storePacketInfo(packet);
+			  pushRxFrame((packet->header).src,
+					  rx_payload.data(), rx_payload.size());
+			  rx_payload = "";  // clean up the rx payload string
 
 			}
 
@@ -171,13 +171,6 @@ private:
 	 * param p Packet pointer of the DESERT packet */
 	ahoi::packet_t fillAhoiPkt(Packet *p);
 
-	/**
-	 * Method that fills up a packet with the needed header and payload
-	 * and makes it ready to be sent to the layer above
-	 * @param p instance of an empty packet to be filled
-	 */
-	void createRxPacket(Packet *p);
-
 	/**
 	 * Method that extarcts fields from a provided ahoi! packet and save the
 	 * info values to class field for later access. Info parameters include
@@ -191,9 +184,8 @@ private:
 	 * info values to class field for later access. Info parameters include
 	 * values such as received power, RSSI, number of corrupted packets, ecc...
 	 * @param header ahoi header the packet from which to extract the values
-	 * @param p ns2 packet in which to save the destination address, ecc...
 	 */
-	bool storePacketInfo(std::shared_ptr<ahoi::packet_t> header, Packet *p);
+	bool storePacketInfo(std::shared_ptr<ahoi::packet_t> header);
 
 	/**
 	 * Method for Sequence Number (SN) update
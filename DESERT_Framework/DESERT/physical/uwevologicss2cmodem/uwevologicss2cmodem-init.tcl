@@ -33,3 +33,4 @@ Module/UW/UwModem/EvoLogicsS2C set debug_    0
 Module/UW/UwModem/EvoLogicsS2C set period_    0.1
 Module/UW/UwModem/EvoLogicsS2C set max_read_size    2000
 Module/UW/UwModem/EvoLogicsS2C set buffer_size    2000
+Module/UW/UwModem/EvoLogicsS2C set max_outstanding_im    1
@@ -34,6 +34,7 @@
 #include <uwphy-clmsg.h>
 #include <uwsocket.h>
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <iterator>
@@ -77,6 +78,7 @@ UwEvoLogicsS2CModem::UwEvoLogicsS2CModem()
 	, p_interpreter(new UwInterpreterS2C())
 	, status(ModemState::AVAILABLE)
 	, tx_status(TransmissionState::TX_IDLE)
+	, cmd_answer(CommandAnswer::PENDING)
 	, status_m()
 	, tx_status_m()
 	, tx_queue_m()
@@ -94,12 +96,15 @@ UwEvoLogicsS2CModem::UwEvoLogicsS2CModem()
 	, n_rx_failed(0)
 	, pend_source_level(3)
 	, source_level_change(false)
+	, outstanding_tx()
+	, max_outstanding_im(1)
 
 {
 	bind("buffer_size", (int *) &DATA_BUFFER_LEN);
 	bind("max_read_size", (int *) &MAX_READ_BYTES);
 	bind("max_n_status_queries",
         (uint *) &UwEvoLogicsS2CModem::MAX_N_STATUS_QUERIES);
+	bind("max_outstanding_im", (int *) &max_outstanding_im);
 }
 
 UwEvoLogicsS2CModem::~UwEvoLogicsS2CModem()
@@ -318,7 +323,8 @@ UwEvoLogicsS2CModem::startTx(Packet *p)
 	hdr_mac *mach = HDR_MAC(p);
 	hdr_uwal *uwalh = HDR_UWAL(p);
 	std::string payload;
-	payload.assign(uwalh->binPkt(), uwalh->binPktLength());
+	payload.assign(hdr_uwal::binPkt(p, uwalh->binPktLength()),
+			uwalh->binPktLength());
 
 	// build command to perform a SEND or SENDIM
 	std::string cmd_s;
@@ -406,10 +412,7 @@ UwEvoLogicsS2CModem::startTx(Packet *p)
 		}
 
 
-		std::function<void(UwModem &, Packet * p)> callback =
-				&UwModem::realTxEnded;
-		ModemEvent e = {callback, p};
-		event_q.push(e);
+		pushTxEnded(p);
 
 	} else {
 		printOnLog(LogLevel::ERROR,
@@ -419,6 +422,126 @@ UwEvoLogicsS2CModem::startTx(Packet *p)
 	}
 }
 
+void
+UwEvoLogicsS2CModem::startPipelinedTx(Packet *p)
+{
+	hdr_mac *mach = HDR_MAC(p);
+	hdr_uwal *uwalh = HDR_UWAL(p);
+	std::string payload;
+	payload.assign(hdr_uwal::binPkt(p, uwalh->binPktLength()),
+			uwalh->binPktLength());
+	std::string cmd_s =
+			p_interpreter->buildSendIM(payload, mach->macDA(), ack_mode);
+
+	// wait for a credit, i.e., for the modem to report about an older IM.
+	// Without a report, query the modem rather than failing the oldest IM:
+	// its late report would then be taken for the following one
+	std::unique_lock<std::mutex> tx_state_lock(tx_status_m);
+	size_t status_polling_counter = 0;
+	while (!tx_status_cv.wait_for(tx_state_lock, WAIT_DELIVERY_IM, [&] {
+		return (int) outstanding_tx.size() < max_outstanding_im;
+	})) {
+		if (status_polling_counter++ == MAX_N_STATUS_QUERIES) {
+			// the modem never got this IM, so failing it keeps the FIFO
+			// aligned with the modem queue
+			printOnLog(LogLevel::ERROR,
+					"EVOLOGICSS2CMODEM",
+					"startPipelinedTx::NO_REPORT::FAILING_IM");
+			setFailedTx(p);
+			pushTxEnded(p);
+			return;
+		}
+		tx_state_lock.unlock();
+		pollOutstandingTx();
+		tx_state_lock.lock();
+	}
+	// queued before writing, so that a fast report finds it
+	outstanding_tx.push_back(p);
+	tx_status = TransmissionState::TX_PENDING;
+	tx_state_lock.unlock();
+
+	printOnLog(LogLevel::INFO,
+			"EVOLOGICSS2CMODEM",
+			"startPipelinedTx::COMMAND_TX::" + cmd_s);
+
+	bool accepted = false;
+	std::unique_lock<std::mutex> state_lock(status_m);
+	if (status_cv.wait_for(state_lock, MODEM_TIMEOUT, [&] {
+			return status == ModemState::AVAILABLE;
+		})) {
+
+		status = ModemState::BUSY;
+		cmd_answer = CommandAnswer::PENDING;
+
+		if ((p_connector->writeToDevice(cmd_s)) < 0) {
+			printOnLog(LogLevel::ERROR,
+					"EVOLOGICSS2CMODEM",
+					"startPipelinedTx::FAIL_TO_WRITE_TO_DEVICE=" + cmd_s);
+			status = ModemState::AVAILABLE;
+		} else {
+			// only OK accepts the IM: errors and notifications received in
+			// the meantime set the modem AVAILABLE as well
+			if (status_cv.wait_for(state_lock, MODEM_TIMEOUT, [&] {
+					return cmd_answer != CommandAnswer::PENDING;
+				})) {
+				accepted = (cmd_answer == CommandAnswer::ACCEPTED);
+			}
+			if (!accepted)
+				printOnLog(LogLevel::ERROR,
+						"EVOLOGICSS2CMODEM",
+						"startPipelinedTx::IM_REJECTED=" + cmd_s);
+		}
+	} else {
+		printOnLog(LogLevel::ERROR,
+				"EVOLOGICSS2CMODEM",
+				"startPipelinedTx::TIMEOUT_EXPIRED::FORCING_MODEM_AVAILABILITY");
+		status = ModemState::AVAILABLE;
+	}
+	state_lock.unlock();
+
+	if (!accepted) {
+		tx_state_lock.lock();
+		std::deque<Packet *>::iterator it =
+				std::find(outstanding_tx.begin(), outstanding_tx.end(), p);
+		if (it != outstanding_tx.end()) {
+			outstanding_tx.erase(it);
+			setFailedTx(p);
+			pushTxEnded(p);
+		}
+		tx_status_cv.notify_all();
+	}
+}
+
+void
+UwEvoLogicsS2CModem::endOutstandingTx(bool delivered)
+{
+	if (outstanding_tx.empty())
+		return;
+	Packet *p = outstanding_tx.front();
+	outstanding_tx.pop_front();
+	if (!delivered)
+		setFailedTx(p);
+	pushTxEnded(p);
+	if (outstanding_tx.empty())
+		tx_status = TransmissionState::TX_IDLE;
+}
+
+void
+UwEvoLogicsS2CModem::pollOutstandingTx()
+{
+	std::string cmd_s = p_interpreter->buildATDI();
+	std::unique_lock<std::mutex> state_lock(status_m);
+	if (!status_cv.wait_for(state_lock, MODEM_TIMEOUT, [&] {
+			return status == ModemState::AVAILABLE;
+		}))
+		return;
+	if ((p_connector->writeToDevice(cmd_s)) < 0) {
+		printOnLog(LogLevel::ERROR,
+				"EVOLOGICSS2CMODEM",
+				"pollOutstandingTx::FAIL_TO_WRITE_TO_DEVICE=" + cmd_s);
+	}
+}
+
 void
 UwEvoLogicsS2CModem::startRx(Packet *p)
 {
@@ -496,18 +619,37 @@ UwEvoLogicsS2CModem::transmittingData()
 {
 	while (transmitting.load()) {
 
+		std::unique_lock<std::mutex> tx_state_lock(tx_status_m);
+		bool pending = !outstanding_tx.empty();
+		tx_state_lock.unlock();
+
 		std::unique_lock<std::mutex> tx_lock(tx_queue_m);
-		tx_queue_cv.wait(
-				tx_lock, [&] { return !tx_queue.empty() || !transmitting; });
+		if (pending) {
+			// keep polling the modem until the pending IMs are reported
+			tx_queue_cv.wait_for(tx_lock, WAIT_DELIVERY_IM, [&] {
+				return !tx_queue.empty() || !transmitting;
+			});
+		} else {
+			tx_queue_cv.wait(
+					tx_lock, [&] { return !tx_queue.empty() || !transmitting; });
+		}
 		if (!transmitting) {
 			break;
 		}
+		if (tx_queue.empty()) {
+			tx_lock.unlock();
+			pollOutstandingTx();
+			continue;
+		}
 
 		Packet *pck = tx_queue.front();
 		tx_queue.pop();
 		tx_lock.unlock();
 		if (pck) {
-			startTx(pck);
+			if (tx_mode == TransmissionMode::IM && max_outstanding_im > 1)
+				startPipelinedTx(pck);
+			else
+				startTx(pck);
 		}
 
 		printOnLog(LogLevel::DEBUG,
@@ -577,6 +719,31 @@ void
 UwEvoLogicsS2CModem::updateStatus(UwInterpreterS2C::Response cmd)
 {
 	std::unique_lock<std::mutex> state_lock(status_m);
+	// any response sets the modem AVAILABLE: record whether the command was
+	// accepted, so that an asynchronous notification is not taken for an OK
+	if (cmd_answer == CommandAnswer::PENDING) {
+		switch (cmd) {
+			case UwInterpreterS2C::Response::OK:
+				cmd_answer = CommandAnswer::ACCEPTED;
+				break;
+			case UwInterpreterS2C::Response::BUSY:
+			case UwInterpreterS2C::Response::PHYOFF:
+			case UwInterpreterS2C::Response::NOT_ACCEPTED:
+			case UwInterpreterS2C::Response::WRONG_ADDR:
+			case UwInterpreterS2C::Response::CONN_CLOSED:
+			case UwInterpreterS2C::Response::BUFF_NOT_EMPTY:
+			case UwInterpreterS2C::Response::OUT_OF_RANGE:
+			case UwInterpreterS2C::Response::PROTOCOL_ID:
+			case UwInterpreterS2C::Response::INTERNAL:
+			case UwInterpreterS2C::Response::BUFFER_FULL:
+			case UwInterpreterS2C::Response::UNKNOWN:
+				cmd_answer = CommandAnswer::REJECTED;
+				break;
+			default:
+				break;
+		}
+	}
+
 	switch (cmd) {
 
 		case UwInterpreterS2C::Response::RECVIM: {
@@ -585,12 +752,7 @@ UwEvoLogicsS2CModem::updateStatus(UwInterpreterS2C::Response cmd)
 			status_cv.notify_all();
 			state_lock.unlock();
 
-			Packet *p = Packet::alloc();
-			createRxPacket(p);
-			std::function<void(UwModem &, Packet * p)> callback =
-					&UwModem::recv;
-			ModemEvent e = {callback, p};
-			event_q.push(e);
+			pushRxFrame(-1, rx_payload.data(), rx_payload.size());
 			break;
 		}
 		case UwInterpreterS2C::Response::RECV: {
@@ -598,12 +760,7 @@ UwEvoLogicsS2CModem::updateStatus(UwInterpreterS2C::Response cmd)
 			status_cv.notify_all();
 			state_lock.unlock();
 
-			Packet *p = Packet::alloc();
-			createRxPacket(p);
-			std::function<void(UwModem &, Packet * p)> callback =
-					&UwModem::recv;
-			ModemEvent e = {callback, p};
-			event_q.push(e);
+			pushRxFrame(-1, rx_payload.data(), rx_payload.size());
 			break;
 		}
 		case UwInterpreterS2C::Response::OK: {
@@ -618,6 +775,9 @@ UwEvoLogicsS2CModem::updateStatus(UwInterpreterS2C::Response cmd)
 			status_cv.notify_all();
 			std::unique_lock<std::mutex> tx_state_lock(tx_status_m);
 			tx_status = TransmissionState::TX_IDLE;
+			// the IM queue of the modem is empty: every IM has been sent
+			while (!outstanding_tx.empty())
+				endOutstandingTx(true);
 			im_status_updated.store(true);
 			tx_status_cv.notify_all();
 			break;
@@ -642,6 +802,7 @@ UwEvoLogicsS2CModem::updateStatus(UwInterpreterS2C::Response cmd)
 			status_cv.notify_all();
 			std::unique_lock<std::mutex> tx_state_lock(tx_status_m);
 			tx_status = TransmissionState::TX_IDLE;
+			endOutstandingTx(true);
 			im_status_updated.store(true);
 			tx_status_cv.notify_all();
 			break;
@@ -717,6 +878,7 @@ UwEvoLogicsS2CModem::updateStatus(UwInterpreterS2C::Response cmd)
 			status_cv.notify_all();
 			std::unique_lock<std::mutex> tx_state_lock(tx_status_m);
 			tx_status = TransmissionState::TX_IDLE;
+			endOutstandingTx(false);
 			im_status_updated.store(true);			
 			tx_status_cv.notify_all();
 			break;
@@ -766,6 +928,9 @@ UwEvoLogicsS2CModem::updateStatus(UwInterpreterS2C::Response cmd)
 			status_cv.notify_all();
 			std::unique_lock<std::mutex> tx_state_lock(tx_status_m);
 			tx_status = TransmissionState::TX_IDLE;
+			// without ack, the end of the transmission is the only report
+			if (!ack_mode)
+				endOutstandingTx(true);
 			im_status_updated.store(true);			
 			tx_status_cv.notify_all();
 			break;
@@ -796,12 +961,3 @@ UwEvoLogicsS2CModem::setFailedTx(Packet *p)
 	ch->error_ = 1;
 }
 
-void
-UwEvoLogicsS2CModem::createRxPacket(Packet *p)
-{
-	hdr_uwal *uwalh = HDR_UWAL(p);
-	uwalh->binPktLength() = rx_payload.size();
-	std::memset(uwalh->binPkt(), 0, uwalh->binPktLength());
-	std::copy(rx_payload.begin(), rx_payload.end(), uwalh->binPkt());
-	HDR_CMN(p)->direction() = hdr_cmn::UP;
-}
@@ -43,6 +43,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -82,6 +83,12 @@ public:
 	 */
 	enum class TransmissionState { TX_IDLE = 0, TX_PENDING };
 
+	/**
+	 * Answer of the modem to the last command written, either OK or one of
+	 * the ERROR and BUSY responses
+	 */
+	enum class CommandAnswer { PENDING = 0, ACCEPTED, REJECTED };
+
 	/**
 	 * Constructor of the UwEvoLogicsS2CModem class
 	 * @param address string containing the address to connect to
@@ -141,6 +148,28 @@ private:
 	 */
 	virtual void startTx(Packet *p);
 
+	/**
+	 * Method that writes an IM to the modem without waiting for its delivery,
+	 * as long as less than max_outstanding_im IMs are pending in the modem.
+	 * The packet is ended when the modem reports about it, see
+	 * endOutstandingTx.
+	 * @param p Packet pointer to the packet to be sent
+	 */
+	void startPipelinedTx(Packet *p);
+
+	/**
+	 * Method that ends the oldest IM pending in the modem, notifying it to
+	 * the upper layers. tx_status_m must be held by the caller.
+	 * @param delivered false if the modem reported a failure
+	 */
+	void endOutstandingTx(bool delivered);
+
+	/**
+	 * Method that asks the modem for the status of its IM queue, so that
+	 * pending IMs are ended also when no more packets are sent.
+	 */
+	void pollOutstandingTx();
+
 	/**
 	 * Method that starts a packet reception. This method is also in charge of
 	 * sending a ClMsg, Phy2MacStartRx(p), to notify the upper layers of
@@ -195,13 +224,6 @@ private:
 	 */
 	void setFailedTx(Packet *p);
 
-	/**
-	 * Method that fills up a packet with the needed header and payload
-	 * and makes it ready to be sent to the layer above
-	 * @param p instance of an empty packet to be filled
-	 */
-	void createRxPacket(Packet *p);
-
 	/** Pointer to Connector object that interfaces with the device */
 	std::unique_ptr<UwConnector> p_connector;
 	/** Pointer to Interpreter object to parse device syntax */
@@ -212,6 +234,9 @@ private:
 	TransmissionState tx_status; /**< Variable holding the current transmission
 									status of the modem */
 
+	CommandAnswer cmd_answer; /**< Answer to the last IM written by
+								 startPipelinedTx. Guarded by status_m */
+
 	/** Mutex associated with the state machine of the modem */
 	std::mutex status_m;
 	/** Mutex associated with the transmission state machine of the modem */
@@ -259,6 +284,12 @@ private:
 	/** Maximum number of time to query the modem transmission status before to
 	 * discard the transmitted packet */
 	static uint MAX_N_STATUS_QUERIES;
+
+	/** IMs written to the modem and not yet reported, oldest first.
+	 * Guarded by tx_status_m */
+	std::deque<Packet *> outstanding_tx;
+	/** Maximum number of IMs pending in the modem, 1 for stop-and-wait */
+	int max_outstanding_im;
 };
 
 #endif
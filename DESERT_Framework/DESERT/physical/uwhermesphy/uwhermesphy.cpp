@@ -138,6 +138,7 @@ UwHermesPhy::initializeLUT()
 void
 UwHermesPhy::endRx(Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, UWPHY_PERF_ENDRX);
 	if (!initLUT_)
 		cerr << "UwHermesPhy ERROR: FIRST INITIALIZE LUT!" << endl;
 	hdr_cmn *ch = HDR_CMN(p);
@@ -238,9 +239,11 @@ UwHermesPhy::endRx(Packet *p)
 			sendUp(p);
 			PktRx = 0;
 		} else {
+			UWPERF_COUNT(perf_stats, UWPHY_PERF_DROP);
 			dropPacket(p);
 		}
 	} else {
+		UWPERF_COUNT(perf_stats, UWPHY_PERF_DROP);
 		dropPacket(p);
 	}
 }
@@ -248,6 +251,7 @@ UwHermesPhy::endRx(Packet *p)
 double
 UwHermesPhy::getPER(double _snr, int _nbits, Packet *_p)
 {
+	UWPERF_SCOPE(perf_stats, UWPHY_PERF_GETPER);
 	double distance = getDistance(_p);
 	return 1 - matchPS(distance, _nbits);
 }
@@ -26,8 +26,10 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
 // ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
+#include <thread>
 #include <uwmodem.h>
 
 bool
@@ -83,7 +85,9 @@ UwModem::UwModem()
 	, log_is_open(false)
 	, checkTimer(NULL)
 	, period(0.01)
-	, event_q()
+	, rx_ring()
+	, tx_ring()
+	, rx_ring_drops(0)
 {
 	bind("debug_", (int *) &debug_);
 	bind("period_", (double *) &period);
@@ -166,14 +170,61 @@ UwModem::endTx(Packet *p)
 	Packet::free(p);
 }
 
+bool
+UwModem::pushRxFrame(int src, const char *data, size_t len)
+{
+	ModemRxEvent *e = rx_ring.back();
+	if (!e || len > MAX_BIN_PKT_ARRAY_LENGTH) {
+		rx_ring_drops++;
+		return false;
+	}
+	e->src = src;
+	e->len = len;
+	std::copy(data, data + len, e->frame);
+	rx_ring.push();
+	return true;
+}
+
+void
+UwModem::pushTxEnded(Packet *p)
+{
+	// endTx must not be lost, wait for the simulator thread to make room
+	while (!tx_ring.push(p))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+void
+UwModem::createRxPacket(Packet *p, const ModemRxEvent &e)
+{
+	hdr_uwal *uwalh = HDR_UWAL(p);
+	if (e.src >= 0)
+		uwalh->srcID() = e.src;
+	uwalh->binPktLength() = e.len;
+	std::copy(e.frame, e.frame + e.len, hdr_uwal::binPkt(p, e.len));
+	HDR_CMN(p)->direction() = hdr_cmn::UP;
+}
+
 void
 UwModem::checkEvent()
 {
-	while (event_q.size() > 0) {
-		ModemEvent e = event_q.front();
-		e.f(*this, e.p);
-		event_q.pop();
+	Packet **tx_p;
+	while ((tx_p = tx_ring.front()) != NULL) {
+		Packet *p = *tx_p;
+		tx_ring.pop();
+		realTxEnded(p);
+	}
+	ModemRxEvent *e;
+	while ((e = rx_ring.front()) != NULL) {
+		Packet *p = Packet::alloc();
+		createRxPacket(p, *e);
+		rx_ring.pop();
+		recv(p);
 	}
+	unsigned long drops = rx_ring_drops.exchange(0);
+	if (drops > 0)
+		printOnLog(LogLevel::ERROR,
+				"UWMODEM",
+				"checkEvent::RX_RING_FULL::DROPPED=" + std::to_string(drops));
 	checkTimer->resched(period);
 }
 
@@ -37,12 +37,12 @@
 #ifndef UWMODEM_H
 #define UWMODEM_H
 
+#include <atomic>
 #include <iostream>
 #include <memory>
 #include <queue>
 #include <string>
 
-#include <functional>
 #include <hdr-uwal.h>
 #include <mac.h>
 #include <mphy.h>
@@ -50,8 +50,104 @@
 #include <uwal.h>
 #include <uwip-module.h>
 
+#define UWMODEM_RX_RING_SIZE 32 /**< Slots of UwModem::rx_ring, power of 2 */
+#define UWMODEM_TX_RING_SIZE 64 /**< Slots of UwModem::tx_ring, power of 2 */
+
 class CheckTimer;
-struct ModemEvent;
+
+/**
+ * Frame received by a driver thread, waiting to be turned into a packet by
+ * the simulator thread.
+ */
+struct ModemRxEvent {
+	int src; /**< Source ID reported by the modem, -1 if not available */
+	size_t len; /**< Number of valid chars in frame */
+	char frame[MAX_BIN_PKT_ARRAY_LENGTH]; /**< Raw payload of the frame */
+};
+
+/**
+ * Bounded lock-free ring shared by exactly one producer thread and one
+ * consumer thread. Slots are preallocated and written in place, so that
+ * pushing an event does not allocate.
+ */
+template <typename T, size_t N>
+class ModemEventRing
+{
+public:
+	ModemEventRing()
+		: head(0)
+		, tail(0)
+	{
+		static_assert((N & (N - 1)) == 0, "ring size must be a power of 2");
+	}
+
+	/**
+	 * Producer side: slot to fill with the next event.
+	 * @return pointer to the free slot, NULL if the ring is full
+	 */
+	T *
+	back()
+	{
+		size_t t = tail.load(std::memory_order_relaxed);
+		if (t - head.load(std::memory_order_acquire) == N)
+			return NULL;
+		return &slots[t & (N - 1)];
+	}
+
+	/**
+	 * Producer side: publishes the slot returned by back().
+	 */
+	void
+	push()
+	{
+		tail.store(tail.load(std::memory_order_relaxed) + 1,
+				std::memory_order_release);
+	}
+
+	/**
+	 * Producer side: copies an event in the ring.
+	 * @return false if the ring is full
+	 */
+	bool
+	push(const T &e)
+	{
+		T *slot = back();
+		if (!slot)
+			return false;
+		*slot = e;
+		push();
+		return true;
+	}
+
+	/**
+	 * Consumer side: oldest event in the ring.
+	 * @return pointer to the event, NULL if the ring is empty
+	 */
+	T *
+	front()
+	{
+		size_t h = head.load(std::memory_order_relaxed);
+		if (h == tail.load(std::memory_order_acquire))
+			return NULL;
+		return &slots[h & (N - 1)];
+	}
+
+	/**
+	 * Consumer side: releases the slot returned by front().
+	 */
+	void
+	pop()
+	{
+		head.store(head.load(std::memory_order_relaxed) + 1,
+				std::memory_order_release);
+	}
+
+private:
+	std::atomic<size_t> head; /**< Events popped so far */
+	std::atomic<size_t> tail; /**< Events pushed so far */
+	T slots[N]; /**< Storage of the events */
+};
+
 /**
  * Class that implements the interface to DESERT, as used through Tcl scripts.
  * This class provides common functions to operate as a physical layer;
@@ -265,8 +361,38 @@ protected:
 	CheckTimer *checkTimer; /**< Pointer to an object to schedule the
 							  "check-modem" events. */
 	double period; /**< Checking period of the modem's buffer. */
-	/** Queue of events that are scheduled for NS2 to execute (callbacks) */
-	std::queue<ModemEvent> event_q;
+	/** Frames received by the rx thread, turned into packets by checkEvent */
+	ModemEventRing<ModemRxEvent, UWMODEM_RX_RING_SIZE> rx_ring;
+	/** Packets transmitted by the tx thread, ended by checkEvent */
+	ModemEventRing<Packet *, UWMODEM_TX_RING_SIZE> tx_ring;
+	/** Frames dropped because rx_ring was full */
+	std::atomic<unsigned long> rx_ring_drops;
+
+	/**
+	 * Method called by the rx thread to hand a received frame to the
+	 * simulator thread. It never allocates nor touches ns packets.
+	 * @param src source ID reported by the modem, -1 if not available
+	 * @param data payload of the frame
+	 * @param len length of the payload
+	 * @return false if the frame has been dropped
+	 */
+	bool pushRxFrame(int src, const char *data, size_t len);
+
+	/**
+	 * Method called by the tx thread to hand a transmitted packet to the
+	 * simulator thread, which calls endTx on it. Drivers calling it from more
+	 * than one thread have to serialize the calls.
+	 * @param p Packet pointer to the transmitted packet
+	 */
+	void pushTxEnded(Packet *p);
+
+	/**
+	 * Method that fills a freshly allocated packet with a received frame.
+	 * Called by the simulator thread only.
+	 * @param p Packet pointer to the packet to fill
+	 * @param e received frame
+	 */
+	virtual void createRxPacket(Packet *p, const ModemRxEvent &e);
 
 	/**
 	 * Method that triggers the transmission of a packet through a specified
@@ -356,9 +482,4 @@ protected:
 							  expires.*/
 };
 
-struct ModemEvent {
-	std::function<void(UwModem &, Packet *p)> f;
-	Packet *p;
-};
-
 #endif
@@ -188,7 +188,8 @@ UwModemCSA::startTx(Packet *p)
 	hdr_mac *mach = HDR_MAC(p);
 	hdr_uwal *uwalh = HDR_UWAL(p);
 	std::string payload;
-	payload.assign(uwalh->binPkt(), uwalh->binPktLength());
+	payload.assign(hdr_uwal::binPkt(p, uwalh->binPktLength()),
+			uwalh->binPktLength());
 
 	// build command to perform a SEND
 	std::string cmd_s;
@@ -215,10 +216,7 @@ UwModemCSA::startTx(Packet *p)
 
 		status = ModemState::AVAILABLE;
 		state_lock.unlock();
-		std::function<void(UwModem &, Packet * p)> callback =
-				&UwModem::realTxEnded;
-		ModemEvent e = {callback, p};
-		event_q.push(e);
+		pushTxEnded(p);
 	}
 
 	return;
@@ -450,22 +448,7 @@ UwModemCSA::startRealRx(const std::string &cmd)
 	status_cv.notify_all();
 	state_lock.unlock();
 
-	Packet *p = Packet::alloc();
-	createRxPacket(p);
-	std::function<void(UwModem &, Packet * p)> callback =
-			&UwModem::recv;
-	ModemEvent e = {callback, p};
-	event_q.push(e);
-	// recv(p);
+	pushRxFrame(-1, rx_payload.data(), rx_payload.size());
 
 }
 
-void
-UwModemCSA::createRxPacket(Packet *p)
-{
-	hdr_uwal *uwalh = HDR_UWAL(p);
-	uwalh->binPktLength() = rx_payload.size();
-	std::memset(uwalh->binPkt(), 0, uwalh->binPktLength());
-	std::copy(rx_payload.begin(), rx_payload.end(), uwalh->binPkt());
-	HDR_CMN(p)->direction() = hdr_cmn::UP;
-}
@@ -165,8 +165,6 @@ private:
 	 */
 	void startRealRx(const std::string &cmd);
 
-	void createRxPacket(Packet *p);
-
 	/** Pointer to Connector object that interfaces with the device */
 	std::unique_ptr<UwConnector> p_connector;
 
@@ -53,6 +53,9 @@ public:
 	}
 } class_module_uwphysical;
 
+const char *const UnderwaterPhysical::perf_probe_names[] = {
+		"recv", "startRx", "endRx", "getPER", "drop"};
+
 UnderwaterPhysical::UnderwaterPhysical()
 	: modulation_name_("BPSK")
 	, time_ready_to_end_rx_(0)
@@ -75,6 +78,7 @@ UnderwaterPhysical::UnderwaterPhysical()
 {
 	bind("rx_power_consumption_", &rx_power_);
 	bind("tx_power_consumption_", &tx_power_);
+	UWPERF_INIT(perf_stats, UWPHY_PERF_NPROBES, perf_probe_names);
 }
 
 int
@@ -122,6 +126,12 @@ UnderwaterPhysical::command(int argc, const char *const *argv)
 		} else if (strcasecmp(argv[1], "getErrorCtrlPktsInterf") == 0) {
 			tcl.resultf("%d", getError_CtrlPktsInterf());
 			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstats") == 0) {
+			tcl.result(UWPERF_DUMP(perf_stats));
+			return TCL_OK;
+		} else if (strcasecmp(argv[1], "perfstatsReset") == 0) {
+			UWPERF_RESET(perf_stats);
+			return TCL_OK;
 		}
 	} else if (argc == 3) {
 		if (strcasecmp(argv[1], "modulation") == 0) {
@@ -161,6 +171,7 @@ UnderwaterPhysical::command(int argc, const char *const *argv)
 void
 UnderwaterPhysical::recv(Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, UWPHY_PERF_RECV);
 	hdr_cmn *ch = HDR_CMN(p);
 	hdr_MPhy *ph = HDR_MPHY(p);
 
@@ -249,6 +260,7 @@ UnderwaterPhysical::endTx(Packet *p)
 void
 UnderwaterPhysical::startRx(Packet *p)
 {
+	UWPERF_SCOPE(perf_stats, UWPHY_PERF_STARTRX);
 	hdr_mac *mach = HDR_MAC(p);
 	hdr_MPhy *ph = HDR_MPHY(p);
 
@@ -334,6 +346,7 @@ UnderwaterPhysical::startRx(Packet *p)
 
 void
 UnderwaterPhysical::endRx(Packet *p){
+	UWPERF_SCOPE(perf_stats, UWPHY_PERF_ENDRX);
 	hdr_cmn *ch = HDR_CMN(p);
 	hdr_MPhy *ph = HDR_MPHY(p);
 	hdr_mac *mach = HDR_MAC(p);
@@ -447,9 +460,11 @@ UnderwaterPhysical::endRx(Packet *p){
 			sendUp(p);
 			PktRx = 0;
 		} else {
+			UWPERF_COUNT(perf_stats, UWPHY_PERF_DROP);
 			dropPacket(p);
 		}
 	} else {
+		UWPERF_COUNT(perf_stats, UWPHY_PERF_DROP);
 		dropPacket(p);
 	}
 } /* UnderwaterPhysical::endRx */
@@ -457,6 +472,7 @@ UnderwaterPhysical::endRx(Packet *p){
 double
 UnderwaterPhysical::getPER(double _snr, int _nbits, Packet *_p)
 {
+	UWPERF_SCOPE(perf_stats, UWPHY_PERF_GETPER);
 	double snr_with_penalty = _snr * pow(10, RxSnrPenalty_dB_ / 10.0);
 
 	double ber_ = 0;
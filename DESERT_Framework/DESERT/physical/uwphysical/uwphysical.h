@@ -41,6 +41,7 @@
 
 #include "underwater-bpsk.h"
 #include "uwinterference.h"
+#include "uwperfstats.h"
 #include "mac.h"
 
 #include <phymac-clmsg.h>
@@ -410,6 +411,21 @@ protected:
 
 	uwinterference
 			*interference_; /**< Pointer to the interference model module */
+
+	/**
+	 * Probes of the hot-path instrumentation (see uwperfstats.h).
+	 */
+	enum UWPHY_PERF_PROBE {
+		UWPHY_PERF_RECV = 0,
+		UWPHY_PERF_STARTRX,
+		UWPHY_PERF_ENDRX,
+		UWPHY_PERF_GETPER,
+		UWPHY_PERF_DROP,
+		UWPHY_PERF_NPROBES
+	};
+	static const char *const perf_probe_names[UWPHY_PERF_NPROBES]; /**< Names
+									of the probes, returned by perfstats. */
+	UWPERF_MEMBER(perf_stats) /**< Hot-path counters and timers. */
 private:
 	// Variables
 };
@@ -0,0 +1,631 @@
+#
+# Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. Neither the name of the University of Padova (SIGNET lab) nor the
+#    names of its contributors may be used to endorse or promote products
+#    derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+# TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+# PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+# OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+# WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+# OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+# ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Headless benchmark scenario.
+# opt(nn) nodes are placed on a ring around a sink and each of them sends
+# CBR traffic to the sink. MAC, routing and PHY/channel are selected from
+# the command line, so that the same script can be used to measure how the
+# simulator scales with the number of nodes and the offered load.
+# No trace file is written: at the end of the run a single line starting
+# with "BENCH" is printed, made of key=value fields (see README).
+#
+# Usage: ns bench_scenario.tcl [key=value ...]
+#   mac=aloha|csma_aloha|tdma|uwsr   routing=static|flooding|sun
+#   phy=patch|physical|optical|hermes
+#   nn=<nodes> period=<cbr period [s]> pktsize=<byte> seed=<int>
+#   stoptime=<s> radius=<m> dbs=<path of desert_samples/dbs>
+#
+# Author: DESERT contributors
+# Version: 1.0.0
+#
+#
+# Stack of the nodes                        Stack of the sink
+#   +-----------------------------+           +-----------------------------+
+#   |  7. UW/CBR                  |           |  7. UW/CBR (one per node)   |
+#   +-----------------------------+           +-----------------------------+
+#   |  6. UW/UDP                  |           |  6. UW/UDP                  |
+#   +-----------------------------+           +-----------------------------+
+#   |  5. STATIC/FLOODING/SUNNode |           |  5. STATIC/FLOODING/SUNSink |
+#   +-----------------------------+           +-----------------------------+
+#   |  4. UW/IP                   |           |  4. UW/IP                   |
+#   +-----------------------------+           +-----------------------------+
+#   |  3. UW/MLL                  |           |  3. UW/MLL                  |
+#   +-----------------------------+           +-----------------------------+
+#   |  2. ALOHA/CSMA/TDMA/USR     |           |  2. ALOHA/CSMA/TDMA/USR     |
+#   +-----------------------------+           +-----------------------------+
+#   |  1. MPHYPATCH/PHYSICAL/     |           |  1. MPHYPATCH/PHYSICAL/     |
+#   |     OPTICAL/HERMES          |           |     OPTICAL/HERMES          |
+#   +-----------------------------+           +-----------------------------+
+#                 |                                         |
+#   +-------------------------------------------------------------------------+
+#   |    DumbWirelessCh / UnderwaterChannel / UW/Optical/Channel              |
+#   +-------------------------------------------------------------------------+
+
+set bench(clock_start) [clock clicks -milliseconds]
+
+##############################
+# Default benchmark options  #
+##############################
+set opt(mac)                "csma_aloha"
+set opt(routing)            "static"
+set opt(phy)                "physical"
+set opt(nn)                 10
+set opt(period)             60.0 ;# CBR period of each node [s]
+set opt(pktsize)            125  ;# CBR payload [byte]
+set opt(seed)               1
+set opt(starttime)          1
+set opt(stoptime)           10000
+set opt(radius)             0    ;# 0 means a default suited to the PHY
+set opt(dbs)                "../desert_samples/dbs"
+set opt(maxinterval_)       20.0
+
+foreach arg $argv {
+    set kv [split $arg "="]
+    if {[llength $kv] != 2} {
+        puts stderr "bench_scenario: arguments must be key=value, got \"$arg\""
+        exit 1
+    }
+    set key [lindex $kv 0]
+    if {![info exists opt($key)]} {
+        puts stderr "bench_scenario: unknown option \"$key\""
+        exit 1
+    }
+    set opt($key) [lindex $kv 1]
+}
+set opt(nn) [expr int($opt(nn))]
+if {$opt(nn) < 1 || $opt(nn) > 253} {
+    puts stderr "bench_scenario: nn must be in \[1, 253\]"
+    exit 1
+}
+
+#####################
+# Library Loading   #
+#####################
+load libMiracle.so
+load libMiracleWirelessCh.so
+load libMiracleBasicMovement.so
+load libmphy.so
+load libmmac.so
+load libuwip.so
+load libuwmll.so
+load libuwudp.so
+load libuwcbr.so
+
+switch -- $opt(mac) {
+    "aloha"       { load libuwaloha.so;     set opt(mac_module) "Module/UW/ALOHA" }
+    "csma_aloha"  { load libuwcsmaaloha.so; set opt(mac_module) "Module/UW/CSMA_ALOHA" }
+    "tdma"        { load libuwtdma.so;      set opt(mac_module) "Module/UW/TDMA" }
+    "uwsr"        { load libuwsr.so;        set opt(mac_module) "Module/UW/USR" }
+    default {
+        puts stderr "bench_scenario: unknown mac \"$opt(mac)\""
+        exit 1
+    }
+}
+
+switch -- $opt(routing) {
+    "static" {
+        load libuwstaticrouting.so
+        set opt(node_routing) "Module/UW/StaticRouting"
+        set opt(sink_routing) "Module/UW/StaticRouting"
+    }
+    "flooding" {
+        load libuwflooding.so
+        set opt(node_routing) "Module/UW/FLOODING"
+        set opt(sink_routing) "Module/UW/FLOODING"
+    }
+    "sun" {
+        load libsun.so
+        set opt(node_routing) "Module/UW/SUNNode"
+        set opt(sink_routing) "Module/UW/SUNSink"
+    }
+    default {
+        puts stderr "bench_scenario: unknown routing \"$opt(routing)\""
+        exit 1
+    }
+}
+
+switch -- $opt(phy) {
+    "patch" {
+        load libuwmphypatch.so
+        set opt(phy_module) "Module/UW/MPhypatch"
+        set opt(def_radius) 1000.0
+    }
+    "physical" {
+        load libUwmStd.so
+        load libuwinterference.so
+        load libuwphy_clmsgs.so
+        load libuwphysical.so
+        set opt(phy_module) "Module/UW/PHYSICAL"
+        set opt(def_radius) 1000.0
+    }
+    "hermes" {
+        load libUwmStd.so
+        load libuwinterference.so
+        load libuwphy_clmsgs.so
+        load libuwphysical.so
+        load libuwhermesphy.so
+        set opt(phy_module) "Module/UW/HERMES/PHY"
+        set opt(def_radius) 80.0
+    }
+    "optical" {
+        load libuwoptical_propagation.so
+        load libuwoptical_channel.so
+        load libuwoptical_phy.so
+        set opt(phy_module) "Module/UW/OPTICAL/PHY"
+        set opt(def_radius) 20.0
+    }
+    default {
+        puts stderr "bench_scenario: unknown phy \"$opt(phy)\""
+        exit 1
+    }
+}
+if {$opt(radius) <= 0} {
+    set opt(radius) $opt(def_radius)
+}
+
+#############################
+# NS-Miracle initialization #
+#############################
+set ns [new Simulator]
+$ns use-Miracle
+
+set rng [new RNG]
+$rng seed $opt(seed)
+set rnd_gen [new RandomVariable/Uniform]
+$rnd_gen use-rng $rng
+
+# Each seed selects an independent substream of the default RNG, used by the
+# Poisson CBR traffic and the MAC backoffs
+global defaultRNG
+for {set k 1} {$k < $opt(seed)} {incr k} {
+    $defaultRNG next-substream
+}
+
+set opt(tracefile) [open "/dev/null" w]
+set opt(cltracefile) [open "/dev/null" w]
+
+#########################
+# Module Configuration  #
+#########################
+Module/UW/CBR set packetSize_          $opt(pktsize)
+Module/UW/CBR set period_              $opt(period)
+Module/UW/CBR set PoissonTraffic_      1
+Module/UW/CBR set drop_out_of_order_   0
+Module/UW/CBR set debug_               0
+
+if {$opt(routing) == "flooding"} {
+    Module/UW/FLOODING set ttl_                       6
+    Module/UW/FLOODING set maximum_cache_time__time_  60
+    Module/UW/FLOODING set optimize_                  1
+} elseif {$opt(routing) == "sun"} {
+    Module/UW/SUNNode set period_data_                $opt(period)
+    Module/UW/SUNNode set timer_route_validity_       [expr $opt(stoptime)*100]
+    Module/UW/SUNNode set timer_sink_probe_validity_  [expr $opt(stoptime)*100]
+    Module/UW/SUNNode set max_ack_error_              3
+    Module/UW/SUNNode set buffer_max_size_            5
+    Module/UW/SUNNode set timer_buffer_               $opt(period)
+    Module/UW/SUNSink set periodPoissonTraffic_       0.1
+    Module/UW/SUNSink set t_probe                     600
+}
+
+switch -- $opt(phy) {
+    "patch" {
+        set opt(bitrate) 4800.0
+        set channel [new Module/DumbWirelessCh]
+    }
+    "physical" -
+    "hermes" {
+        if {$opt(phy) == "physical"} {
+            set opt(freq)    25000.0
+            set opt(bw)      5000.0
+            set opt(bitrate) 4800.0
+            set opt(txpower) 136.0
+            set opt(maxrange) 50000
+        } else {
+            set opt(freq)    375000.0
+            set opt(bw)      76000.0
+            set opt(bitrate) 87768.0
+            set opt(txpower) 180.0
+            set opt(maxrange) 200
+        }
+        $opt(phy_module) set debug_                     0
+        $opt(phy_module) set BitRate_                   $opt(bitrate)
+        $opt(phy_module) set AcquisitionThreshold_dB_   5.0
+        $opt(phy_module) set RxSnrPenalty_dB_           0
+        $opt(phy_module) set TxSPLMargin_dB_            0
+        $opt(phy_module) set MaxTxSPL_dB_               $opt(txpower)
+        $opt(phy_module) set MinTxSPL_dB_               10
+        $opt(phy_module) set MaxTxRange_                $opt(maxrange)
+        $opt(phy_module) set PER_target_                0
+        $opt(phy_module) set CentralFreqOptimization_   0
+        $opt(phy_module) set BandwidthOptimization_     0
+        $opt(phy_module) set SPLOptimization_           0
+
+        set channel [new Module/UnderwaterChannel]
+        set propagation [new MPropagation/Underwater]
+        set data_mask [new MSpectralMask/Rect]
+        $data_mask setFreq       $opt(freq)
+        $data_mask setBandwidth  $opt(bw)
+    }
+    "optical" {
+        set opt(freq)    10000000
+        set opt(bw)      100000
+        set opt(bitrate) 1000000
+        set opt(rxArea)  0.0000011
+        Module/UW/OPTICAL/PHY set TxPower_                 50
+        Module/UW/OPTICAL/PHY set BitRate_                 $opt(bitrate)
+        Module/UW/OPTICAL/PHY set AcquisitionThreshold_dB_ 10
+        Module/UW/OPTICAL/PHY set Id_                      [expr 1.0e-9]
+        Module/UW/OPTICAL/PHY set R_                       [expr 1.49e9]
+        Module/UW/OPTICAL/PHY set S_                       0.26
+        Module/UW/OPTICAL/PHY set T_                       293.15
+        Module/UW/OPTICAL/PHY set Ar_                      $opt(rxArea)
+        Module/UW/OPTICAL/PHY set debug_                   0
+
+        Module/UW/OPTICAL/Propagation set Ar_       $opt(rxArea)
+        Module/UW/OPTICAL/Propagation set At_       0.000010
+        Module/UW/OPTICAL/Propagation set c_        0.043
+        Module/UW/OPTICAL/Propagation set theta_    1
+        Module/UW/OPTICAL/Propagation set debug_    0
+
+        set propagation [new Module/UW/OPTICAL/Propagation]
+        $propagation setOmnidirectional
+        $propagation setLUTFileName "$opt(dbs)/optical_attenuation/lut_532nm/lut_532nm_CTD001.csv"
+        $propagation setLUT
+        $propagation setVariableC
+        set channel [new Module/UW/Optical/Channel]
+        set data_mask [new MSpectralMask/Rect]
+        $data_mask setFreq       $opt(freq)
+        $data_mask setBandwidth  $opt(bw)
+
+        Module/UW/CSMA_ALOHA set listen_time_   [expr 1.0e-12]
+        Module/UW/CSMA_ALOHA set wait_costant_  [expr 1.0e-12]
+    }
+}
+
+# One TDMA slot carries one packet plus the propagation delay over the
+# diameter of the ring; the sink owns the last slot of the frame.
+if {$opt(mac) == "tdma"} {
+    set opt(slot) [expr ($opt(pktsize) + 20) * 8.0 / $opt(bitrate) + \
+            2.0 * $opt(radius) / 1500.0 + 0.1]
+    Module/UW/TDMA set fair_mode        1
+    Module/UW/TDMA set tot_slots        [expr $opt(nn) + 1]
+    Module/UW/TDMA set guard_time       0.1
+    Module/UW/TDMA set frame_duration   [expr $opt(slot) * ($opt(nn) + 1)]
+    Module/UW/TDMA set debug_           0
+    Module/UW/TDMA set queue_size_      100
+}
+
+###################################
+# Procedure(s) to create the PHY  #
+###################################
+proc setupPhy { phy_ } {
+    global opt propagation data_mask
+
+    switch -- $opt(phy) {
+        "physical" -
+        "hermes" {
+            set interf [new "Module/UW/INTERFERENCE"]
+            $interf set maxinterval_ $opt(maxinterval_)
+            $interf set debug_       0
+            $phy_ setPropagation $propagation
+            $phy_ setSpectralMask $data_mask
+            $phy_ setInterference $interf
+            if {$opt(phy) == "hermes"} {
+                $phy_ setInterferenceModel "MEANPOWER"
+                $phy_ setLUTFileName "$opt(dbs)/hermes/default.csv"
+                $phy_ initLUT
+            }
+        }
+        "optical" {
+            set interf [new "MInterference/MIV"]
+            $interf set maxinterval_ $opt(maxinterval_)
+            $interf set debug_       0
+            $phy_ setInterference $interf
+            $phy_ setPropagation $propagation
+            $phy_ setSpectralMask $data_mask
+            $phy_ setLUTFileName "$opt(dbs)/optical_noise/LUT.txt"
+            $phy_ setLUTSeparator " "
+            $phy_ useLUT
+            $phy_ setVariableTemperature
+        }
+    }
+}
+
+proc setupMac { mac_ slot_ } {
+    global opt
+
+    switch -- $opt(mac) {
+        "aloha" -
+        "csma_aloha" {
+            $mac_ setNoAckMode
+            $mac_ initialize
+        }
+        "tdma" {
+            $mac_ setSlotNumber $slot_
+        }
+        "uwsr" {
+            $mac_ initialize
+        }
+    }
+}
+
+################################
+# Procedure(s) to create nodes #
+################################
+proc createNode { id } {
+    global channel ns cbr position node udp portnum ipr ipif
+    global opt mll mac phy posdb
+
+    set node($id) [$ns create-M_Node $opt(tracefile) $opt(cltracefile)]
+
+    set cbr($id)  [new Module/UW/CBR]
+    set udp($id)  [new Module/UW/UDP]
+    set ipr($id)  [new $opt(node_routing)]
+    set ipif($id) [new Module/UW/IP]
+    set mll($id)  [new Module/UW/MLL]
+    set mac($id)  [new $opt(mac_module)]
+    set phy($id)  [new $opt(phy_module)]
+
+    $node($id) addModule 7 $cbr($id)   0  "CBR"
+    $node($id) addModule 6 $udp($id)   0  "UDP"
+    $node($id) addModule 5 $ipr($id)   0  "IPR"
+    $node($id) addModule 4 $ipif($id)  0  "IPF"
+    $node($id) addModule 3 $mll($id)   0  "MLL"
+    $node($id) addModule 2 $mac($id)   0  "MAC"
+    $node($id) addModule 1 $phy($id)   0  "PHY"
+
+    $node($id) setConnection $cbr($id)   $udp($id)   0
+    $node($id) setConnection $udp($id)   $ipr($id)   0
+    $node($id) setConnection $ipr($id)   $ipif($id)  0
+    $node($id) setConnection $ipif($id)  $mll($id)   0
+    $node($id) setConnection $mll($id)   $mac($id)   0
+    $node($id) setConnection $mac($id)   $phy($id)   0
+    $node($id) addToChannel  $channel    $phy($id)   0
+
+    set portnum($id) [$udp($id) assignPort $cbr($id)]
+    $ipif($id) addr [expr $id + 1]
+    if {$opt(routing) == "flooding"} {
+        $ipr($id) addr [expr $id + 1]
+    }
+
+    set angle [expr 2.0 * 3.14159265358979 * $id / $opt(nn)]
+    set position($id) [new "Position/BM"]
+    $node($id) addPosition $position($id)
+    $position($id) setX_ [expr $opt(radius) * cos($angle)]
+    $position($id) setY_ [expr $opt(radius) * sin($angle)]
+    $position($id) setZ_ -100
+    set posdb($id) [new "PlugIn/PositionDB"]
+    $node($id) addPlugin $posdb($id) 20 "PDB"
+    $posdb($id) addpos [$ipif($id) addr] $position($id)
+
+    setupPhy $phy($id)
+    setupMac $mac($id) $id
+}
+
+proc createSink { } {
+    global channel ns cbr_sink position_sink node_sink udp_sink portnum_sink
+    global opt mll_sink mac_sink ipr_sink ipif_sink phy_sink posdb_sink
+
+    set node_sink [$ns create-M_Node $opt(tracefile) $opt(cltracefile)]
+
+    for {set cnt 0} {$cnt < $opt(nn)} {incr cnt} {
+        set cbr_sink($cnt)  [new Module/UW/CBR]
+    }
+    set udp_sink   [new Module/UW/UDP]
+    set ipr_sink   [new $opt(sink_routing)]
+    set ipif_sink  [new Module/UW/IP]
+    set mll_sink   [new Module/UW/MLL]
+    set mac_sink   [new $opt(mac_module)]
+    set phy_sink   [new $opt(phy_module)]
+
+    for {set cnt 0} {$cnt < $opt(nn)} {incr cnt} {
+        $node_sink addModule 7 $cbr_sink($cnt) 0 "CBR"
+    }
+    $node_sink addModule 6 $udp_sink   0 "UDP"
+    $node_sink addModule 5 $ipr_sink   0 "IPR"
+    $node_sink addModule 4 $ipif_sink  0 "IPF"
+    $node_sink addModule 3 $mll_sink   0 "MLL"
+    $node_sink addModule 2 $mac_sink   0 "MAC"
+    $node_sink addModule 1 $phy_sink   0 "PHY"
+
+    for {set cnt 0} {$cnt < $opt(nn)} {incr cnt} {
+        $node_sink setConnection $cbr_sink($cnt) $udp_sink 0
+        set portnum_sink($cnt) [$udp_sink assignPort $cbr_sink($cnt)]
+    }
+    $node_sink setConnection $udp_sink  $ipr_sink   0
+    $node_sink setConnection $ipr_sink  $ipif_sink  0
+    $node_sink setConnection $ipif_sink $mll_sink   0
+    $node_sink setConnection $mll_sink  $mac_sink   0
+    $node_sink setConnection $mac_sink  $phy_sink   0
+    $node_sink addToChannel  $channel   $phy_sink   0
+
+    $ipif_sink addr 254
+    if {$opt(routing) == "flooding"} {
+        $ipr_sink addr 254
+    } elseif {$opt(routing) == "sun"} {
+        $ipr_sink setnumberofnodes $opt(nn)
+    }
+
+    set position_sink [new "Position/BM"]
+    $node_sink addPosition $position_sink
+    $position_sink setX_ 0
+    $position_sink setY_ 0
+    $position_sink setZ_ -100
+    set posdb_sink [new "PlugIn/PositionDB"]
+    $node_sink addPlugin $posdb_sink 20 "PDB"
+    $posdb_sink addpos [$ipif_sink addr] $position_sink
+
+    setupPhy $phy_sink
+    setupMac $mac_sink $opt(nn)
+}
+
+#################
+# Node Creation #
+#################
+for {set id 0} {$id < $opt(nn)} {incr id} {
+    createNode $id
+}
+createSink
+
+################################
+# Inter-node module connection #
+################################
+for {set id1 0} {$id1 < $opt(nn)} {incr id1} {
+    $cbr($id1) set destAddr_ [$ipif_sink addr]
+    $cbr($id1) set destPort_ $portnum_sink($id1)
+    $cbr_sink($id1) set destAddr_ [$ipif($id1) addr]
+    $cbr_sink($id1) set destPort_ $portnum($id1)
+}
+
+###################
+# Fill ARP tables #
+###################
+for {set id1 0} {$id1 < $opt(nn)} {incr id1} {
+    for {set id2 0} {$id2 < $opt(nn)} {incr id2} {
+        $mll($id1) addentry [$ipif($id2) addr] [$mac($id2) addr]
+    }
+    $mll($id1) addentry [$ipif_sink addr] [$mac_sink addr]
+    $mll_sink addentry [$ipif($id1) addr] [$mac($id1) addr]
+}
+
+##################
+# Routing tables #
+##################
+if {$opt(routing) == "static"} {
+    for {set id1 0} {$id1 < $opt(nn)} {incr id1} {
+        $ipr($id1) addRoute [$ipif_sink addr] [$ipif_sink addr]
+        $ipr_sink addRoute [$ipif($id1) addr] [$ipif($id1) addr]
+    }
+} elseif {$opt(routing) == "sun"} {
+    for {set id1 0} {$id1 < $opt(nn)} {incr id1} {
+        $ipr($id1) initialize
+    }
+    $ipr_sink initialize
+}
+
+#####################
+# Start/Stop Timers #
+#####################
+for {set id1 0} {$id1 < $opt(nn)} {incr id1} {
+    $ns at $opt(starttime)    "$cbr($id1) start"
+    $ns at $opt(stoptime)     "$cbr($id1) stop"
+}
+if {$opt(mac) == "tdma"} {
+    for {set id1 0} {$id1 < $opt(nn)} {incr id1} {
+        $ns at $opt(starttime)    "$mac($id1) start"
+        $ns at $opt(stoptime)     "$mac($id1) stop"
+    }
+    $ns at $opt(starttime)    "$mac_sink start"
+    $ns at $opt(stoptime)     "$mac_sink stop"
+}
+if {$opt(routing) == "sun"} {
+    $ns at [expr $opt(starttime) + 1]  "$ipr_sink start"
+    $ns at $opt(stoptime)              "$ipr_sink stop"
+}
+
+##########################
+# Measurement procedures #
+##########################
+# Peak resident set size of the process in kB, as reported by the kernel
+# (VmHWM). Returns NA where /proc is not available.
+proc peakRssKb { } {
+    if {[catch {open "/proc/self/status" r} fd]} {
+        return "NA"
+    }
+    set peak "NA"
+    while {[gets $fd line] >= 0} {
+        if {[regexp {^VmHWM:\s+([0-9]+)} $line -> kb]} {
+            set peak $kb
+            break
+        }
+    }
+    close $fd
+    return $peak
+}
+
+proc markRunStart { } {
+    global bench
+    set bench(clock_run) [clock clicks -milliseconds]
+}
+
+proc finish { } {
+    global ns opt bench cbr cbr_sink
+
+    set clock_end [clock clicks -milliseconds]
+    set setup_s [expr ($bench(clock_run) - $bench(clock_start)) / 1000.0]
+    set run_s   [expr ($clock_end - $bench(clock_run)) / 1000.0]
+    set wall_s  [expr ($clock_end - $bench(clock_start)) / 1000.0]
+
+    set sent 0
+    set recv 0
+    for {set i 0} {$i < $opt(nn)} {incr i} {
+        set sent [expr $sent + [$cbr($i) getsentpkts]]
+        set recv [expr $recv + [$cbr_sink($i) getrecvpkts]]
+    }
+    # Application packets generated or delivered: the MAC, PHY and channel
+    # work done for each packet is what we want to time.
+    set app_pkts [expr $sent + $recv]
+    if {$run_s > 0} {
+        set app_pkts_per_s [format "%.1f" [expr $app_pkts / $run_s]]
+        set sim_speedup  [format "%.1f" [expr \
+                ($opt(stoptime) - $opt(starttime)) / $run_s]]
+    } else {
+        set app_pkts_per_s "NA"
+        set sim_speedup  "NA"
+    }
+    if {$sent > 0} {
+        set per_pkt_us [format "%.2f" [expr $run_s * 1.0e6 / $sent]]
+        set pdr        [format "%.4f" [expr double($recv) / $sent]]
+    } else {
+        set per_pkt_us "NA"
+        set pdr        "NA"
+    }
+    set offered [format "%.4f" [expr $opt(nn) * $opt(pktsize) * 8.0 / \
+            $opt(period) / $opt(bitrate)]]
+
+    puts "BENCH mac=$opt(mac) routing=$opt(routing) phy=$opt(phy)\
+            nn=$opt(nn) period=$opt(period) pktsize=$opt(pktsize)\
+            offered_load=$offered seed=$opt(seed) simtime=$opt(stoptime)\
+            setup_s=$setup_s run_s=$run_s wall_s=$wall_s\
+            sent=$sent recv=$recv pdr=$pdr app_pkts=$app_pkts\
+            app_pkts_per_s=$app_pkts_per_s per_pkt_us=$per_pkt_us\
+            sim_speedup=$sim_speedup peak_rss_kb=[peakRssKb]"
+
+    $ns flush-trace
+    close $opt(tracefile)
+    close $opt(cltracefile)
+}
+
+###################
+# start simulation
+###################
+$ns at 0.0 "markRunStart"
+$ns at [expr $opt(stoptime) + 250.0]  "finish; $ns halt"
+
+$ns run
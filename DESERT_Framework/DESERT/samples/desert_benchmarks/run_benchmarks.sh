@@ -0,0 +1,88 @@
+#!/bin/bash
+#
+# Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. Neither the name of the University of Padova (SIGNET lab) nor the 
+#    names of its contributors may be used to endorse or promote products 
+#    derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+# TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+# PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+# OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+# WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+# OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+# ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Runs bench_scenario.tcl over a grid of scenarios, node counts and CBR
+# periods and collects the BENCH lines in a CSV file.
+# The grid can be changed through the environment, e.g.:
+#   MACS="csma_aloha tdma" NODES="10 50 100" ./run_benchmarks.sh out.csv
+#
+# Version: 1.0.0
+
+NS=${NS:-ns}
+MACS=${MACS:-"aloha csma_aloha tdma uwsr"}
+ROUTINGS=${ROUTINGS:-"static"}
+PHYS=${PHYS:-"patch physical"}
+NODES=${NODES:-"5 10 20 50 100"}
+PERIODS=${PERIODS:-"600 60 10"}
+SEEDS=${SEEDS:-"1"}
+STOPTIME=${STOPTIME:-10000}
+EXTRA=${EXTRA:-""}
+
+if [ $# -gt 0 ] && [ "$1" == "--help" ]
+then
+	echo "usage: $0 [output.csv]"
+	echo "environment: NS MACS ROUTINGS PHYS NODES PERIODS SEEDS STOPTIME EXTRA"
+	exit 0
+fi
+
+OUT=${1:-bench_$(date +%Y%m%d_%H%M%S).csv}
+SCRIPT_DIR=$(cd "$(dirname "$0")" && pwd)
+header_done=0
+
+for mac in ${MACS}; do
+for routing in ${ROUTINGS}; do
+for phy in ${PHYS}; do
+for nn in ${NODES}; do
+for period in ${PERIODS}; do
+for seed in ${SEEDS}; do
+	line=$(cd "${SCRIPT_DIR}" && ${NS} bench_scenario.tcl mac=${mac} \
+			routing=${routing} phy=${phy} nn=${nn} period=${period} \
+			seed=${seed} stoptime=${STOPTIME} ${EXTRA} 2>/dev/null \
+			| grep "^BENCH ")
+	if [ -z "${line}" ]
+	then
+		echo "FAILED mac=${mac} routing=${routing} phy=${phy} nn=${nn} period=${period} seed=${seed}" >&2
+		continue
+	fi
+	fields=${line#BENCH }
+	if [ ${header_done} -eq 0 ]
+	then
+		echo "${fields}" | tr ' ' '\n' | cut -d= -f1 | paste -sd, - > "${OUT}"
+		header_done=1
+	fi
+	echo "${fields}" | tr ' ' '\n' | cut -d= -f2 | paste -sd, - >> "${OUT}"
+	echo "${line}"
+done
+done
+done
+done
+done
+done
+
+echo "results written to ${OUT}"
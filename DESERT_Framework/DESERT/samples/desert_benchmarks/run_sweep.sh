@@ -0,0 +1,249 @@
+#!/bin/bash
+#
+# Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. Neither the name of the University of Padova (SIGNET lab) nor the 
+#    names of its contributors may be used to endorse or promote products 
+#    derived from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED 
+# TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+# PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR 
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; 
+# OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+# WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+# OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+# ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+# Runs a scenario script over a grid of parameters and a list of seeds on a
+# pool of worker processes, one ns process per core, and summarises the
+# result lines with mean, standard deviation and 95% confidence interval
+# across the seeds of each point of the grid.
+#   SEEDS="1 2 3 4 5 6 7 8" ./run_sweep.sh bench_scenario.tcl \
+#       mac=aloha,tdma nn=10,50 period=60
+#
+# The scenario must print a result line of key=value fields. Each
+# key=v1,v2,... argument is a dimension of the grid and every point is run
+# once per seed, passing seed=<s> to the script. Each ns process is pinned to
+# a core (taskset) and the runs are spread over JOBS workers, so a sweep takes
+# about 1/JOBS of the serial time.
+#
+# Variables: NS, JOBS [nproc], SEEDS [1..5], SEED_KEY [seed], TAG [BENCH]
+# (prefix of the result line), PIN [1] and OUT (prefix of the output files).
+# Two files are written:
+#   <OUT>_runs.csv     one row per run: grid keys, seed and result fields
+#   <OUT>_summary.csv  one row per point and numeric field: n, mean, std and
+#                      ci95, the half width of the 95% confidence interval
+#                      (Student's t) across the seeds
+# bench_scenario.tcl maps the seed to a substream of the default RNG, so the
+# replications have independent traffic and backoffs; other scenarios should
+# do the same with their seed option.
+#
+# Version: 1.0.0
+
+NS=${NS:-ns}
+JOBS=${JOBS:-$(nproc 2>/dev/null || echo 1)}
+SEEDS=${SEEDS:-"1 2 3 4 5"}
+SEED_KEY=${SEED_KEY:-seed}
+TAG=${TAG:-BENCH}
+PIN=${PIN:-1}
+OUT=${OUT:-sweep_$(date +%Y%m%d_%H%M%S)}
+
+if [ $# -lt 1 ] || [ "$1" == "--help" ]
+then
+	echo "usage: $0 scenario.tcl [key=value[,value...]]..."
+	echo "environment: NS JOBS SEEDS SEED_KEY TAG PIN OUT"
+	exit 0
+fi
+
+SCENARIO=$1
+shift
+if [ ! -f "${SCENARIO}" ]
+then
+	echo "run_sweep: ${SCENARIO} not found" >&2
+	exit 1
+fi
+SCRIPT_DIR=$(cd "$(dirname "${SCENARIO}")" && pwd)
+SCRIPT=$(basename "${SCENARIO}")
+
+# Grid: every key=v1,v2,... argument is a dimension, the points are the
+# cartesian product of the values
+keys=()
+values=()
+for arg in "$@"; do
+	case "${arg}" in
+		*=*) ;;
+		*) echo "run_sweep: arguments must be key=value, got \"${arg}\"" >&2
+		   exit 1 ;;
+	esac
+	keys+=("${arg%%=*}")
+	values+=("${arg#*=}")
+done
+
+points=("")
+for i in "${!keys[@]}"; do
+	expanded=()
+	IFS=',' read -ra vals <<< "${values[$i]}"
+	for p in "${points[@]}"; do
+		for v in "${vals[@]}"; do
+			expanded+=("${p:+${p} }${keys[$i]}=${v}")
+		done
+	done
+	points=("${expanded[@]}")
+done
+
+runs=()
+for p in "${points[@]}"; do
+	for seed in ${SEEDS}; do
+		runs+=("${p:+${p} }${SEED_KEY}=${seed}")
+	done
+done
+
+WORK=$(mktemp -d "${TMPDIR:-/tmp}/desert_sweep.XXXXXX") || exit 1
+trap 'kill $(jobs -p) 2>/dev/null; rm -rf "${WORK}"' EXIT
+
+NCPU=$(nproc 2>/dev/null || echo 1)
+PIN_CMD=""
+if [ "${PIN}" == "1" ] && command -v taskset > /dev/null
+then
+	PIN_CMD="taskset -c"
+fi
+
+# Runs one point of the grid in its own ns process, pinned to the core of
+# its worker slot
+run_one() {
+	local slot=$1
+	local idx=$2
+	shift 2
+	cd "${SCRIPT_DIR}" || return 1
+	if [ -n "${PIN_CMD}" ]
+	then
+		${PIN_CMD} $((slot % NCPU)) ${NS} "${SCRIPT}" "$@" \
+				> "${WORK}/${idx}.out" 2> "${WORK}/${idx}.err"
+	else
+		${NS} "${SCRIPT}" "$@" > "${WORK}/${idx}.out" 2> "${WORK}/${idx}.err"
+	fi
+}
+
+echo "run_sweep: ${#points[@]} points x $(echo ${SEEDS} | wc -w) seeds" \
+		"on ${JOBS} workers" >&2
+start=$(date +%s)
+slot_pid=()
+for idx in "${!runs[@]}"; do
+	# wait for a free worker slot
+	while true; do
+		for ((slot = 0; slot < JOBS; slot++)); do
+			pid=${slot_pid[$slot]}
+			if [ -z "${pid}" ] || ! kill -0 "${pid}" 2> /dev/null
+			then
+				break 2
+			fi
+		done
+		wait -n
+	done
+	run_one ${slot} ${idx} ${runs[$idx]} &
+	slot_pid[$slot]=$!
+done
+wait
+
+# Gather the result lines, in the order of the grid
+RUNS_CSV="${OUT}_runs.csv"
+SUMMARY_CSV="${OUT}_summary.csv"
+header_done=0
+failed=0
+for idx in "${!runs[@]}"; do
+	line=$(grep "^${TAG} " "${WORK}/${idx}.out" | tail -n 1)
+	if [ -z "${line}" ]
+	then
+		echo "FAILED ${runs[$idx]}" >&2
+		sed 's/^/    /' "${WORK}/${idx}.err" | tail -n 5 >&2
+		failed=$((failed + 1))
+		continue
+	fi
+	fields=${line#${TAG} }
+	run=(${runs[$idx]})
+	if [ ${header_done} -eq 0 ]
+	then
+		{
+			printf "%s\n" "${run[@]}" | cut -d= -f1
+			echo "${fields}" | tr ' ' '\n' | cut -d= -f1
+		} | paste -sd, - > "${RUNS_CSV}"
+		header_done=1
+	fi
+	{
+		printf "%s\n" "${run[@]}" | cut -d= -f2-
+		echo "${fields}" | tr ' ' '\n' | cut -d= -f2
+	} | paste -sd, - >> "${RUNS_CSV}"
+done
+
+if [ ${header_done} -eq 0 ]
+then
+	echo "run_sweep: no run produced a ${TAG} line" >&2
+	exit 1
+fi
+
+# Mean, standard deviation and half width of the 95% confidence interval
+# (Student's t) of every numeric field, per point of the grid
+awk -F, -v nk=${#keys[@]} '
+BEGIN {
+	split("12.706 4.303 3.182 2.776 2.571 2.447 2.365 2.306 2.262 2.228 " \
+		  "2.201 2.179 2.160 2.145 2.131 2.120 2.110 2.101 2.093 2.086 " \
+		  "2.080 2.074 2.069 2.064 2.060 2.056 2.052 2.048 2.045 2.042", t, " ")
+}
+NR == 1 {
+	nf = NF
+	for (i = 1; i <= NF; i++)
+		name[i] = $i
+	hdr = ""
+	for (i = 1; i <= nk; i++)
+		hdr = hdr name[i] ","
+	print hdr "metric,n,mean,std,ci95"
+	next
+}
+{
+	key = ""
+	for (i = 1; i <= nk; i++)
+		key = key $i ","
+	if (!(key in seen)) {
+		seen[key] = 1
+		order[++np] = key
+	}
+	for (i = nk + 2; i <= NF; i++) {
+		if ($i ~ /^[-+]?([0-9]+\.?[0-9]*|\.[0-9]+)([eE][-+]?[0-9]+)?$/) {
+			n[key, i]++
+			s[key, i] += $i
+			s2[key, i] += $i * $i
+		}
+	}
+}
+END {
+	for (j = 1; j <= np; j++) {
+		key = order[j]
+		for (i = nk + 2; i <= nf; i++) {
+			c = n[key, i]
+			if (!c)
+				continue
+			m = s[key, i] / c
+			v = (c > 1) ? (s2[key, i] - c * m * m) / (c - 1) : 0
+			sd = (v > 0) ? sqrt(v) : 0
+			h = (c > 1) ? ((c - 1 <= 30) ? t[c - 1] : 1.96) * sd / sqrt(c) : 0
+			printf "%s%s,%d,%.6g,%.6g,%.6g\n", key, name[i], c, m, sd, h
+		}
+	}
+}' "${RUNS_CSV}" > "${SUMMARY_CSV}"
+
+echo "run_sweep: $((${#runs[@]} - failed))/${#runs[@]} runs in" \
+		"$(( $(date +%s) - start )) s, results in ${RUNS_CSV} and" \
+		"${SUMMARY_CSV}" >&2
+[ ${failed} -eq 0 ]
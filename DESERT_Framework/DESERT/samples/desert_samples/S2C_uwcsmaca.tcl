@@ -184,8 +184,9 @@ UW/CBR/Packer set RFFT_VALID_bits 0
 UW/CBR/Packer set debug_ 0
 
 
-Module/UW/CSMA_CA set backoff_delta_ 1
-Module/UW/CSMA_CA set backoff_max 5
+Module/UW/CSMA_CA set cw_min_ 2
+Module/UW/CSMA_CA set cw_max_ 16
+Module/UW/CSMA_CA set slot_time_ 0.5
 Module/UW/CSMA_CA set cts_wait_val_ 4
 Module/UW/CSMA_CA set data_wait_val_ 4
 
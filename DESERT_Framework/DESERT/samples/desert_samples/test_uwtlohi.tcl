@@ -331,7 +331,7 @@ proc createNode { id } {
     $phy_data($id) setPropagation $propagation
     $phy_data($id) set debug_ 0
     
-    set interf_tone($id) [new "Module/UW/INTERFERENCE"]
+    set interf_tone($id) [new "MInterference/MIV/WKUP"]
     $interf_tone($id) set maxinterval_ $opt(maxinterval_)
     $interf_tone($id) set debug_       0
 
@@ -422,7 +422,7 @@ proc createSink { } {
      $phy_data_sink setPropagation      $propagation
      $phy_data_sink setInterference     $interf_data_sink
      
-      set interf_tone_sink [new "Module/UW/INTERFERENCE"]
+      set interf_tone_sink [new "MInterference/MIV/WKUP"]
       $interf_tone_sink set maxinterval_ $opt(maxinterval_)
       $interf_tone_sink set debug_       0
 
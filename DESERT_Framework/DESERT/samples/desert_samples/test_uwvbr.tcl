@@ -98,6 +98,7 @@ set opt(starttime)          1
 set opt(stoptime)           100000
 set opt(txduration)         [expr $opt(stoptime) - $opt(starttime)]
 set opt(seedvbr)            0
+set opt(vbr_trace)          "" ;# e.g. "dbs/wrov_files/video_vp9_vlq_parsed.csv"
 
 set opt(maxinterval_)       20.0
 set opt(freq)               25000.0
@@ -192,6 +193,11 @@ proc createNode { id } {
     set node($id) [$ns create-M_Node $opt(tracefile) $opt(cltracefile)] 
 
     set vbr($id)  [new Module/UW/VBR] 
+    if {$opt(vbr_trace) != ""} {
+        $vbr($id) set traceLoop_         1
+        $vbr($id) set traceRandomOffset_ 1
+        $vbr($id) tracefile $opt(vbr_trace)
+    }
     set udp($id)  [new Module/UW/UDP]
     set ipr($id)  [new Module/UW/StaticRouting]
     set ipif($id) [new Module/UW/IP]
@@ -163,14 +163,14 @@ UwUdp::recv(Packet *p, int idSrc)
 					std::set<int> tmp_set_;
 					tmp_set_.insert(ch->uid());
 					map_packets_el tmp_map_el_;
-					tmp_map_el_.insert(pair<uint8_t, std::set<int> >(
+					tmp_map_el_.insert(pair<uwip_addr_t, std::set<int> >(
 							iph->saddr(), tmp_set_));
 					map_packets.insert(pair<uint16_t, map_packets_el>(
 							iter->first, tmp_map_el_));
 				} else { // Port already used.
 					if (debug_ > 10)
 						std::cout << "--> old port" << std::endl;
-					std::map<uint8_t, std::set<int> >::iterator it2 =
+					std::map<uwip_addr_t, std::set<int> >::iterator it2 =
 							it->second.find(iph->saddr());
 					if (it2 == it->second.end()) { // Port already used but
 												   // packet from a new source.
@@ -178,7 +178,7 @@ UwUdp::recv(Packet *p, int idSrc)
 							std::cout << "  --> new source" << std::endl;
 						std::set<int> tmp_set_;
 						tmp_set_.insert(ch->uid());
-						it->second.insert(pair<uint8_t, std::set<int> >(
+						it->second.insert(pair<uwip_addr_t, std::set<int> >(
 								iph->saddr(), tmp_set_));
 					} else { // Port already used and old source.
 						if (debug_ > 10)
@@ -167,7 +167,7 @@ protected:
 	map<int, int> port_map; /**< Map: value = port;  key = id. */
 	map<int, int> id_map; /**< Map: value = id;    key = port. */
 
-	typedef std::map<uint8_t, std::set<int> > map_packets_el;
+	typedef std::map<uwip_addr_t, std::set<int> > map_packets_el;
 	std::
 			map<uint16_t, map_packets_el>
 					map_packets; /**< Map used to keep track of the packets
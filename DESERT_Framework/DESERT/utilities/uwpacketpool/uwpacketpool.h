@@ -0,0 +1,368 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwpacketpool.h
+ * @author DESERT contributors
+ * @version 1.0.0
+ *
+ * \brief Pooled variable length buffers attached to the ns packets.
+ *
+ * ns-2 already recycles the Packet objects, but every Packet::alloc(),
+ * copy() and free() clears or copies the whole header block, whose size is
+ * the sum of all the registered headers. The binary frame of hdr_uwal and
+ * the payload of hdr_DATA_APPLICATION were the largest part of it, and they
+ * are now stored out of the header, in buffers taken from size-classed free
+ * lists and attached to the packet as its AppData. ns-2 deep copies the
+ * AppData in Packet::copy() and deletes it in Packet::free(), so the
+ * buffers follow the lifetime of the packet without any change in the
+ * modules that only forward it.
+ *
+ * A buffer is cleared lazily: only the chars actually requested through
+ * UwPacketData::buffer() are zeroed, and copies only duplicate the chars in
+ * use. The pool statistics are process-wide and are returned to Tcl by the
+ * "packetpool" command of the modules using it, as a list of
+ * {size gets hits outstanding free} items, one per size class. Outstanding
+ * buffers are held by live packets: a value growing with the simulation
+ * time reveals packets that are never freed.
+ */
+
+#ifndef UWPACKETPOOL_H
+#define UWPACKETPOOL_H
+
+#include <packet.h>
+
+#include <pthread.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define UWPOOL_MIN_SIZE_BITS 6 /**< The smallest class holds 64 chars. */
+#define UWPOOL_CLASSES 7 /**< Classes of 64, 128, ..., 4096 chars. */
+#define UWPOOL_MAX_FREE 4096 /**< Buffers kept in each free list. */
+
+/**
+ * Buffers that can be attached to a packet.
+ */
+enum UWPOOL_SLOT {
+	UWPOOL_SLOT_UWAL = 0, /**< Binary frame of hdr_uwal. */
+	UWPOOL_SLOT_APPLICATION, /**< Payload of hdr_DATA_APPLICATION. */
+	UWPOOL_SLOTS
+};
+
+/**
+ * Statistics of a size class.
+ */
+struct UwPoolClassStats {
+	unsigned long gets; /**< Buffers requested. */
+	unsigned long hits; /**< Requests served by the free list. */
+	unsigned long puts; /**< Buffers given back. */
+
+	UwPoolClassStats()
+		: gets(0)
+		, hits(0)
+		, puts(0)
+	{
+	}
+};
+
+/**
+ * Process-wide set of free lists, one per size class. Buffers larger than
+ * the biggest class are allocated and released on demand, and accounted in
+ * an extra class. The socket threads of uwApplication create packets as
+ * well, so the free lists are protected by a mutex.
+ */
+class UwPacketPool
+{
+public:
+	/**
+	 * @return the pool. It is never destroyed, since packets may still be
+	 * freed during the static destruction.
+	 */
+	static UwPacketPool &
+	instance()
+	{
+		static UwPacketPool *pool = new UwPacketPool();
+		return *pool;
+	}
+
+	/**
+	 * Takes a buffer, whose content is undefined.
+	 * @param len minimum number of chars
+	 * @param cap set to the actual number of chars of the buffer
+	 * @return pointer to the buffer
+	 */
+	char *
+	get(size_t len, size_t &cap)
+	{
+		int c = sizeClass(len);
+		char *buf = NULL;
+		pthread_mutex_lock(&lock_);
+		stats_[c].gets++;
+		if (c < UWPOOL_CLASSES && !free_[c].empty()) {
+			buf = free_[c].back();
+			free_[c].pop_back();
+			stats_[c].hits++;
+		}
+		pthread_mutex_unlock(&lock_);
+		cap = (c < UWPOOL_CLASSES) ? classSize(c) : len;
+		if (buf == NULL)
+			buf = new char[cap];
+		return buf;
+	}
+
+	/**
+	 * Gives back a buffer obtained from get().
+	 * @param buf pointer to the buffer
+	 * @param cap number of chars of the buffer, as returned by get()
+	 */
+	void
+	put(char *buf, size_t cap)
+	{
+		int c = sizeClass(cap);
+		bool kept = false;
+		pthread_mutex_lock(&lock_);
+		stats_[c].puts++;
+		if (c < UWPOOL_CLASSES && free_[c].size() < UWPOOL_MAX_FREE) {
+			free_[c].push_back(buf);
+			kept = true;
+		}
+		pthread_mutex_unlock(&lock_);
+		if (!kept)
+			delete[] buf;
+	}
+
+	/**
+	 * Formats the statistics as a Tcl list. Classes never used are skipped.
+	 * @return pointer to an internal buffer, valid until the next call
+	 */
+	const char *
+	dump()
+	{
+		char buf[128];
+		pthread_mutex_lock(&lock_);
+		dump_.clear();
+		for (int c = 0; c <= UWPOOL_CLASSES; c++) {
+			const UwPoolClassStats &st = stats_[c];
+			if (st.gets == 0)
+				continue;
+			bool pooled = c < UWPOOL_CLASSES;
+			if (pooled)
+				snprintf(buf, sizeof(buf), "%lu", (unsigned long) classSize(c));
+			else
+				snprintf(buf, sizeof(buf), "oversize");
+			dump_ += dump_.empty() ? "{" : " {";
+			dump_ += buf;
+			snprintf(buf,
+					sizeof(buf),
+					" %lu %lu %lu %lu}",
+					st.gets,
+					st.hits,
+					st.gets - st.puts,
+					(unsigned long) (pooled ? free_[c].size() : 0));
+			dump_ += buf;
+		}
+		pthread_mutex_unlock(&lock_);
+		return (dump_.c_str());
+	}
+
+	/**
+	 * Clears the counters of requests and hits. The outstanding buffers are
+	 * kept, so that they still balance the buffers given back later.
+	 */
+	void
+	reset()
+	{
+		pthread_mutex_lock(&lock_);
+		for (int c = 0; c <= UWPOOL_CLASSES; c++) {
+			stats_[c].gets -= stats_[c].puts;
+			stats_[c].hits = 0;
+			stats_[c].puts = 0;
+		}
+		pthread_mutex_unlock(&lock_);
+	}
+
+private:
+	UwPacketPool()
+	{
+		pthread_mutex_init(&lock_, NULL);
+	}
+
+	/**
+	 * @return the class of a buffer of <i>len</i> chars, UWPOOL_CLASSES if
+	 * it is too large to be pooled
+	 */
+	static inline int
+	sizeClass(size_t len)
+	{
+		int c = 0;
+		while (c < UWPOOL_CLASSES && classSize(c) < len)
+			c++;
+		return c;
+	}
+
+	static inline size_t
+	classSize(int c)
+	{
+		return ((size_t) 1) << (UWPOOL_MIN_SIZE_BITS + c);
+	}
+
+	std::vector<char *> free_[UWPOOL_CLASSES]; /**< Free lists. */
+	UwPoolClassStats stats_[UWPOOL_CLASSES + 1]; /**< Statistics, the last
+													one of the oversize
+													buffers. */
+	pthread_mutex_t lock_; /**< Protects free_ and stats_. */
+	std::string dump_; /**< Buffer returned by dump(). */
+};
+
+/**
+ * AppData of a packet, holding one pooled buffer per UWPOOL_SLOT.
+ */
+class UwPacketData : public AppData
+{
+public:
+	UwPacketData()
+		: AppData(ADU_ILLEGAL)
+	{
+		for (int s = 0; s < UWPOOL_SLOTS; s++) {
+			buf_[s] = NULL;
+			cap_[s] = 0;
+			len_[s] = 0;
+		}
+	}
+
+	/**
+	 * Copy constructor, used by Packet::copy(): only the chars in use are
+	 * duplicated.
+	 */
+	UwPacketData(UwPacketData &d)
+		: AppData(d)
+	{
+		for (int s = 0; s < UWPOOL_SLOTS; s++) {
+			buf_[s] = NULL;
+			cap_[s] = 0;
+			len_[s] = 0;
+			if (d.len_[s] > 0) {
+				buf_[s] = UwPacketPool::instance().get(d.len_[s], cap_[s]);
+				memcpy(buf_[s], d.buf_[s], d.len_[s]);
+				len_[s] = d.len_[s];
+			}
+		}
+	}
+
+	virtual ~UwPacketData()
+	{
+		for (int s = 0; s < UWPOOL_SLOTS; s++) {
+			if (buf_[s] != NULL)
+				UwPacketPool::instance().put(buf_[s], cap_[s]);
+		}
+	}
+
+	virtual int
+	size() const
+	{
+		size_t sz = 0;
+		for (int s = 0; s < UWPOOL_SLOTS; s++)
+			sz += len_[s];
+		return (int) sz;
+	}
+
+	virtual AppData *
+	copy()
+	{
+		return new UwPacketData(*this);
+	}
+
+	/**
+	 * Returns a buffer of the packet, attaching it on first use.
+	 *
+	 * @param p pointer to the packet
+	 * @param slot buffer to access
+	 * @param len number of chars the caller reads or writes: the ones
+	 *        beyond those already in use are zeroed
+	 * @return pointer to the first char of the buffer
+	 */
+	static char *
+	buffer(Packet *p, UWPOOL_SLOT slot, size_t len)
+	{
+		UwPacketData *d = dynamic_cast<UwPacketData *>(p->userdata());
+		if (d == NULL) {
+			if (p->userdata() != NULL) {
+				fprintf(stderr,
+						"UwPacketData: the packet already carries a "
+						"different AppData\n");
+				abort();
+			}
+			d = new UwPacketData();
+			p->setdata(d);
+		}
+		return d->reserve(slot, len);
+	}
+
+	/**
+	 * Discards the chars of a buffer of the packet from <i>len</i> on,
+	 * without releasing it: they will be zeroed when requested again.
+	 */
+	static void
+	truncate(Packet *p, UWPOOL_SLOT slot, size_t len)
+	{
+		UwPacketData *d = dynamic_cast<UwPacketData *>(p->userdata());
+		if (d != NULL && d->len_[slot] > len)
+			d->len_[slot] = len;
+	}
+
+private:
+	char *
+	reserve(UWPOOL_SLOT slot, size_t len)
+	{
+		if (buf_[slot] == NULL || len > cap_[slot]) {
+			size_t cap;
+			char *buf = UwPacketPool::instance().get(len, cap);
+			if (buf_[slot] != NULL) {
+				memcpy(buf, buf_[slot], len_[slot]);
+				UwPacketPool::instance().put(buf_[slot], cap_[slot]);
+			}
+			buf_[slot] = buf;
+			cap_[slot] = cap;
+		}
+		if (len > len_[slot]) {
+			memset(buf_[slot] + len_[slot], 0, len - len_[slot]);
+			len_[slot] = len;
+		}
+		return buf_[slot];
+	}
+
+	char *buf_[UWPOOL_SLOTS]; /**< Buffers, NULL until requested. */
+	size_t cap_[UWPOOL_SLOTS]; /**< Number of chars of the buffers. */
+	size_t len_[UWPOOL_SLOTS]; /**< Chars in use, i.e., already zeroed or
+									written. */
+};
+
+#endif /* UWPACKETPOOL_H */
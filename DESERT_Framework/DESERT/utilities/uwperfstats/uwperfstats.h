@@ -0,0 +1,229 @@
+//
+// Copyright (c) 2026 Regents of the SIGNET lab, University of Padova.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the University of Padova (SIGNET lab) nor the
+//    names of its contributors may be used to endorse or promote products
+//    derived from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+// TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * @file   uwperfstats.h
+ * @author DESERT contributors
+ * @version 1.0.0
+ *
+ * \brief Per-instance counters and wall clock timers for the hot paths of
+ * the DESERT modules.
+ *
+ * Every instrumented class defines an enum of probes with a matching table
+ * of names, declares a UWPERF_MEMBER and initializes it in its constructor.
+ * Functions are timed with UWPERF_SCOPE, events are counted with
+ * UWPERF_COUNT, and the results are returned to Tcl by the "perfstats"
+ * command of the module as a list of
+ * {probe calls total_us mean_us max_us} items. Timers are inclusive: the
+ * time spent in the callees, also in other modules (e.g., the MAC handling a
+ * packet passed up by the PHY endRx), is accounted to the caller as well.
+ *
+ * The instrumentation is compiled only if UWPERFSTATS is defined
+ * (configure --enable-perfstats); otherwise all the macros expand to
+ * nothing and "perfstats" returns an empty list.
+ */
+
+#ifndef UWPERFSTATS_H
+#define UWPERFSTATS_H
+
+#ifdef UWPERFSTATS
+
+#include <time.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * Statistics collected for a single probe.
+ */
+struct UwPerfProbe {
+	unsigned long calls; /**< Number of calls or events. */
+	double total_us; /**< Total time spent in the probe, microseconds. */
+	double max_us; /**< Longest single call, microseconds. */
+
+	UwPerfProbe()
+		: calls(0)
+		, total_us(0)
+		, max_us(0)
+	{
+	}
+};
+
+/**
+ * Set of probes owned by a module instance.
+ */
+class UwPerfStats
+{
+public:
+	/**
+	 * Constructor of the UwPerfStats class. The probes are allocated by
+	 * init().
+	 */
+	UwPerfStats()
+		: names_(0)
+	{
+	}
+
+	/**
+	 * Allocates the probes.
+	 * @param n number of probes
+	 * @param names array of <i>n</i> probe names, must outlive the object
+	 */
+	void
+	init(int n, const char *const *names)
+	{
+		names_ = names;
+		probes_.assign(n, UwPerfProbe());
+	}
+
+	/**
+	 * Accounts a timed call of a probe.
+	 * @param probe index of the probe
+	 * @param elapsed_us duration of the call, microseconds
+	 */
+	inline void
+	add(int probe, double elapsed_us)
+	{
+		UwPerfProbe &pr = probes_[probe];
+		pr.calls++;
+		pr.total_us += elapsed_us;
+		if (elapsed_us > pr.max_us)
+			pr.max_us = elapsed_us;
+	}
+
+	/**
+	 * Accounts an event of a probe, without timing it.
+	 * @param probe index of the probe
+	 */
+	inline void
+	count(int probe)
+	{
+		probes_[probe].calls++;
+	}
+
+	/**
+	 * Clears all the probes.
+	 */
+	void
+	reset()
+	{
+		probes_.assign(probes_.size(), UwPerfProbe());
+	}
+
+	/**
+	 * Formats the probes as a Tcl list. Probes never hit are skipped.
+	 * @return pointer to an internal buffer, valid until the next call
+	 */
+	const char *
+	dump()
+	{
+		char buf[160];
+		dump_.clear();
+		for (size_t i = 0; i < probes_.size(); i++) {
+			const UwPerfProbe &pr = probes_[i];
+			if (pr.calls == 0)
+				continue;
+			snprintf(buf,
+					sizeof(buf),
+					"%s{%s %lu %.3f %.3f %.3f}",
+					dump_.empty() ? "" : " ",
+					names_[i],
+					pr.calls,
+					pr.total_us,
+					pr.total_us / pr.calls,
+					pr.max_us);
+			dump_ += buf;
+		}
+		return (dump_.c_str());
+	}
+
+	/**
+	 * @return monotonic wall clock time, microseconds
+	 */
+	static inline double
+	now()
+	{
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3);
+	}
+
+private:
+	const char *const *names_; /**< Names of the probes. */
+	std::vector<UwPerfProbe> probes_; /**< Probes, indexed by the enum of the
+										 owner. */
+	std::string dump_; /**< Buffer returned by dump(). */
+};
+
+/**
+ * Scoped timer: accounts the lifetime of the object to a probe.
+ */
+class UwPerfTimer
+{
+public:
+	UwPerfTimer(UwPerfStats &stats, int probe)
+		: stats_(stats)
+		, probe_(probe)
+		, start_(UwPerfStats::now())
+	{
+	}
+
+	~UwPerfTimer()
+	{
+		stats_.add(probe_, UwPerfStats::now() - start_);
+	}
+
+private:
+	UwPerfStats &stats_;
+	int probe_;
+	double start_;
+};
+
+#define UWPERF_CAT_(a, b) a##b
+#define UWPERF_CAT(a, b) UWPERF_CAT_(a, b)
+
+#define UWPERF_MEMBER(stats) UwPerfStats stats;
+#define UWPERF_INIT(stats, n, names) (stats).init((n), (names))
+#define UWPERF_SCOPE(stats, probe) \
+	UwPerfTimer UWPERF_CAT(uwperf_timer_, __LINE__)((stats), (probe))
+#define UWPERF_COUNT(stats, probe) (stats).count(probe)
+#define UWPERF_DUMP(stats) (stats).dump()
+#define UWPERF_RESET(stats) (stats).reset()
+
+#else /* UWPERFSTATS */
+
+#define UWPERF_MEMBER(stats)
+#define UWPERF_INIT(stats, n, names) ((void) 0)
+#define UWPERF_SCOPE(stats, probe) ((void) 0)
+#define UWPERF_COUNT(stats, probe) ((void) 0)
+#define UWPERF_DUMP(stats) ""
+#define UWPERF_RESET(stats) ((void) 0)
+
+#endif /* UWPERFSTATS */
+
+#endif /* UWPERFSTATS_H */